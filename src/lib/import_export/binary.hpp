@@ -2,7 +2,12 @@
 
 namespace opossum {
 
-enum class BinaryColumnType : uint8_t { value_column = 0, dictionary_column = 1 };
+enum class BinaryColumnType : uint8_t {
+  value_column = 0,
+  dictionary_column = 1,
+  run_length_column = 2,
+  frame_of_reference_column = 3
+};
 
 using BoolAsByteType = uint8_t;
 
@@ -27,6 +27,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
@@ -54,22 +55,34 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_child());
-  auto table_scan_node = std::dynamic_pointer_cast<PredicateNode>(node);
+  /**
+   * A chain of PredicateNodes is fused into a single TableScan that evaluates their conjunction. The lowest node comes
+   * first, as the PredicateReorderingRule puts the most selective predicate at the bottom of a chain. A node with
+   * several parents ends the chain, as its output is used elsewhere, too.
+   */
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{std::dynamic_pointer_cast<PredicateNode>(node)};
+  while (predicate_nodes.back()->left_child()->type() == LQPNodeType::Predicate &&
+         predicate_nodes.back()->left_child()->parents().size() == 1u) {
+    predicate_nodes.emplace_back(std::dynamic_pointer_cast<PredicateNode>(predicate_nodes.back()->left_child()));
+  }
+
+  const auto input_operator = translate_node(predicate_nodes.back()->left_child());
 
-  if (table_scan_node->scan_type() == ScanType::OpBetween) {
-    DebugAssert(static_cast<bool>(table_scan_node->value2()), "Scan type BETWEEN requires a second value");
-    PerformanceWarning("TableScan executes BETWEEN as two separate selects");
+  auto predicates = std::vector<TableScanPredicate>{};
+  for (auto node_it = predicate_nodes.crbegin(); node_it != predicate_nodes.crend(); ++node_it) {
+    const auto& predicate_node = **node_it;
 
-    auto table_scan1 = std::make_shared<TableScan>(input_operator, table_scan_node->column_id(),
-                                                   ScanType::OpGreaterThanEquals, table_scan_node->value());
+    if (predicate_node.scan_type() == ScanType::OpBetween) {
+      DebugAssert(static_cast<bool>(predicate_node.value2()), "Scan type BETWEEN requires a second value");
 
-    return std::make_shared<TableScan>(table_scan1, table_scan_node->column_id(), ScanType::OpLessThanEquals,
-                                       *table_scan_node->value2());
+      predicates.emplace_back(predicate_node.column_id(), ScanType::OpGreaterThanEquals, predicate_node.value());
+      predicates.emplace_back(predicate_node.column_id(), ScanType::OpLessThanEquals, *predicate_node.value2());
+    } else {
+      predicates.emplace_back(predicate_node.column_id(), predicate_node.scan_type(), predicate_node.value());
+    }
   }
 
-  return std::make_shared<TableScan>(input_operator, table_scan_node->column_id(), table_scan_node->scan_type(),
-                                     table_scan_node->value());
+  return std::make_shared<TableScan>(input_operator, predicates);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
@@ -85,24 +98,15 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
   const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   auto input_operator = translate_node(node->left_child());
 
-  /**
-   * Go through all the order descriptions and create a sort operator for each of them.
-   * Iterate in reverse because the sort operator does not support multiple columns, and instead relies on stable sort.
-   * We therefore sort by the n+1-th column before sorting by the n-th column.
-   */
+  return std::make_shared<Sort>(input_operator, _sort_definitions(*sort_node));
+}
 
-  std::shared_ptr<AbstractOperator> result_operator;
-  const auto& definitions = sort_node->order_by_definitions();
-  if (definitions.size() > 1) {
-    PerformanceWarning("Multiple ORDER BYs are executed one-by-one");
+std::vector<SortColumnDefinition> LQPTranslator::_sort_definitions(const SortNode& sort_node) const {
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  for (const auto& definition : sort_node.order_by_definitions()) {
+    sort_definitions.emplace_back(definition.column_id, definition.order_by_mode);
   }
-  for (auto it = definitions.rbegin(); it != definitions.rend(); it++) {
-    const auto& definition = *it;
-    result_operator = std::make_shared<Sort>(input_operator, definition.column_id, definition.order_by_mode);
-    input_operator = result_operator;
-  }
-
-  return result_operator;
+  return sort_definitions;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -237,8 +241,19 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_child());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
+
+  /**
+   * ORDER BY ... LIMIT only needs the first rows of the sorted input, which TopK finds without sorting all rows. If the
+   * Sort has other parents, they need all sorted rows, so the Sort is translated on its own.
+   */
+  if (node->left_child()->type() == LQPNodeType::Sort && node->left_child()->parents().size() == 1) {
+    const auto sort_node = std::dynamic_pointer_cast<SortNode>(node->left_child());
+    const auto input_operator = translate_node(sort_node->left_child());
+    return std::make_shared<TopK>(input_operator, _sort_definitions(*sort_node), limit_node->num_rows());
+  }
+
+  const auto input_operator = translate_node(node->left_child());
   return std::make_shared<Limit>(input_operator, limit_node->num_rows());
 }
 
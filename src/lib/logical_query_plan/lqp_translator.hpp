@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "all_type_variant.hpp"
@@ -9,6 +10,8 @@
 namespace opossum {
 
 class AbstractOperator;
+class SortNode;
+struct SortColumnDefinition;
 class TransactionContext;
 
 /**
@@ -41,6 +44,9 @@ class LQPTranslator final : private Noncopyable {
   // Maintenance operators
   std::shared_ptr<AbstractOperator> _translate_show_tables_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_show_columns_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  // Helpers
+  std::vector<SortColumnDefinition> _sort_definitions(const SortNode& sort_node) const;
 };
 
 }  // namespace opossum
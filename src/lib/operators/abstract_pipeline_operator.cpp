@@ -0,0 +1,131 @@
+#include "abstract_pipeline_operator.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractPipelineOperator::AbstractPipelineOperator(const std::shared_ptr<const AbstractOperator> in)
+    : AbstractReadOnlyOperator(in) {}
+
+bool AbstractPipelineOperator::can_fuse_input() const {
+  const auto input = std::dynamic_pointer_cast<const AbstractPipelineOperator>(_input_left);
+  return input && !input->get_output() && input->_can_be_fused_into_consumer();
+}
+
+void AbstractPipelineOperator::fuse_input() {
+  Assert(can_fuse_input(), "Input of " + name() + " cannot be fused into its pipeline.");
+  DebugAssert(!get_output(), "Operators must not be fused after they have been executed.");
+
+  _input_is_fused = true;
+}
+
+bool AbstractPipelineOperator::input_is_fused() const { return _input_is_fused; }
+
+std::shared_ptr<const Table> AbstractPipelineOperator::_on_execute() {
+  const auto pipeline_operators = _pipeline_operators();
+  const auto& first_operator = *pipeline_operators.front();
+  const auto input_table = first_operator._input_table_left();
+  DebugAssert(input_table->chunk_count() > 0u, "Input table must contain at least 1 chunk.");
+
+  // The output tables of the operators define the columns of the batches passed between them. Only the last one is
+  // filled.
+  auto output_tables = std::vector<std::shared_ptr<Table>>{};
+  auto transaction_contexts = std::vector<std::shared_ptr<TransactionContext>>{};
+  for (const auto pipeline_operator : pipeline_operators) {
+    const auto operator_input_table =
+        output_tables.empty() ? input_table : std::shared_ptr<const Table>{output_tables.back()};
+    output_tables.emplace_back(pipeline_operator->_create_output_table(operator_input_table));
+    transaction_contexts.emplace_back(pipeline_operator->transaction_context());
+  }
+
+  // The output chunks of each morsel are added to the output in the order of the morsels
+  auto dispatcher = MorselDispatcher{*input_table, first_operator._chunks_to_process(*input_table)};
+  auto chunks_per_morsel = std::vector<std::vector<Chunk>>(dispatcher.morsels().size());
+
+  dispatcher.process([&](const size_t morsel_id, const Morsel& morsel) {
+    auto chunks = first_operator._process_morsel(input_table, morsel, transaction_contexts.front());
+
+    for (auto operator_index = size_t{1}; operator_index < pipeline_operators.size(); ++operator_index) {
+      // The non-empty output chunks of the previous operator are the batch that the next operator processes
+      auto batch = Table::create_with_layout_from(output_tables[operator_index - 1]);
+      auto batch_morsel = Morsel{};
+      batch_morsel.node_id = morsel.node_id;
+
+      for (auto& chunk : chunks) {
+        if (chunk.size() == 0) continue;
+
+        const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(batch_morsel.ranges.size())};
+        batch_morsel.ranges.emplace_back(ChunkRange{chunk_id, 0, static_cast<ChunkOffset>(chunk.size())});
+        batch->emplace_chunk(std::move(chunk));
+      }
+
+      // All rows of the morsel were filtered out
+      if (batch_morsel.ranges.empty()) return;
+
+      chunks = pipeline_operators[operator_index]->_process_morsel(batch, batch_morsel,
+                                                                   transaction_contexts[operator_index]);
+    }
+
+    chunks_per_morsel[morsel_id] = std::move(chunks);
+  });
+
+  const auto& output = output_tables.back();
+  for (auto& chunks : chunks_per_morsel) {
+    for (auto& chunk_out : chunks) {
+      if (chunk_out.size() > 0 || output->get_chunk(ChunkID{0}).size() == 0) {
+        output->emplace_chunk(std::move(chunk_out));
+      }
+    }
+  }
+
+  if (output->get_chunk(ChunkID{0}).column_count() > 0) return output;
+
+  // If no morsel yielded any rows, the output still needs a chunk that defines its columns. Each operator creates it
+  // from the empty chunk of the previous one, so that the columns reference the same columns as they would otherwise.
+  auto empty_table = input_table;
+  for (auto operator_index = size_t{0}; operator_index < pipeline_operators.size(); ++operator_index) {
+    auto chunk = pipeline_operators[operator_index]->_create_empty_chunk(empty_table);
+    if (chunk.column_count() == 0) return output;
+
+    auto table = Table::create_with_layout_from(output_tables[operator_index]);
+    table->emplace_chunk(std::move(chunk));
+    empty_table = table;
+  }
+
+  return empty_table;
+}
+
+std::vector<ChunkID> AbstractPipelineOperator::_chunks_to_process(const Table& input_table) const {
+  auto chunk_ids = std::vector<ChunkID>(input_table.chunk_count());
+  std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0});
+  return chunk_ids;
+}
+
+std::shared_ptr<Table> AbstractPipelineOperator::_create_output_table(
+    const std::shared_ptr<const Table>& input_table) const {
+  return Table::create_with_layout_from(input_table);
+}
+
+bool AbstractPipelineOperator::_can_be_fused_into_consumer() const { return true; }
+
+std::vector<const AbstractPipelineOperator*> AbstractPipelineOperator::_pipeline_operators() const {
+  auto pipeline_operators = std::vector<const AbstractPipelineOperator*>{this};
+  while (pipeline_operators.back()->_input_is_fused) {
+    pipeline_operators.emplace_back(
+        std::static_pointer_cast<const AbstractPipelineOperator>(pipeline_operators.back()->_input_left).get());
+  }
+  std::reverse(pipeline_operators.begin(), pipeline_operators.end());
+  return pipeline_operators;
+}
+
+}  // namespace opossum
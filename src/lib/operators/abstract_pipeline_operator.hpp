@@ -0,0 +1,81 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+class TransactionContext;
+struct Morsel;
+
+/**
+ * AbstractPipelineOperator is the superclass of non-blocking operators, i.e., operators that compute the output chunks
+ * for a morsel of their input without looking at any other morsel (e.g., TableScan, Validate, Projection).
+ *
+ * Executed on its own, such an operator processes the morsels of its input table (see MorselDispatcher) and collects
+ * their output chunks in its output table. However, a chain of them can be fused into a pipeline (see fuse_input(),
+ * OperatorTask::make_tasks_from_operator()): Then, only the last operator of the pipeline is executed. It passes each
+ * morsel of the first operator's input through all operators of the pipeline, where the output chunks of one operator
+ * form a small table (a batch) that is the input of the next one. This way, only the output of the pipeline is
+ * materialized, while the intermediate PosLists of a morsel are released as soon as it has been processed. Pipeline
+ * breakers, such as joins, Aggregate, or Sort, still materialize their complete input.
+ *
+ * The fused operators are not executed themselves, so they have no output and no performance data.
+ */
+class AbstractPipelineOperator : public AbstractReadOnlyOperator {
+ public:
+  explicit AbstractPipelineOperator(const std::shared_ptr<const AbstractOperator> in);
+
+  /**
+   * The input can be fused into this operator's pipeline if it is an AbstractPipelineOperator that has not been
+   * executed yet and whose output only references other tables (see _can_be_fused_into_consumer()). The caller has
+   * to make sure that the input has no other consumer, because its output is never materialized.
+   */
+  bool can_fuse_input() const;
+
+  // Must be called before the operator is executed
+  void fuse_input();
+
+  bool input_is_fused() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // Returns the chunks of the input table that have to be processed at all. By default, these are all of them.
+  virtual std::vector<ChunkID> _chunks_to_process(const Table& input_table) const;
+
+  // Returns an empty table with the output columns for the given input. By default, these are the input columns.
+  virtual std::shared_ptr<Table> _create_output_table(const std::shared_ptr<const Table>& input_table) const;
+
+  /**
+   * Returns the output chunks for the rows of the morsel. Is called concurrently for different morsels and, within a
+   * pipeline, for different input tables. Chunks without rows are skipped by the next operator.
+   */
+  virtual std::vector<Chunk> _process_morsel(const std::shared_ptr<const Table>& input_table, const Morsel& morsel,
+                                             const std::shared_ptr<TransactionContext>& transaction_context) const = 0;
+
+  /**
+   * Returns the chunk that defines the output columns if no morsel yields any rows, or a chunk without columns if
+   * the input has none either
+   */
+  virtual Chunk _create_empty_chunk(const std::shared_ptr<const Table>& input_table) const = 0;
+
+  /**
+   * Operators whose output chunks contain data columns must not be fused into their consumer, because the output
+   * would then reference the batch tables of the pipeline instead of a table that outlives it.
+   */
+  virtual bool _can_be_fused_into_consumer() const;
+
+ private:
+  // The operators of the pipeline that ends with this operator, starting with the first one
+  std::vector<const AbstractPipelineOperator*> _pipeline_operators() const;
+
+  bool _input_is_fused = false;
+};
+
+}  // namespace opossum
@@ -1,10 +1,15 @@
 #include "aggregate.hpp"
 
 #include <algorithm>
-#include <map>
+#include <cstring>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -14,6 +19,7 @@
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/iterables/create_iterable_from_column.hpp"
+#include "storage/run_length_column.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 
@@ -41,51 +47,62 @@ std::shared_ptr<AbstractOperator> Aggregate::recreate(const std::vector<AllParam
 }
 
 /*
-Visitor context for the partitioning/grouping visitor
+Packs a value of a group-by column into a 64 bit word of a group key. Equal values are packed into equal words.
+Strings are not packed here, they are replaced by ids (see Aggregate::_group_morsel).
 */
-struct GroupByContext : ColumnVisitableContext {
-  GroupByContext(std::shared_ptr<const Table> t, ChunkID chunk, ColumnID column,
-                 std::shared_ptr<std::vector<AggregateKey>> keys)
-      : table_in(t), chunk_id(chunk), column_id(column), hash_keys(keys) {}
-
-  // constructor for use in ReferenceColumn::visit_dereferenced
-  GroupByContext(std::shared_ptr<BaseColumn>, const std::shared_ptr<const Table> referenced_table,
-                 std::shared_ptr<ColumnVisitableContext> base_context, ChunkID chunk_id,
-                 std::shared_ptr<std::vector<ChunkOffset>> chunk_offsets)
-      : table_in(referenced_table),
-        chunk_id(chunk_id),
-        column_id(std::static_pointer_cast<GroupByContext>(base_context)->column_id),
-        hash_keys(std::static_pointer_cast<GroupByContext>(base_context)->hash_keys),
-        chunk_offsets_in(chunk_offsets) {}
-
-  std::shared_ptr<const Table> table_in;
-  ChunkID chunk_id;
-  const ColumnID column_id;
-  std::shared_ptr<std::vector<AggregateKey>> hash_keys;
-  std::shared_ptr<std::vector<ChunkOffset>> chunk_offsets_in;
-};
-
-/*
-Visitor context for the AggregateVisitor.
-*/
-template <typename ColumnType, typename AggregateType>
-struct AggregateContext : ColumnVisitableContext {
-  AggregateContext() {}
-  explicit AggregateContext(std::shared_ptr<GroupByContext> base_context) : groupby_context(base_context) {}
+template <typename T>
+uint64_t pack_group_key(const T& value) {
+  if constexpr (std::is_floating_point_v<T>) {
+    // -0.0 and 0.0 are equal and need to end up in the same group
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    auto word = uint64_t{0};
+    std::memcpy(&word, &normalized_value, sizeof(T));
+    return word;
+  } else {
+    return static_cast<uint64_t>(value);
+  }
+}
 
-  // constructor for use in ReferenceColumn::visit_dereferenced
-  AggregateContext(std::shared_ptr<BaseColumn>, const std::shared_ptr<const Table>,
-                   std::shared_ptr<ColumnVisitableContext> base_context, ChunkID chunk_id,
-                   std::shared_ptr<std::vector<ChunkOffset>> chunk_offsets)
-      : groupby_context(std::static_pointer_cast<AggregateContext>(base_context)->groupby_context),
-        results(std::static_pointer_cast<AggregateContext>(base_context)->results) {
-    groupby_context->chunk_id = chunk_id;
-    groupby_context->chunk_offsets_in = chunk_offsets;
+template <typename T>
+T unpack_group_key(const uint64_t word) {
+  if constexpr (std::is_floating_point_v<T>) {
+    auto value = T{};
+    std::memcpy(&value, &word, sizeof(T));
+    return value;
+  } else {
+    return static_cast<T>(word);
   }
+}
 
-  std::shared_ptr<GroupByContext> groupby_context;
-  std::shared_ptr<std::map<AggregateKey, AggregateResult<AggregateType, ColumnType>>> results;
-};
+/*
+Calls functor(type, function) with the data type of an aggregated column as boost::hana::type and the aggregate
+function as std::integral_constant, so that both can be used as template arguments.
+*/
+template <typename Functor>
+void resolve_aggregate_function(const DataType data_type, const AggregateFunction function, const Functor& functor) {
+  resolve_data_type(data_type, [&](auto type) {
+    switch (function) {
+      case AggregateFunction::Min:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::Min>{});
+        break;
+      case AggregateFunction::Max:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::Max>{});
+        break;
+      case AggregateFunction::Sum:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::Sum>{});
+        break;
+      case AggregateFunction::Avg:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::Avg>{});
+        break;
+      case AggregateFunction::Count:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+        break;
+      case AggregateFunction::CountDistinct:
+        functor(type, std::integral_constant<AggregateFunction, AggregateFunction::CountDistinct>{});
+        break;
+    }
+  });
+}
 
 /*
 The following structs describe the different aggregate traits.
@@ -163,490 +180,799 @@ struct AggregateTraits<ColumnType, function, typename std::enable_if_t<!std::is_
 };
 
 /*
-The AggregateFunctionBuilder is used to create the lambda function that will be used by
-the AggregateVisitor. It is a separate class because methods cannot be partially specialized.
-Therefore, we partially specialize the whole class and define the get_aggregate_function anew every time.
-*/
-template <typename ColumnType, typename AggregateType>
-using AggregateFunctor = std::function<std::optional<AggregateType>(ColumnType, std::optional<AggregateType>)>;
+The state of one aggregate function for one group. Each function has its own state that holds only what the function
+needs: update() adds a non-NULL value of the group, update_run() adds the same value count times (see the run-length
+encoded columns in Aggregate::_aggregate_column), merge() adds the state of the same group in another morsel, and
+is_null() and value() are written to the output. As the states are chosen at compile time, update() is inlined into
+the loops over the input columns.
 
-template <typename ColumnType, typename AggregateType, AggregateFunction function>
-struct AggregateFunctionBuilder {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() { Fail("Invalid aggregate function"); }
+The primary template covers SUM and AVG on strings, which are rejected in Aggregate::_on_execute.
+*/
+template <typename ColumnType, AggregateFunction function, typename Enable = void>
+struct AggregateState {
+  using AggregateType = typename AggregateTraits<ColumnType, function>::aggregate_type;
+
+  void update(const ColumnType&) { Fail("Invalid aggregate"); }
+  void update_run(const ColumnType&, size_t) { Fail("Invalid aggregate"); }
+  void merge(AggregateState&) { Fail("Invalid aggregate"); }
+  bool is_null() const { return true; }
+  AggregateType value() const {
+    Fail("Invalid aggregate");
+    return AggregateType{};
+  }
 };
 
-template <typename ColumnType, typename AggregateType>
-struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Min> {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType new_value, std::optional<AggregateType> current_aggregate) {
-      if (!current_aggregate || value_smaller(new_value, *current_aggregate)) {
-        // New minimum found
-        return new_value;
-      }
-      return *current_aggregate;
-    };
+template <typename ColumnType>
+struct AggregateState<ColumnType, AggregateFunction::Min> {
+  void update(const ColumnType& new_value) {
+    if (!has_value || value_smaller(new_value, min)) {
+      min = new_value;
+      has_value = true;
+    }
   }
-};
 
-template <typename ColumnType, typename AggregateType>
-struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Max> {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType new_value, std::optional<AggregateType> current_aggregate) {
-      if (!current_aggregate || value_greater(new_value, *current_aggregate)) {
-        // New maximum found
-        return new_value;
-      }
-      return *current_aggregate;
-    };
+  void update_run(const ColumnType& new_value, size_t) { update(new_value); }
+
+  void merge(AggregateState& other) {
+    if (other.has_value && (!has_value || value_smaller(other.min, min))) {
+      min = std::move(other.min);
+      has_value = true;
+    }
   }
+
+  bool is_null() const { return !has_value; }
+  const ColumnType& value() const { return min; }
+
+  ColumnType min{};
+  bool has_value = false;
 };
 
-template <typename ColumnType, typename AggregateType>
-struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Sum> {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType new_value, std::optional<AggregateType> current_aggregate) {
-      // add new value to sum
-      return new_value + (!current_aggregate ? 0 : *current_aggregate);
-    };
+template <typename ColumnType>
+struct AggregateState<ColumnType, AggregateFunction::Max> {
+  void update(const ColumnType& new_value) {
+    if (!has_value || value_greater(new_value, max)) {
+      max = new_value;
+      has_value = true;
+    }
   }
-};
 
-template <typename ColumnType, typename AggregateType>
-struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Avg> {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType new_value, std::optional<AggregateType> current_aggregate) {
-      // add new value to sum
-      return new_value + (!current_aggregate ? 0 : *current_aggregate);
-    };
+  void update_run(const ColumnType& new_value, size_t) { update(new_value); }
+
+  void merge(AggregateState& other) {
+    if (other.has_value && (!has_value || value_greater(other.max, max))) {
+      max = std::move(other.max);
+      has_value = true;
+    }
   }
+
+  bool is_null() const { return !has_value; }
+  const ColumnType& value() const { return max; }
+
+  ColumnType max{};
+  bool has_value = false;
 };
 
-template <typename ColumnType, typename AggregateType>
-struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Count> {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType, std::optional<AggregateType> current_aggregate) { return std::nullopt; };
+template <typename ColumnType>
+struct AggregateState<ColumnType, AggregateFunction::Sum, std::enable_if_t<std::is_arithmetic_v<ColumnType>>> {
+  using AggregateType = typename AggregateTraits<ColumnType, AggregateFunction::Sum>::aggregate_type;
+
+  void update(const ColumnType& new_value) {
+    sum += new_value;
+    has_value = true;
   }
-};
 
-template <typename ColumnType, typename AggregateType>
-struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::CountDistinct> {
-  AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType, std::optional<AggregateType> current_aggregate) { return std::nullopt; };
+  void update_run(const ColumnType& new_value, const size_t run_length) {
+    sum += static_cast<AggregateType>(new_value) * static_cast<AggregateType>(run_length);
+    has_value = true;
   }
+
+  void merge(const AggregateState& other) {
+    sum += other.sum;
+    has_value |= other.has_value;
+  }
+
+  bool is_null() const { return !has_value; }
+  AggregateType value() const { return sum; }
+
+  AggregateType sum{};
+  bool has_value = false;
 };
 
-template <typename ColumnDataType, AggregateFunction function>
-void Aggregate::_aggregate_column(ChunkID chunk_id, ColumnID column_index, const BaseColumn& base_column) {
-  using AggregateType = typename AggregateTraits<ColumnDataType, function>::aggregate_type;
+template <typename ColumnType>
+struct AggregateState<ColumnType, AggregateFunction::Avg, std::enable_if_t<std::is_arithmetic_v<ColumnType>>> {
+  using AggregateType = typename AggregateTraits<ColumnType, AggregateFunction::Avg>::aggregate_type;
+
+  void update(const ColumnType& new_value) {
+    sum += new_value;
+    ++count;
+  }
 
-  auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
+  void update_run(const ColumnType& new_value, const size_t run_length) {
+    sum += static_cast<AggregateType>(new_value) * static_cast<AggregateType>(run_length);
+    count += run_length;
+  }
 
-  // create context if it doesn't exist yet
-  if (!_contexts_per_column[column_index]) {
-    _contexts_per_column[column_index] = std::make_shared<AggregateContext<ColumnDataType, AggregateType>>();
+  // AVG keeps the sum and the count, so that the averages of several morsels can be combined
+  void merge(const AggregateState& other) {
+    sum += other.sum;
+    count += other.count;
   }
 
-  auto& context =
-      *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType>>(_contexts_per_column[column_index]);
+  bool is_null() const { return count == 0; }
+  AggregateType value() const { return sum / static_cast<AggregateType>(count); }
 
-  if (!context.results) {
-    context.results = std::make_shared<std::map<AggregateKey, AggregateResult<AggregateType, ColumnDataType>>>();
+  AggregateType sum{};
+  size_t count = 0;
+};
+
+template <typename ColumnType>
+struct AggregateState<ColumnType, AggregateFunction::Count> {
+  void update(const ColumnType&) { ++count; }
+  void update_run(const ColumnType&, const size_t run_length) { count += run_length; }
+  void merge(const AggregateState& other) { count += other.count; }
+  bool is_null() const { return false; }
+  int64_t value() const { return static_cast<int64_t>(count); }
+
+  size_t count = 0;
+};
+
+/*
+COUNT(DISTINCT) collects the values of a group in a vector instead of a tree, and removes the duplicates in bulk by
+finalize(): once per morsel at the end of Aggregate::_aggregate_column, and once per partition after all morsels were
+merged. merge() only appends, so that a group that spans many morsels is not merged over and over again.
+*/
+template <typename ColumnType>
+struct AggregateState<ColumnType, AggregateFunction::CountDistinct> {
+  void update(const ColumnType& new_value) { distinct_values.push_back(new_value); }
+  void update_run(const ColumnType& new_value, size_t) { update(new_value); }
+
+  void merge(AggregateState& other) {
+    distinct_values.insert(distinct_values.end(), std::make_move_iterator(other.distinct_values.begin()),
+                           std::make_move_iterator(other.distinct_values.end()));
+    other.distinct_values.clear();
   }
 
-  auto& results = *context.results;
-  auto& hash_keys = _keys_per_chunk[chunk_id];
+  void finalize() {
+    if (!std::is_sorted(distinct_values.cbegin(), distinct_values.cend())) {
+      std::sort(distinct_values.begin(), distinct_values.end());
+    }
+    distinct_values.erase(std::unique(distinct_values.begin(), distinct_values.end()), distinct_values.end());
+  }
 
-  resolve_column_type<ColumnDataType>(base_column, [&results, &hash_keys, aggregator](const auto& typed_column) {
-    auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+  bool is_null() const { return false; }
+  int64_t value() const { return static_cast<int64_t>(distinct_values.size()); }
 
-    ChunkOffset chunk_offset{0};
+  std::vector<ColumnType> distinct_values;
+};
 
-    // Now that all relevant types have been resolved, we can iterate over the column and build the aggregations.
-    iterable.for_each([&, aggregator](const auto& value) {
-      if (value.is_null()) {
-        /**
-         * If the value is NULL, the current aggregate value does not change.
-         * However, if we do not have a result entry for the current hash key, i.e., group value,
-         * we need to insert an empty AggregateResult into the results.
-         * Hence, the try_emplace with no constructing arguments.
-         */
-        results.try_emplace((*hash_keys)[chunk_offset]);
-      } else {
-        // If we have a value, use the aggregator lambda to update the current aggregate value for this group
-        results[(*hash_keys)[chunk_offset]].current_aggregate =
-            aggregator(value.value(), results[(*hash_keys)[chunk_offset]].current_aggregate);
+/*
+Aggregate states of one aggregate column, indexed by group id. The contexts of MorselGroups are indexed by the
+morsel-local group ids, the contexts of the Aggregate by the ids of the output groups.
+*/
+template <typename ColumnType, AggregateFunction function>
+struct AggregateContext : ColumnVisitableContext {
+  std::vector<AggregateState<ColumnType, function>> states;
+};
 
-        // increase value counter
-        ++results[(*hash_keys)[chunk_offset]].aggregate_count;
+// NULL values of the group-by columns are marked by one bit each in the words following the packed values
+bool group_key_is_null(const uint64_t* key, const size_t groupby_column_count, const size_t groupby_index) {
+  return key[groupby_column_count + groupby_index / 64u] & (uint64_t{1u} << (groupby_index % 64u));
+}
 
-        if (function == AggregateFunction::CountDistinct) {
-          // for the case of CountDistinct, insert this value into the set to keep track of distinct values
-          results[(*hash_keys)[chunk_offset]].distinct_values.insert(value.value());
-        }
-      }
+// Results with fewer groups are not partitioned, larger ones are split into at most 2^MAX_RADIX_BITS partitions
+constexpr size_t MIN_GROUPS_PER_PARTITION = 4096;
+constexpr size_t MAX_RADIX_BITS = 6;
 
-      ++chunk_offset;
-    });
-  });
+constexpr uint64_t INVALID_STRING_ID = std::numeric_limits<uint64_t>::max();
+constexpr uint32_t INVALID_GROUP_ID = std::numeric_limits<uint32_t>::max();
+
+// Chunks whose group-by columns are all dictionary-encoded are grouped through a dense array of group ids if the
+// product of the dictionary sizes (plus one for NULL each) does not exceed this
+constexpr size_t MAX_DENSE_GROUP_COUNT = 65536;
+
+// COUNT(DISTINCT) on a dictionary-encoded chunk marks the seen ValueIDs of each group in a bitmap of at most this size
+constexpr size_t MAX_DISTINCT_BITMAP_SIZE = size_t{1u} << 22u;
+
+size_t Aggregate::_key_width() const {
+  return _groupby_column_ids.size() + (_groupby_column_ids.size() + 63u) / 64u;
 }
 
-std::shared_ptr<const Table> Aggregate::_on_execute() {
-  auto input_table = _input_table_left();
+/*
+Assigns morsel-local group ids to the rows of a morsel. The values of the group-by columns of a row are packed into its
+key column by column. Numbers are packed by pack_group_key(). Strings are numbered in the order in which they appear
+in the morsel, and these morsel-local ids are packed instead.
+*/
+void Aggregate::_group_morsel(const size_t morsel_id, const Morsel& morsel) {
+  const auto input_table = _input_table_left();
+  const auto row_count = morsel.row_count();
+  const auto key_width = _key_width();
 
-  // check for invalid aggregates
-  for (const auto& aggregate : _aggregates) {
-    if (aggregate.column_id == CountStarID) {
-      if (aggregate.function != AggregateFunction::Count) {
-        Fail("Aggregate: Asterisk is only valid with COUNT");
-      }
-    } else if (input_table->column_type(aggregate.column_id) == DataType::String &&
-               (aggregate.function == AggregateFunction::Sum || aggregate.function == AggregateFunction::Avg)) {
-      Fail("Aggregate: Cannot calculate SUM or AVG on string column");
-    }
-  }
+  auto& morsel_groups = _groups_per_morsel[morsel_id];
+  morsel_groups.strings_per_column.resize(_groupby_column_ids.size());
 
-  /*
-  PARTITIONING PHASE
-  First we partition the input chunks by the given group key(s).
-  This is done by creating a vector that contains the AggregateKey for each row.
-  It is gradually built by visitors, one for each group column.
-  */
-  _keys_per_chunk = std::vector<std::shared_ptr<std::vector<AggregateKey>>>(input_table->chunk_count());
+  auto keys = std::vector<uint64_t>(row_count * key_width);
 
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(input_table->chunk_count());
+  // As long as all group-by columns are dictionary-encoded and their dictionaries are small, the ValueIDs of a row are
+  // combined into an index into a dense array of group ids, so that the keys do not need to be hashed row by row.
+  // This requires a single dictionary per column, i.e., a morsel that consists of one whole chunk.
+  auto use_dense_group_ids = true;
+  auto dense_group_count = size_t{1u};
+  auto dense_indexes = std::vector<uint32_t>(row_count);
+
+  // String columns that are dictionary-encoded use their ValueIDs as string ids (see below)
+  auto string_dictionaries = std::vector<std::shared_ptr<const StringDictionary>>(_groupby_column_ids.size());
+
+  for (auto groupby_index = size_t{0}; groupby_index < _groupby_column_ids.size(); ++groupby_index) {
+    const auto column_id = _groupby_column_ids[groupby_index];
+
+    // NULL values are packed as 0 and marked in the null words (see group_key_is_null)
+    const auto null_word = _groupby_column_ids.size() + groupby_index / 64u;
+    const auto null_bit = uint64_t{1u} << (groupby_index % 64u);
+
+    const auto column_type = input_table->column_type(column_id);
+
+    // The keys are filled row by row across the ranges of the morsel, and so are the string ids
+    auto* key = keys.data();
+    auto string_ids = std::unordered_map<std::string, uint64_t>{};
+
+    for (const auto& range : morsel.ranges) {
+      const auto base_column = range.column(input_table, column_id);
+
+      resolve_data_and_column_type(column_type, *base_column, [&](auto type, auto& typed_column) {
+        using ColumnDataType = typename decltype(type)::type;
+        using ColumnType = std::decay_t<decltype(typed_column)>;
+
+        if constexpr (std::is_same_v<ColumnType, DictionaryColumn<ColumnDataType>>) {
+          if (morsel.ranges.size() == 1u) {
+            const auto& attribute_vector = *typed_column.attribute_vector();
+            const auto& dictionary = *typed_column.dictionary();
 
-  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
-    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, this]() {
-      const Chunk& chunk_in = input_table->get_chunk(chunk_id);
+            // The key words are looked up by ValueID, so that each dictionary entry is packed only once
+            auto words = std::vector<uint64_t>(dictionary.size());
+            if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+              std::iota(words.begin(), words.end(), uint64_t{0u});
+              string_dictionaries[groupby_index] = typed_column.dictionary();
+              morsel_groups.strings_per_column[groupby_index].resize(dictionary.size());
+            } else {
+              std::transform(dictionary.cbegin(), dictionary.cend(), words.begin(),
+                             [](const auto& value) { return pack_group_key(value); });
+            }
+
+            const auto dense_stride = dense_group_count;
+            dense_group_count *= dictionary.size() + 1u;
+            use_dense_group_ids &= dense_group_count <= MAX_DENSE_GROUP_COUNT;
+
+            // NULL is the last index of each column
+            const auto null_index = static_cast<uint32_t>(dictionary.size());
+
+            for (ChunkOffset chunk_offset{0}; chunk_offset < range.size(); ++chunk_offset, key += key_width) {
+              const auto value_id = attribute_vector.get(chunk_offset);
+
+              if (value_id == NULL_VALUE_ID) {
+                key[null_word] |= null_bit;
+                if (use_dense_group_ids) dense_indexes[chunk_offset] += null_index * dense_stride;
+              } else {
+                key[groupby_index] = words[value_id];
+                if (use_dense_group_ids) dense_indexes[chunk_offset] += value_id * dense_stride;
+              }
+            }
+            return;
+          }
+        }
 
-      auto hash_keys = std::make_shared<std::vector<AggregateKey>>(chunk_in.size());
+        use_dense_group_ids = false;
 
-      // Partition by group columns
-      for (const auto column_id : _groupby_column_ids) {
-        auto base_column = chunk_in.get_column(column_id);
-        auto column_type = input_table->column_type(column_id);
+        // The keys are filled row by row, because the iterables of ReferenceColumns do not know the offsets of NULL
+        // rows
+        auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
 
-        resolve_data_and_column_type(column_type, *base_column, [&](auto type, auto& typed_column) {
-          using ColumnDataType = typename decltype(type)::type;
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          auto& strings = morsel_groups.strings_per_column[groupby_index];
 
-          auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+          iterable.for_each([&](const auto& value) {
+            if (value.is_null()) {
+              key[null_word] |= null_bit;
+            } else {
+              const auto [string_id, inserted] = string_ids.try_emplace(value.value(), strings.size());
+              if (inserted) strings.emplace_back(value.value());
+              key[groupby_index] = string_id->second;
+            }
 
-          ChunkOffset chunk_offset{0};
+            key += key_width;
+          });
+        } else {
           iterable.for_each([&](const auto& value) {
             if (value.is_null()) {
-              (*hash_keys)[chunk_offset].emplace_back(NULL_VALUE);
+              key[null_word] |= null_bit;
             } else {
-              (*hash_keys)[chunk_offset].emplace_back(value.value());
+              key[groupby_index] = pack_group_key(value.value());
             }
 
-            ++chunk_offset;
+            key += key_width;
           });
-        });
-      }
+        }
+      });
+    }
+  }
 
-      _keys_per_chunk[chunk_id] = hash_keys;
-    }));
-    jobs.back()->schedule();
+  auto& key_table = morsel_groups.key_table;
+  key_table = std::make_shared<GroupKeyTable>(key_width);
+  morsel_groups.group_ids.resize(row_count);
+  if (use_dense_group_ids) {
+    // Only the first row of each group is looked up in the key table
+    auto dense_group_ids = std::vector<uint32_t>(dense_group_count, INVALID_GROUP_ID);
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      auto& group_id = dense_group_ids[dense_indexes[row]];
+      if (group_id == INVALID_GROUP_ID) group_id = key_table->get_or_insert(keys.data() + row * key_width);
+      morsel_groups.group_ids[row] = group_id;
+    }
+  } else {
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      morsel_groups.group_ids[row] = key_table->get_or_insert(keys.data() + row * key_width);
+    }
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  // The strings of dictionary-encoded columns are only copied for the ValueIDs that occur in a group
+  for (auto groupby_index = size_t{0}; groupby_index < _groupby_column_ids.size(); ++groupby_index) {
+    const auto& dictionary = string_dictionaries[groupby_index];
+    if (!dictionary) continue;
+
+    auto& strings = morsel_groups.strings_per_column[groupby_index];
+    auto is_copied = std::vector<bool>(strings.size());
+    for (auto group_id = uint32_t{0}; group_id < key_table->group_count(); ++group_id) {
+      const auto* key = key_table->key(group_id);
+      if (group_key_is_null(key, _groupby_column_ids.size(), groupby_index)) continue;
+
+      const auto value_id = key[groupby_index];
+      if (is_copied[value_id]) continue;
+      strings[value_id] = (*dictionary)[ValueID{static_cast<ValueID::base_type>(value_id)}];
+      is_copied[value_id] = true;
+    }
+  }
 
-  /*
-  AGGREGATION PHASE
-  */
-  _contexts_per_column = std::vector<std::shared_ptr<ColumnVisitableContext>>(_aggregates.size());
-
-  if (_aggregates.empty()) {
-    /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
-
-    We choose int8_t for column type and aggregate type because it's small.
-    */
-    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType>>();
-    context->results =
-        std::make_shared<std::map<AggregateKey, AggregateResult<DistinctAggregateType, DistinctColumnType>>>();
-
-    _contexts_per_column.push_back(context);
-  }
-
-  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
-    const Chunk& chunk_in = input_table->get_chunk(chunk_id);
-
-    auto hash_keys = _keys_per_chunk[chunk_id];
-
-    if (_aggregates.empty()) {
-      /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
-       *
-       * For a query like "SELECT DISTINCT * FROM A;"
-       * we would assume that all columns from A are part of 'groupby_columns',
-       * respectively any columns that were specified in the projection.
-       * The optimizer is responsible to take care of passing in the correct columns.
-       *
-       * How does this operation work?
-       * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
-       * these vectors are used as keys in the 'column_results' map.
-       *
-       * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
-       * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
-       * One could optimize here in the future.
-       *
-       * Obviously this implementation is also used for plain GroupBy's.
-       */
-
-      auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType>>(
-          _contexts_per_column[0]);
-      auto& results = *context->results;
-      for (auto& chunk : _keys_per_chunk) {
-        for (auto& keys : *chunk) {
-          // insert dummy value to make sure we have the key in our map
-          results[keys] = AggregateResult<DistinctAggregateType, DistinctColumnType>();
-        }
+  // The partitions are chosen by hashes of the values, because the morsel-local string ids differ between morsels
+  morsel_groups.group_hashes.resize(key_table->group_count());
+  for (auto group_id = uint32_t{0}; group_id < key_table->group_count(); ++group_id) {
+    const auto* key = key_table->key(group_id);
+
+    auto hash = uint64_t{0};
+    for (auto groupby_index = size_t{0}; groupby_index < _groupby_column_ids.size(); ++groupby_index) {
+      const auto& strings = morsel_groups.strings_per_column[groupby_index];
+      const auto is_string = !strings.empty() && !group_key_is_null(key, _groupby_column_ids.size(), groupby_index);
+
+      const auto word = is_string ? std::hash<std::string>{}(strings[key[groupby_index]]) : key[groupby_index];
+      hash = GroupKeyTable::combine_hash(hash, word);
+    }
+    morsel_groups.group_hashes[group_id] = hash;
+  }
+}
+
+template <typename ColumnDataType, AggregateFunction function>
+void Aggregate::_aggregate_column(const size_t morsel_id, const Morsel& morsel, const ColumnID column_index) {
+  auto& morsel_groups = _groups_per_morsel[morsel_id];
+  const auto& group_ids = morsel_groups.group_ids;
+
+  auto context = std::make_shared<AggregateContext<ColumnDataType, function>>();
+  context->states.resize(morsel_groups.key_table->group_count());
+  morsel_groups.contexts_per_column[column_index] = context;
+
+  auto& states = context->states;
+
+  /**
+   * Special COUNT(*) implementation.
+   * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
+   * We then basically go through the group ids and count the occurrences of each group.
+   */
+  const auto column_id = _aggregates[column_index].column_id;
+  if (column_id == CountStarID) {
+    if constexpr (function == AggregateFunction::Count) {
+      for (const auto group_id : group_ids) {
+        ++states[group_id].count;
       }
     } else {
-      ColumnID column_index{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then basically go through the _keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-        if (aggregate.column_id == CountStarID && aggregate.function == AggregateFunction::Count) {
-          // We know the template arguments, so we don't need a visitor
-          if (!_contexts_per_column[column_index]) {
-            _contexts_per_column[column_index] =
-                std::make_shared<AggregateContext<CountColumnType, CountAggregateType>>();
-          }
+      Fail("Aggregate: Asterisk is only valid with COUNT");
+    }
+    return;
+  }
 
-          auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType>>(
-              _contexts_per_column[column_index]);
+  const auto input_table = _input_table_left();
 
-          if (!context->results) {
-            // create result map for the first time if necessary
-            context->results =
-                std::make_shared<std::map<AggregateKey, AggregateResult<CountAggregateType, CountColumnType>>>();
-          }
+  // Index of the current row within the morsel, which continues across its ranges
+  auto row = size_t{0};
 
-          auto& results = *context->results;
+  for (const auto& range : morsel.ranges) {
+    // Run-length encoded columns are aggregated run by run: each run updates a group once for every stretch of
+    // consecutive rows of that group. Parts of a chunk are handled here as well, instead of through a ReferenceColumn.
+    const auto chunk_column = input_table->get_chunk(range.chunk_id).get_column(column_id);
+    if (const auto run_length_column = std::dynamic_pointer_cast<const RunLengthColumn<ColumnDataType>>(chunk_column)) {
+      const auto& values = *run_length_column->values();
+      const auto& null_values = *run_length_column->null_values();
+      const auto& end_positions = *run_length_column->end_positions();
 
-          // count occurrences for each group key
-          for (const auto& hash_key : *hash_keys) {
-            ++results[hash_key].aggregate_count;
-          }
+      auto chunk_offset = range.begin;
+      for (auto run_index = BaseRunLengthColumn::run_index(end_positions, range.begin); chunk_offset < range.end;
+           ++run_index) {
+        const auto run_end = std::min(static_cast<ChunkOffset>(end_positions[run_index] + 1u), range.end);
 
-          ++column_index;
+        if (null_values[run_index]) {
+          row += run_end - chunk_offset;
+          chunk_offset = run_end;
           continue;
         }
 
-        auto base_column = chunk_in.get_column(aggregate.column_id);
-        auto data_type = input_table->column_type(aggregate.column_id);
-
-        /*
-        Invoke correct aggregator for each column
-        */
-
-        resolve_data_type(data_type, [&, this, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
-
-          switch (aggregate.function) {
-            case AggregateFunction::Min:
-              _aggregate_column<ColumnDataType, AggregateFunction::Min>(chunk_id, column_index, *base_column);
-              break;
-            case AggregateFunction::Max:
-              _aggregate_column<ColumnDataType, AggregateFunction::Max>(chunk_id, column_index, *base_column);
-              break;
-            case AggregateFunction::Sum:
-              _aggregate_column<ColumnDataType, AggregateFunction::Sum>(chunk_id, column_index, *base_column);
-              break;
-            case AggregateFunction::Avg:
-              _aggregate_column<ColumnDataType, AggregateFunction::Avg>(chunk_id, column_index, *base_column);
-              break;
-            case AggregateFunction::Count:
-              _aggregate_column<ColumnDataType, AggregateFunction::Count>(chunk_id, column_index, *base_column);
-              break;
-            case AggregateFunction::CountDistinct:
-              _aggregate_column<ColumnDataType, AggregateFunction::CountDistinct>(chunk_id, column_index, *base_column);
-              break;
+        while (chunk_offset < run_end) {
+          const auto group_id = group_ids[row];
+          auto run_length = size_t{0};
+          for (; chunk_offset < run_end && group_ids[row] == group_id; ++chunk_offset, ++row) ++run_length;
+
+          states[group_id].update_run(values[run_index], run_length);
+        }
+      }
+      continue;
+    }
+
+    const auto base_column = range.column(input_table, column_id);
+
+    resolve_column_type<ColumnDataType>(*base_column, [&](const auto& typed_column) {
+      using ColumnType = std::decay_t<decltype(typed_column)>;
+
+      if constexpr (function == AggregateFunction::CountDistinct &&
+                    std::is_same_v<ColumnType, DictionaryColumn<ColumnDataType>>) {
+        if (morsel.ranges.size() == 1u) {
+          // Each distinct ValueID of a group is translated into a value only once. The ValueIDs of a group are
+          // translated in ascending order, so that the values of each group are already sorted for finalize().
+          const auto& attribute_vector = *typed_column.attribute_vector();
+          const auto& dictionary = *typed_column.dictionary();
+          const auto dictionary_size = dictionary.size();
+
+          if (states.size() * dictionary_size <= MAX_DISTINCT_BITMAP_SIZE) {
+            auto seen = std::vector<bool>(states.size() * dictionary_size);
+            for (ChunkOffset chunk_offset{0}; chunk_offset < attribute_vector.size(); ++chunk_offset) {
+              const auto value_id = attribute_vector.get(chunk_offset);
+              if (value_id == NULL_VALUE_ID) continue;
+
+              seen[group_ids[chunk_offset] * dictionary_size + value_id] = true;
+            }
+
+            for (auto group_id = size_t{0}; group_id < states.size(); ++group_id) {
+              for (auto value_id = size_t{0}; value_id < dictionary_size; ++value_id) {
+                if (seen[group_id * dictionary_size + value_id]) {
+                  states[group_id].update(dictionary[ValueID{static_cast<ValueID::base_type>(value_id)}]);
+                }
+              }
+            }
+          } else {
+            // Too many groups and values for a bitmap, so the (group, ValueID) pairs are deduplicated by sorting
+            auto pairs = std::vector<uint64_t>{};
+            pairs.reserve(attribute_vector.size());
+            for (ChunkOffset chunk_offset{0}; chunk_offset < attribute_vector.size(); ++chunk_offset) {
+              const auto value_id = attribute_vector.get(chunk_offset);
+              if (value_id == NULL_VALUE_ID) continue;
+              pairs.push_back(uint64_t{group_ids[chunk_offset]} << 32u | value_id);
+            }
+
+            std::sort(pairs.begin(), pairs.end());
+            pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+            for (const auto pair : pairs) {
+              states[pair >> 32u].update(dictionary[ValueID{static_cast<ValueID::base_type>(pair)}]);
+            }
           }
+          return;
+        }
+      }
+
+      auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+
+      if (states.size() == 1u) {
+        // Without groups, the state is kept in a local variable, so that a loop over a column without NULL values is
+        // a plain reduction that the compiler can keep in registers and vectorize
+        auto state = std::move(states.front());
+        iterable.for_each([&](const auto& value) {
+          if (!value.is_null()) state.update(value.value());
         });
+        states.front() = std::move(state);
+        return;
+      }
+
+      // Now that all relevant types have been resolved, we can iterate over the column and build the aggregations.
+      iterable.for_each([&](const auto& value) {
+        // If the value is NULL, the state of the group does not change
+        if (!value.is_null()) states[group_ids[row]].update(value.value());
+        ++row;
+      });
+    });
+  }
+
+  // Each morsel passes on every distinct value of a group only once, so that the merge does not grow with the rows
+  if constexpr (function == AggregateFunction::CountDistinct) {
+    for (auto& state : states) state.finalize();
+  }
+}
+
+template <typename ColumnDataType, AggregateFunction function>
+void Aggregate::_merge_aggregate_column(MorselGroups& morsel_groups, const ColumnID column_index,
+                                        const std::vector<uint32_t>& morsel_group_ids,
+                                        const std::vector<uint32_t>& group_ids, AggregateGroups& groups) {
+  using Context = AggregateContext<ColumnDataType, function>;
+
+  auto& morsel_states = static_cast<Context&>(*morsel_groups.contexts_per_column[column_index]).states;
+
+  auto& context = groups.contexts_per_column[column_index];
+  if (!context) context = std::make_shared<Context>();
+
+  auto& states = static_cast<Context&>(*context).states;
+  states.resize(groups.key_table->group_count());
+
+  for (auto index = size_t{0}; index < morsel_group_ids.size(); ++index) {
+    states[group_ids[index]].merge(morsel_states[morsel_group_ids[index]]);
+  }
+}
+
+/*
+Merges the morsel-local groups of one partition into the output groups of that partition. Since the morsel-local
+string ids differ between the morsels, they are replaced by ids of the partition first. Each morsel-local group belongs
+to exactly one partition, so that the partitions can be merged in parallel.
+*/
+void Aggregate::_merge_partition(const size_t partition_id) {
+  const auto input_table = _input_table_left();
+  const auto key_width = _key_width();
+
+  auto& partition = _partitions[partition_id];
+  partition.key_table = std::make_shared<GroupKeyTable>(key_width);
+  partition.strings_per_column.resize(_groupby_column_ids.size());
+  partition.contexts_per_column.resize(_aggregates.size());
+
+  auto string_ids_per_column = std::vector<std::unordered_map<std::string, uint64_t>>(_groupby_column_ids.size());
+
+  auto key = std::vector<uint64_t>(key_width);
+
+  for (auto& morsel_groups : _groups_per_morsel) {
+    if (morsel_groups.groups_per_partition.empty()) continue;
 
-        ++column_index;
+    const auto& morsel_group_ids = morsel_groups.groups_per_partition[partition_id];
+    if (morsel_group_ids.empty()) continue;
+
+    // Partition ids of the morsel-local string ids, translated when they are used for the first time
+    auto translated_string_ids = std::vector<std::vector<uint64_t>>(_groupby_column_ids.size());
+    for (auto groupby_index = size_t{0}; groupby_index < _groupby_column_ids.size(); ++groupby_index) {
+      translated_string_ids[groupby_index].resize(morsel_groups.strings_per_column[groupby_index].size(),
+                                                  INVALID_STRING_ID);
+    }
+
+    auto group_ids = std::vector<uint32_t>(morsel_group_ids.size());
+    for (auto index = size_t{0}; index < morsel_group_ids.size(); ++index) {
+      const auto* morsel_key = morsel_groups.key_table->key(morsel_group_ids[index]);
+      std::copy(morsel_key, morsel_key + key_width, key.begin());
+
+      for (auto groupby_index = size_t{0}; groupby_index < _groupby_column_ids.size(); ++groupby_index) {
+        if (translated_string_ids[groupby_index].empty() ||
+            group_key_is_null(key.data(), _groupby_column_ids.size(), groupby_index)) {
+          continue;
+        }
+
+        auto& string_id = translated_string_ids[groupby_index][key[groupby_index]];
+        if (string_id == INVALID_STRING_ID) {
+          auto& strings = partition.strings_per_column[groupby_index];
+          const auto& string = morsel_groups.strings_per_column[groupby_index][key[groupby_index]];
+
+          const auto [partition_string_id, inserted] =
+              string_ids_per_column[groupby_index].try_emplace(string, strings.size());
+          if (inserted) strings.emplace_back(string);
+          string_id = partition_string_id->second;
+        }
+        key[groupby_index] = string_id;
       }
+
+      group_ids[index] = partition.key_table->get_or_insert(key.data());
     }
-  }
 
-  // Write the output
-  _output = std::make_shared<Table>();
+    for (ColumnID column_index{0}; column_index < _aggregates.size(); ++column_index) {
+      const auto& aggregate = _aggregates[column_index];
+      const auto data_type =
+          (aggregate.column_id == CountStarID) ? DataType::Int : input_table->column_type(aggregate.column_id);
 
-  // add group by columns
-  for (const auto column_id : _groupby_column_ids) {
-    const auto& column_type = input_table->column_type(column_id);
-    const auto& column_name = input_table->column_name(column_id);
+      resolve_aggregate_function(data_type, aggregate.function, [&](auto type, auto function) {
+        using ColumnDataType = typename decltype(type)::type;
+        _merge_aggregate_column<ColumnDataType, decltype(function)::value>(morsel_groups, column_index,
+                                                                           morsel_group_ids, group_ids, partition);
+      });
+    }
+  }
+
+  // The values of COUNT(DISTINCT) were only appended by the merge, so the duplicates between morsels are removed now
+  for (ColumnID column_index{0}; column_index < _aggregates.size(); ++column_index) {
+    const auto& aggregate = _aggregates[column_index];
+    const auto& context = partition.contexts_per_column[column_index];
+    if (aggregate.function != AggregateFunction::CountDistinct || !context) continue;
 
-    _output->add_column_definition(column_name, column_type, true);
+    resolve_data_type(input_table->column_type(aggregate.column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      using Context = AggregateContext<ColumnDataType, AggregateFunction::CountDistinct>;
 
-    _groupby_columns.emplace_back(make_shared_by_data_type<BaseColumn, ValueColumn>(column_type, true));
-    _out_chunk.add_column(_groupby_columns.back());
+      for (auto& state : static_cast<Context&>(*context).states) state.finalize();
+    });
   }
+}
 
-  /**
-   * Write group-by columns.
-   *
-   * 'results_per_column' always contains at least one element, since there are either GroupBy or Aggregate columns.
-   * However, we need to look only at the first element, because the keys for all columns are the same.
-   *
-   * The following loop is used for both, actual GroupBy columns and DISTINCT columns.
-   **/
-  if (_aggregates.empty()) {
-    auto context =
-        std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType>>(_contexts_per_column[0]);
-    for (auto& map : *context->results) {
-      for (size_t group_column_index = 0; group_column_index < map.first.size(); ++group_column_index) {
-        _groupby_columns[group_column_index]->append(map.first[group_column_index]);
+std::shared_ptr<const Table> Aggregate::_on_execute() {
+  auto input_table = _input_table_left();
+
+  // check for invalid aggregates
+  for (const auto& aggregate : _aggregates) {
+    if (aggregate.column_id == CountStarID) {
+      if (aggregate.function != AggregateFunction::Count) {
+        Fail("Aggregate: Asterisk is only valid with COUNT");
       }
+    } else if (input_table->column_type(aggregate.column_id) == DataType::String &&
+               (aggregate.function == AggregateFunction::Sum || aggregate.function == AggregateFunction::Avg)) {
+      Fail("Aggregate: Cannot calculate SUM or AVG on string column");
     }
   }
 
   /*
-  Write the aggregated columns to the output
+  PRE-AGGREGATION PHASE
+  Each morsel is grouped and aggregated independently, with morsel-local group ids and aggregate results.
   */
-  ColumnID column_index{0};
-  for (const auto& aggregate : _aggregates) {
-    auto column_id = aggregate.column_id;
+  auto dispatcher = MorselDispatcher{*input_table};
+  _groups_per_morsel = std::vector<MorselGroups>(dispatcher.morsels().size());
 
-    // Output column for COUNT(*). int is chosen arbitrarily.
-    const auto data_type = (column_id == CountStarID) ? DataType::Int : input_table->column_type(column_id);
+  dispatcher.process([&](const size_t morsel_id, const Morsel& morsel) {
+    _group_morsel(morsel_id, morsel);
+
+    _groups_per_morsel[morsel_id].contexts_per_column.resize(_aggregates.size());
+
+    for (ColumnID column_index{0}; column_index < _aggregates.size(); ++column_index) {
+      const auto& aggregate = _aggregates[column_index];
+
+      // Output column for COUNT(*). int is chosen arbitrarily.
+      const auto data_type =
+          (aggregate.column_id == CountStarID) ? DataType::Int : input_table->column_type(aggregate.column_id);
 
-    resolve_data_type(
-        data_type, [&, column_index](auto type) { _write_aggregate_output(type, column_index, aggregate.function); });
+      resolve_aggregate_function(data_type, aggregate.function, [&](auto type, auto function) {
+        using ColumnDataType = typename decltype(type)::type;
+        _aggregate_column<ColumnDataType, decltype(function)::value>(morsel_id, morsel, column_index);
+      });
+    }
+  });
 
-    ++column_index;
+  /*
+  PARTITIONING PHASE
+  The morsel-local groups are radix partitioned by the hashes of their values, so that equal groups of different
+  morsels end up in the same partition. Small results are not partitioned, because each partition costs a task and an
+  output chunk.
+  */
+  auto morsel_group_count = size_t{0};
+  for (const auto& morsel_groups : _groups_per_morsel) {
+    if (morsel_groups.key_table) morsel_group_count += morsel_groups.key_table->group_count();
   }
 
-  _output->emplace_chunk(std::move(_out_chunk));
+  auto radix_bits = size_t{0};
+  while ((morsel_group_count >> radix_bits) > MIN_GROUPS_PER_PARTITION && radix_bits < MAX_RADIX_BITS) {
+    ++radix_bits;
+  }
+  const auto partition_count = size_t{1} << radix_bits;
 
-  return _output;
-}
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (auto& morsel_groups : _groups_per_morsel) {
+    if (!morsel_groups.key_table) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&morsel_groups, radix_bits, partition_count]() {
+      morsel_groups.groups_per_partition.resize(partition_count);
+      for (auto group_id = uint32_t{0}; group_id < morsel_groups.group_hashes.size(); ++group_id) {
+        const auto partition_id = radix_bits == 0 ? 0 : morsel_groups.group_hashes[group_id] >> (64u - radix_bits);
+        morsel_groups.groups_per_partition[partition_id].emplace_back(group_id);
+      }
+    }));
+    jobs.back()->schedule();
+  }
 
-/*
-The following template functions write the aggregated values for the different aggregate functions.
-They are separate and templated to avoid compiler errors for invalid type/function combinations.
-*/
-// MIN, MAX, SUM write the current aggregated value
-template <typename ColumnType, typename AggregateType, AggregateFunction func>
-typename std::enable_if<
-    func == AggregateFunction::Min || func == AggregateFunction::Max || func == AggregateFunction::Sum, void>::type
-_write_aggregate_values(std::shared_ptr<ValueColumn<AggregateType>> column,
-                        std::shared_ptr<std::map<AggregateKey, AggregateResult<AggregateType, ColumnType>>> results) {
-  DebugAssert(column->is_nullable(), "Aggregate: Output column needs to be nullable");
-
-  auto& values = column->values();
-  auto& null_values = column->null_values();
-
-  for (auto& kv : *results) {
-    null_values.push_back(!kv.second.current_aggregate);
-
-    if (!kv.second.current_aggregate) {
-      values.push_back(AggregateType());
-    } else {
-      values.push_back(*kv.second.current_aggregate);
-    }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  /*
+  MERGE PHASE
+  Each partition is merged and written into its own output chunk by its own task.
+
+  In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation. For a query like
+  "SELECT DISTINCT * FROM A;" we would assume that all columns from A are part of 'groupby_columns', respectively any
+  columns that were specified in the projection. The optimizer is responsible to take care of passing in the correct
+  columns. Obviously this implementation is also used for plain GroupBy's.
+  */
+  _output = std::make_shared<Table>();
+
+  for (const auto column_id : _groupby_column_ids) {
+    _output->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id), true);
   }
-}
 
-// COUNT writes the aggregate counter
-template <typename ColumnType, typename AggregateType, AggregateFunction func>
-typename std::enable_if<func == AggregateFunction::Count, void>::type _write_aggregate_values(
-    std::shared_ptr<ValueColumn<AggregateType>> column,
-    std::shared_ptr<std::map<AggregateKey, AggregateResult<AggregateType, ColumnType>>> results) {
-  DebugAssert(!column->is_nullable(), "Aggregate: Output column for COUNT shouldn't be nullable");
+  for (ColumnID column_index{0}; column_index < _aggregates.size(); ++column_index) {
+    const auto& aggregate = _aggregates[column_index];
 
-  auto& values = column->values();
+    // Output column for COUNT(*). int is chosen arbitrarily.
+    const auto data_type =
+        (aggregate.column_id == CountStarID) ? DataType::Int : input_table->column_type(aggregate.column_id);
 
-  for (auto& kv : *results) {
-    values.push_back(kv.second.aggregate_count);
+    resolve_aggregate_function(data_type, aggregate.function, [&](auto type, auto function) {
+      using ColumnDataType = typename decltype(type)::type;
+      _add_aggregate_column_definition<ColumnDataType, decltype(function)::value>(column_index);
+    });
   }
-}
 
-// COUNT(DISTINCT) writes the number of distinct values
-template <typename ColumnType, typename AggregateType, AggregateFunction func>
-typename std::enable_if<func == AggregateFunction::CountDistinct, void>::type _write_aggregate_values(
-    std::shared_ptr<ValueColumn<AggregateType>> column,
-    std::shared_ptr<std::map<AggregateKey, AggregateResult<AggregateType, ColumnType>>> results) {
-  DebugAssert(!column->is_nullable(), "Aggregate: Output column for COUNT shouldn't be nullable");
+  _partitions = std::vector<AggregateGroups>(partition_count);
+  auto output_chunks = std::vector<Chunk>(partition_count);
 
-  auto& values = column->values();
+  jobs.clear();
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      _merge_partition(partition_id);
+      output_chunks[partition_id] = _write_groups(_partitions[partition_id]);
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
 
-  for (auto& kv : *results) {
-    values.push_back(kv.second.distinct_values.size());
+  for (auto& output_chunk : output_chunks) {
+    if (output_chunk.size() > 0) _output->emplace_chunk(std::move(output_chunk));
   }
+
+  // Without any groups, the output still needs a chunk with the output columns
+  if (_output->row_count() == 0) _output->emplace_chunk(std::move(output_chunks.front()));
+
+  _groups_per_morsel.clear();
+  _partitions.clear();
+
+  return _output;
 }
 
-// AVG writes the calculated average from current aggregate and the aggregate counter
-template <typename ColumnType, typename AggregateType, AggregateFunction func>
-typename std::enable_if<func == AggregateFunction::Avg && std::is_arithmetic<AggregateType>::value, void>::type
-_write_aggregate_values(std::shared_ptr<ValueColumn<AggregateType>> column,
-                        std::shared_ptr<std::map<AggregateKey, AggregateResult<AggregateType, ColumnType>>> results) {
-  DebugAssert(column->is_nullable(), "Aggregate: Output column needs to be nullable");
+// Writes the group-by columns by unpacking the keys of the groups, followed by the aggregate columns
+Chunk Aggregate::_write_groups(const AggregateGroups& groups) const {
+  const auto input_table = _input_table_left();
 
-  auto& values = column->values();
-  auto& null_values = column->null_values();
+  Chunk chunk;
 
-  for (auto& kv : *results) {
-    null_values.push_back(!kv.second.current_aggregate);
+  for (auto groupby_index = size_t{0}; groupby_index < _groupby_column_ids.size(); ++groupby_index) {
+    resolve_data_type(input_table->column_type(_groupby_column_ids[groupby_index]), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
 
-    if (!kv.second.current_aggregate) {
-      values.push_back(AggregateType());
-    } else {
-      values.push_back(*kv.second.current_aggregate / static_cast<AggregateType>(kv.second.aggregate_count));
-    }
+      auto column = std::make_shared<ValueColumn<ColumnDataType>>(true);
+      auto& values = column->values();
+      auto& null_values = column->null_values();
+
+      for (auto group_id = uint32_t{0}; group_id < groups.key_table->group_count(); ++group_id) {
+        const auto* key = groups.key_table->key(group_id);
+        const auto is_null = group_key_is_null(key, _groupby_column_ids.size(), groupby_index);
+
+        null_values.push_back(is_null);
+        if (is_null) {
+          values.push_back(ColumnDataType{});
+        } else if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          values.push_back(groups.strings_per_column[groupby_index][key[groupby_index]]);
+        } else {
+          values.push_back(unpack_group_key<ColumnDataType>(key[groupby_index]));
+        }
+      }
+
+      chunk.add_column(column);
+    });
   }
-}
 
-// AVG is not defined for non-arithmetic types. Avoiding compiler errors.
-template <typename ColumnType, typename AggregateType, AggregateFunction func>
-typename std::enable_if<func == AggregateFunction::Avg && !std::is_arithmetic<AggregateType>::value, void>::type
-    _write_aggregate_values(std::shared_ptr<ValueColumn<AggregateType>>,
-                            std::shared_ptr<std::map<AggregateKey, AggregateResult<AggregateType, ColumnType>>>) {
-  Fail("Invalid aggregate");
-}
+  for (ColumnID column_index{0}; column_index < _aggregates.size(); ++column_index) {
+    const auto& aggregate = _aggregates[column_index];
 
-template <typename ColumnType>
-void Aggregate::_write_aggregate_output(boost::hana::basic_type<ColumnType> type, ColumnID column_index,
-                                        AggregateFunction function) {
-  switch (function) {
-    case AggregateFunction::Min:
-      write_aggregate_output<ColumnType, AggregateFunction::Min>(column_index);
-      break;
-    case AggregateFunction::Max:
-      write_aggregate_output<ColumnType, AggregateFunction::Max>(column_index);
-      break;
-    case AggregateFunction::Sum:
-      write_aggregate_output<ColumnType, AggregateFunction::Sum>(column_index);
-      break;
-    case AggregateFunction::Avg:
-      write_aggregate_output<ColumnType, AggregateFunction::Avg>(column_index);
-      break;
-    case AggregateFunction::Count:
-      write_aggregate_output<ColumnType, AggregateFunction::Count>(column_index);
-      break;
-    case AggregateFunction::CountDistinct:
-      write_aggregate_output<ColumnType, AggregateFunction::CountDistinct>(column_index);
-      break;
+    // Output column for COUNT(*). int is chosen arbitrarily.
+    const auto data_type =
+        (aggregate.column_id == CountStarID) ? DataType::Int : input_table->column_type(aggregate.column_id);
+
+    resolve_aggregate_function(data_type, aggregate.function, [&](auto type, auto function) {
+      using ColumnDataType = typename decltype(type)::type;
+      write_aggregate_output<ColumnDataType, decltype(function)::value>(column_index, groups, chunk);
+    });
   }
+
+  return chunk;
 }
 
 template <typename ColumnType, AggregateFunction function>
-void Aggregate::write_aggregate_output(ColumnID column_index) {
-  // retrieve type information from the aggregation traits
-  typename AggregateTraits<ColumnType, function>::aggregate_type aggregate_type;
+void Aggregate::_add_aggregate_column_definition(ColumnID column_index) {
   auto aggregate_data_type = AggregateTraits<ColumnType, function>::aggregate_data_type;
 
   const auto& aggregate = _aggregates[column_index];
@@ -674,24 +1000,35 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
 
   constexpr bool needs_null = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct);
   _output->add_column_definition(output_column_name, aggregate_data_type, needs_null);
+}
+
+template <typename ColumnType, AggregateFunction function>
+void Aggregate::write_aggregate_output(ColumnID column_index, const AggregateGroups& groups, Chunk& chunk) const {
+  // retrieve type information from the aggregation traits
+  using AggregateType = typename AggregateTraits<ColumnType, function>::aggregate_type;
 
-  auto col = std::make_shared<ValueColumn<decltype(aggregate_type)>>(needs_null);
+  constexpr bool needs_null = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct);
+  auto col = std::make_shared<ValueColumn<AggregateType>>(needs_null);
 
-  auto context = std::static_pointer_cast<AggregateContext<ColumnType, decltype(aggregate_type)>>(
-      _contexts_per_column[column_index]);
+  // the context does not exist if there are no groups
+  auto context =
+      std::static_pointer_cast<AggregateContext<ColumnType, function>>(groups.contexts_per_column[column_index]);
+  if (!context) context = std::make_shared<AggregateContext<ColumnType, function>>();
 
-  // write all group keys into the respective columns
-  if (column_index == 0) {
-    for (auto& map : *context->results) {
-      for (size_t group_column_index = 0; group_column_index < map.first.size(); ++group_column_index) {
-        _groupby_columns[group_column_index]->append(map.first[group_column_index]);
+  // write aggregated values into the column
+  auto& values = col->values();
+  for (const auto& state : context->states) {
+    if constexpr (needs_null) {
+      col->null_values().push_back(state.is_null());
+      if (state.is_null()) {
+        values.push_back(AggregateType{});
+        continue;
       }
     }
+    values.push_back(state.value());
   }
 
-  // write aggregated values into the column
-  _write_aggregate_values<ColumnType, decltype(aggregate_type), function>(col, context->results);
-  _out_chunk.add_column(col);
+  chunk.add_column(col);
 }
 
 }  // namespace opossum
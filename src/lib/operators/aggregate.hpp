@@ -2,16 +2,15 @@
 
 #include <functional>
 #include <limits>
-#include <map>
 #include <memory>
 #include <optional>
-#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "storage/base_attribute_vector.hpp"
 #include "storage/column_visitable.hpp"
 #include "storage/dictionary_column.hpp"
@@ -19,11 +18,10 @@
 #include "storage/value_column.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/group_key_table.hpp"
 
 namespace opossum {
 
-struct GroupByContext;
-
 /*
 Operator to aggregate columns by certain functions, such as min, max, sum, average, and count. The output is a table
  with reference columns. As with most operators we do not guarantee a stable operation with regards to positions -
@@ -33,20 +31,33 @@ For implementation details, please check the wiki: https://github.com/hyrise/hyr
 */
 
 /*
-Current aggregated value and the number of rows that were used.
-The latter is used for AVG and COUNT.
+Groups and their aggregate results. The values of the group-by columns of each group are packed into a key of 64 bit
+words (see Aggregate::_group_morsel), whose position in the key_table is the id of the group.
 */
-template <typename AggregateType, typename ColumnDataType>
-struct AggregateResult {
-  std::optional<AggregateType> current_aggregate;
-  size_t aggregate_count = 0;
-  std::set<ColumnDataType> distinct_values;
+struct AggregateGroups {
+  std::shared_ptr<GroupKeyTable> key_table;
+
+  // Strings of the group-by columns, indexed by the ids stored in the keys (empty for other types)
+  std::vector<std::vector<std::string>> strings_per_column;
+
+  // Aggregate results per aggregate column, indexed by group id
+  std::vector<std::shared_ptr<ColumnVisitableContext>> contexts_per_column;
 };
 
 /*
-The key type that is used for the aggregation map.
+The groups of one morsel of the input (see MorselDispatcher). They are pre-aggregated within the morsel and merged
+into the output partitions later.
 */
-using AggregateKey = std::vector<AllTypeVariant>;
+struct MorselGroups : AggregateGroups {
+  // Morsel-local group id of each row
+  std::vector<uint32_t> group_ids;
+
+  // Hash of the values of each group (not of the morsel-local string ids), which determines its output partition
+  std::vector<uint64_t> group_hashes;
+
+  // Morsel-local group ids per output partition
+  std::vector<std::vector<uint32_t>> groups_per_partition;
+};
 
 // ColumnID representing the '*' when using COUNT(*)
 constexpr ColumnID CountStarID{std::numeric_limits<ColumnID::base_type>::max()};
@@ -87,39 +98,41 @@ class Aggregate : public AbstractReadOnlyOperator {
   const std::string name() const override;
   std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args) const override;
 
-  // write the aggregated output for a given aggregate column
+  // write the aggregated output of the given groups for a given aggregate column
   template <typename ColumnType, AggregateFunction function>
-  void write_aggregate_output(ColumnID column_index);
+  void write_aggregate_output(ColumnID column_index, const AggregateGroups& groups, Chunk& chunk) const;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
-  template <typename ColumnType>
-  static void _create_aggregate_context(boost::hana::basic_type<ColumnType> type,
-                                        std::shared_ptr<ColumnVisitableContext>& aggregate_context,
-                                        AggregateFunction function);
+  void _group_morsel(size_t morsel_id, const Morsel& morsel);
 
-  template <typename ColumnType>
-  static void _create_aggregate_visitor(boost::hana::basic_type<ColumnType> type,
-                                        std::shared_ptr<ColumnVisitable>& builder,
-                                        std::shared_ptr<ColumnVisitableContext> context,
-                                        std::shared_ptr<GroupByContext> groupby_context, AggregateFunction function);
+  void _merge_partition(size_t partition_id);
 
-  template <typename ColumnType>
-  void _write_aggregate_output(boost::hana::basic_type<ColumnType> type, ColumnID column_index,
-                               AggregateFunction function);
+  template <typename ColumnDataType, AggregateFunction function>
+  void _aggregate_column(size_t morsel_id, const Morsel& morsel, ColumnID column_index);
 
   template <typename ColumnDataType, AggregateFunction function>
-  void _aggregate_column(ChunkID chunk_id, ColumnID column_index, const BaseColumn& base_column);
+  void _merge_aggregate_column(MorselGroups& morsel_groups, ColumnID column_index,
+                               const std::vector<uint32_t>& morsel_group_ids, const std::vector<uint32_t>& group_ids,
+                               AggregateGroups& groups);
+
+  template <typename ColumnType, AggregateFunction function>
+  void _add_aggregate_column_definition(ColumnID column_index);
+
+  Chunk _write_groups(const AggregateGroups& groups) const;
+
+  // Group-by columns followed by one word per 64 group-by columns that marks NULL values
+  size_t _key_width() const;
 
   const std::vector<AggregateDefinition> _aggregates;
   const std::vector<ColumnID> _groupby_column_ids;
 
   std::shared_ptr<Table> _output;
-  Chunk _out_chunk;
-  std::vector<std::shared_ptr<BaseColumn>> _groupby_columns;
-  std::vector<std::shared_ptr<ColumnVisitableContext>> _contexts_per_column;
-  std::vector<std::shared_ptr<std::vector<AggregateKey>>> _keys_per_chunk;
+  std::vector<MorselGroups> _groups_per_morsel;
+
+  // The output groups, partitioned by the hashes of their values. Each partition has its own string ids.
+  std::vector<AggregateGroups> _partitions;
 };
 
 }  // namespace opossum
@@ -36,11 +36,14 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
 
     for (const auto& row_id : *pos_list) {
       auto& referenced_chunk = _table->get_chunk(row_id.chunk_id);
+      auto mvcc_columns = referenced_chunk.mvcc_columns();
+
+      // Has to be visible before the lock, so that Validate does not treat the chunk as completely visible anymore
+      mvcc_columns->has_deletions = true;
 
       auto expected = 0u;
       // Actual row lock for delete happens here
-      const auto success =
-          referenced_chunk.mvcc_columns()->tids[row_id.chunk_offset].compare_exchange_strong(expected, _transaction_id);
+      const auto success = mvcc_columns->tids[row_id.chunk_offset].compare_exchange_strong(expected, _transaction_id);
 
       // the row is already locked and the transaction needs to be rolled back
       if (!success) {
@@ -7,8 +7,11 @@
 #include <vector>
 
 #include "import_export/binary.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
 #include "storage/fitted_attribute_vector.hpp"
+#include "storage/iterables/attribute_vector_iterable.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/string_dictionary.hpp"
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
@@ -77,6 +80,25 @@ void _export_values(std::ofstream& ofstream, const std::vector<bool>& values) {
   const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
   _export_values(ofstream, writable_bools);
 }
+template <>
+void _export_values(std::ofstream& ofstream, const opossum::pmr_vector<bool>& values) {
+  // Cast to fixed-size format used in binary file
+  const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
+  _export_values(ofstream, writable_bools);
+}
+
+// Writes a StringDictionary in the same layout as a vector of strings. Its character buffer is written as is.
+void _export_values(std::ofstream& ofstream, const opossum::StringDictionary& values) {
+  const auto& offsets = values.offsets();
+
+  std::vector<opossum::StringLength> string_lengths(values.size());
+  for (auto index = size_t{0u}; index < values.size(); ++index) {
+    string_lengths[index] = static_cast<opossum::StringLength>(offsets[index + 1u] - offsets[index]);
+  }
+
+  _export_values(ofstream, string_lengths);
+  _export_values(ofstream, values.characters());
+}
 
 template <typename T>
 void _export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<T>& values) {
@@ -228,7 +250,7 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_dictionary_column(
   const auto& column = static_cast<const DictionaryColumn<T>&>(base_column);
 
   _export_value(context->ofstream, BinaryColumnType::dictionary_column);
-  _export_value(context->ofstream, static_cast<const AttributeVectorWidth>(column.attribute_vector()->width()));
+  _export_value(context->ofstream, _serialized_width(*column.attribute_vector()));
 
   // Write the dictionary size and dictionary
   _export_value(context->ofstream, static_cast<ValueID>(column.unique_values_count()));
@@ -237,21 +259,83 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_dictionary_column(
   _export_attribute_vector(context->ofstream, *column.attribute_vector());
 }
 
+template <typename T>
+void ExportBinary::ExportBinaryVisitor<T>::handle_run_length_column(
+    const BaseRunLengthColumn& base_column, std::shared_ptr<ColumnVisitableContext> base_context) {
+  auto context = std::static_pointer_cast<ExportContext>(base_context);
+  const auto& column = static_cast<const RunLengthColumn<T>&>(base_column);
+
+  _export_value(context->ofstream, BinaryColumnType::run_length_column);
+
+  // Write the number of runs and the runs themselves
+  _export_value(context->ofstream, static_cast<ChunkOffset>(column.run_count()));
+  _export_values(context->ofstream, *column.values());
+  _export_values(context->ofstream, *column.null_values());
+  _export_values(context->ofstream, *column.end_positions());
+}
+
+template <typename T>
+void ExportBinary::ExportBinaryVisitor<T>::handle_frame_of_reference_column(
+    const BaseFrameOfReferenceColumn& base_column, std::shared_ptr<ColumnVisitableContext> base_context) {
+  if constexpr (supports_frame_of_reference_encoding_v<T>) {
+    auto context = std::static_pointer_cast<ExportContext>(base_context);
+    const auto& column = static_cast<const FrameOfReferenceColumn<T>&>(base_column);
+
+    _export_value(context->ofstream, BinaryColumnType::frame_of_reference_column);
+    _export_value(context->ofstream, column.offsets()->bit_width());
+
+    _export_values(context->ofstream, *column.minima());
+    _export_values(context->ofstream, *column.maxima());
+    _export_values(context->ofstream, column.offsets()->data());
+  } else {
+    Fail("Frame-of-reference encoding is only supported for integer columns.");
+  }
+}
+
+template <typename T>
+AttributeVectorWidth ExportBinary::ExportBinaryVisitor<T>::_serialized_width(
+    const BaseAttributeVector& attribute_vector) {
+  // Bit-packed attribute vectors can have a width of 3 bytes, which is written like 4 bytes
+  const auto width = attribute_vector.width();
+  if (width <= 1) return 1;
+  if (width <= 2) return 2;
+  return 4;
+}
+
 template <typename T>
 void ExportBinary::ExportBinaryVisitor<T>::_export_attribute_vector(std::ofstream& ofstream,
                                                                     const BaseAttributeVector& attribute_vector) {
-  switch (attribute_vector.width()) {
+  switch (_serialized_width(attribute_vector)) {
     case 1:
-      _export_values(ofstream, dynamic_cast<const FittedAttributeVector<uint8_t>&>(attribute_vector).attributes());
+      _export_attribute_vector_values<uint8_t>(ofstream, attribute_vector);
       break;
     case 2:
-      _export_values(ofstream, dynamic_cast<const FittedAttributeVector<uint16_t>&>(attribute_vector).attributes());
+      _export_attribute_vector_values<uint16_t>(ofstream, attribute_vector);
       break;
-    case 4:
     default:
-      _export_values(ofstream, dynamic_cast<const FittedAttributeVector<uint32_t>&>(attribute_vector).attributes());
+      _export_attribute_vector_values<uint32_t>(ofstream, attribute_vector);
       break;
   }
 }
 
+template <typename T>
+template <typename uintX_t>
+void ExportBinary::ExportBinaryVisitor<T>::_export_attribute_vector_values(
+    std::ofstream& ofstream, const BaseAttributeVector& attribute_vector) {
+  if (const auto fitted_attribute_vector = dynamic_cast<const FittedAttributeVector<uintX_t>*>(&attribute_vector)) {
+    _export_values(ofstream, fitted_attribute_vector->attributes());
+    return;
+  }
+
+  // Attribute vectors with other layouts (e.g., bit-packed ones) are decoded and stored like a FittedAttributeVector
+  // of the same width. NULL_VALUE_ID is truncated to max(uintX_t), which is the null value of FittedAttributeVector.
+  auto values = std::vector<uintX_t>{};
+  values.reserve(attribute_vector.size());
+
+  auto iterable = AttributeVectorIterable{attribute_vector};
+  iterable.for_each([&](const auto& value) { values.push_back(static_cast<uintX_t>(value.value())); });
+
+  _export_values(ofstream, values);
+}
+
 }  // namespace opossum
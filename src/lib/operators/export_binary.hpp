@@ -8,7 +8,9 @@
 #include "import_export/binary.hpp"
 #include "storage/column_visitable.hpp"
 #include "storage/dictionary_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/run_length_column.hpp"
 #include "storage/value_column.hpp"
 #include "utils/assert.hpp"
 
@@ -144,6 +146,8 @@ class ExportBinary::ExportBinaryVisitor : public ColumnVisitable {
    *
    * Please note that the number of rows are written in the header of the chunk.
    * The type of the column can be found in the global header of the file.
+   * Bit-packed attribute vectors are written with the width of the smallest FittedAttributeVector that holds their
+   * ValueIDs, i.e., 1, 2, or 4 bytes.
    *
    * ^: These fields are only written if the type of the column IS a string.
    * °: This field is writen if the type of the column is NOT a string
@@ -154,8 +158,61 @@ class ExportBinary::ExportBinaryVisitor : public ColumnVisitable {
   void handle_dictionary_column(const BaseDictionaryColumn& base_column,
                                 std::shared_ptr<ColumnVisitableContext> base_context) override;
 
+  /**
+   * Run-length encoded Columns are dumped with the following layout:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Number of runs        | ChunkOffset                           |   4
+   * Run Values°           | T (int, float, double, long)          |   runs * sizeof(T)
+   * Run String Length^    | StringLength                          |   runs * 2
+   * Run Values^           | std::string                           |   Sum of all string lengths
+   * Run Null Values       | vector<bool> (BoolAsByteType)         |   runs * 1
+   * Run End Positions     | ChunkOffset                           |   runs * 4
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   *
+   * ^: These fields are only written if the type of the column IS a string.
+   * °: This field is writen if the type of the column is NOT a string
+   *
+   * @param base_column The Column to export
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   */
+  void handle_run_length_column(const BaseRunLengthColumn& base_column,
+                                std::shared_ptr<ColumnVisitableContext> base_context) override;
+
+  /**
+   * Frame-of-reference encoded Columns are dumped with the following layout:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Bit width of offsets  | uint8_t                               |   1
+   * Frame Minima          | T (int, long)                         |   frames * sizeof(T)
+   * Frame Maxima          | T (int, long)                         |   frames * sizeof(T)
+   * Packed Offsets        | uint32_t                              |   words * 4
+   *
+   * Please note that the number of rows are written in the header of the chunk. The number of frames and the number
+   * of packed words are derived from it (see BaseFrameOfReferenceColumn and BitPackedAttributeVector).
+   * The type of the column can be found in the global header of the file.
+   *
+   * @param base_column The Column to export
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   */
+  void handle_frame_of_reference_column(const BaseFrameOfReferenceColumn& base_column,
+                                        std::shared_ptr<ColumnVisitableContext> base_context) override;
+
  private:
-  // Chooses the right FittedAttributeVector depending on the attribute_vector_width and exports it.
+  // Returns the width in which the attribute vector is written, i.e., 1, 2, or 4 bytes as supported by ImportBinary
+  static AttributeVectorWidth _serialized_width(const BaseAttributeVector& attribute_vector);
+
+  // Chooses the right FittedAttributeVector depending on the serialized width and exports it.
   static void _export_attribute_vector(std::ofstream& ofstream, const BaseAttributeVector& attribute_vector);
+
+  // Writes the ValueIDs of an attribute vector in the layout of a FittedAttributeVector<uintX_t>
+  template <typename uintX_t>
+  static void _export_attribute_vector_values(std::ofstream& ofstream, const BaseAttributeVector& attribute_vector);
 };
 }  // namespace opossum
@@ -10,7 +10,9 @@
 #include "json.hpp"
 #include "storage/base_attribute_vector.hpp"
 #include "storage/dictionary_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/run_length_column.hpp"
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
@@ -121,6 +123,38 @@ class ExportCsv::ExportCsvVisitor : public ColumnVisitable {
 
     context->csv_writer.write((*column.dictionary())[(column.attribute_vector()->get(context->current_row))]);
   }
+
+  void handle_run_length_column(const BaseRunLengthColumn& base_column,
+                                std::shared_ptr<ColumnVisitableContext> base_context) final {
+    auto context = std::static_pointer_cast<ExportCsv::ExportCsvContext>(base_context);
+    const auto& column = static_cast<const RunLengthColumn<T>&>(base_column);
+
+    const auto run_index = column.run_index(context->current_row);
+
+    if ((*column.null_values())[run_index]) {
+      // Write an empty field for a null value
+      context->csv_writer.write("");
+    } else {
+      context->csv_writer.write((*column.values())[run_index]);
+    }
+  }
+
+  void handle_frame_of_reference_column(const BaseFrameOfReferenceColumn& base_column,
+                                        std::shared_ptr<ColumnVisitableContext> base_context) final {
+    if constexpr (supports_frame_of_reference_encoding_v<T>) {
+      auto context = std::static_pointer_cast<ExportCsv::ExportCsvContext>(base_context);
+      const auto& column = static_cast<const FrameOfReferenceColumn<T>&>(base_column);
+
+      if (column.is_null(context->current_row)) {
+        // Write an empty field for a null value
+        context->csv_writer.write("");
+      } else {
+        context->csv_writer.write(column.get(context->current_row));
+      }
+    } else {
+      Fail("Frame-of-reference encoding is only supported for integer columns.");
+    }
+  }
 };
 
 }  // namespace opossum
@@ -14,6 +14,7 @@
 #include "constant_mappings.hpp"
 #include "import_export/binary.hpp"
 #include "resolve_type.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
 #include "storage/chunk.hpp"
 #include "storage/fitted_attribute_vector.hpp"
 #include "storage/storage_manager.hpp"
@@ -64,6 +65,26 @@ pmr_vector<std::string> ImportBinary::_read_string_values(std::ifstream& file, c
   return values;
 }
 
+template <typename T>
+dictionary_t<T> ImportBinary::_read_dictionary(std::ifstream& file, const size_t count) {
+  return _read_values<T>(file, count);
+}
+
+// specialized implementation for string values, which avoids creating a std::string per value
+template <>
+dictionary_t<std::string> ImportBinary::_read_dictionary<std::string>(std::ifstream& file, const size_t count) {
+  const auto string_lengths = _read_values<StringLength>(file, count);
+
+  pmr_vector<uint32_t> offsets(count + 1u);
+  offsets[0] = 0u;
+  for (auto index = size_t{0u}; index < count; ++index) {
+    offsets[index + 1u] = offsets[index] + string_lengths[index];
+  }
+
+  auto characters = _read_values<char>(file, offsets.back());
+  return StringDictionary{std::move(characters), std::move(offsets)};
+}
+
 template <typename T>
 T ImportBinary::_read_value(std::ifstream& file) {
   T result;
@@ -148,6 +169,10 @@ std::shared_ptr<BaseColumn> ImportBinary::_import_column(std::ifstream& file, Ch
       return _import_value_column<ColumnDataType>(file, row_count, is_nullable);
     case BinaryColumnType::dictionary_column:
       return _import_dictionary_column<ColumnDataType>(file, row_count);
+    case BinaryColumnType::run_length_column:
+      return _import_run_length_column<ColumnDataType>(file);
+    case BinaryColumnType::frame_of_reference_column:
+      return _import_frame_of_reference_column<ColumnDataType>(file, row_count);
     default:
       // This case happens if the read column type is not a valid BinaryColumnType.
       Fail("Cannot import column: invalid column type");
@@ -191,9 +216,39 @@ std::shared_ptr<DictionaryColumn<T>> ImportBinary::_import_dictionary_column(std
                                                                              ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
-  auto dictionary = _read_values<T>(file, dictionary_size);
+  auto dictionary = std::make_shared<dictionary_t<T>>(_read_dictionary<T>(file, dictionary_size));
   auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width);
-  return std::make_shared<DictionaryColumn<T>>(std::move(dictionary), std::move(attribute_vector));
+  return std::make_shared<DictionaryColumn<T>>(dictionary, std::move(attribute_vector));
+}
+
+template <typename T>
+std::shared_ptr<RunLengthColumn<T>> ImportBinary::_import_run_length_column(std::ifstream& file) {
+  const auto run_count = _read_value<ChunkOffset>(file);
+  auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(file, run_count));
+  auto null_values = std::make_shared<pmr_vector<bool>>(_read_values<bool>(file, run_count));
+  auto end_positions = std::make_shared<pmr_vector<ChunkOffset>>(_read_values<ChunkOffset>(file, run_count));
+  return std::make_shared<RunLengthColumn<T>>(values, null_values, end_positions);
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> ImportBinary::_import_frame_of_reference_column(std::ifstream& file,
+                                                                            ChunkOffset row_count) {
+  if constexpr (supports_frame_of_reference_encoding_v<T>) {
+    const auto bit_width = _read_value<uint8_t>(file);
+    const auto frame_count = (row_count + BaseFrameOfReferenceColumn::frame_size - 1u) /
+                             BaseFrameOfReferenceColumn::frame_size;
+    const auto block_count = (row_count + BitPackedAttributeVector::block_size - 1u) /
+                             BitPackedAttributeVector::block_size;
+
+    auto minima = std::make_shared<pmr_vector<T>>(_read_values<T>(file, frame_count));
+    auto maxima = std::make_shared<pmr_vector<T>>(_read_values<T>(file, frame_count));
+    auto data = _read_values<uint32_t>(file, block_count * BitPackedAttributeVector::lane_count * bit_width);
+    auto offsets = std::make_shared<BitPackedAttributeVector>(std::move(data), row_count, bit_width);
+    return std::make_shared<FrameOfReferenceColumn<T>>(minima, maxima, offsets);
+  } else {
+    Fail("Cannot import column: frame-of-reference encoding is only supported for integer columns");
+    return {};
+  }
 }
 
 }  // namespace opossum
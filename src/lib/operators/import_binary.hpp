@@ -13,6 +13,7 @@
 #include "storage/column_visitable.hpp"
 #include "storage/dictionary_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/run_length_column.hpp"
 #include "storage/value_column.hpp"
 #include "utils/assert.hpp"
 
@@ -135,6 +136,39 @@ class ImportBinary : public AbstractReadOnlyOperator {
   template <typename T>
   static std::shared_ptr<DictionaryColumn<T>> _import_dictionary_column(std::ifstream& file, ChunkOffset row_count);
 
+  /*
+   * Imports a serialized RunLengthColumn from the given file.
+   * The file must contain data in the following format:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Number of runs        | ChunkOffset                           |   4
+   * Run Values°           | T (int, float, double, long)          |   runs * sizeof(T)
+   * Run String Length^    | StringLength                          |   runs * 2
+   * Run Values^           | std::string                           |   Sum of all string lengths
+   * Run Null Values       | bool (stored as BoolAsByteType)       |   runs * 1
+   * Run End Positions     | ChunkOffset                           |   runs * 4
+   *
+   * ^: These fields are only needed if the type of the column is a string.
+   * °: This field is needed if the type of the column is NOT a string
+   */
+  template <typename T>
+  static std::shared_ptr<RunLengthColumn<T>> _import_run_length_column(std::ifstream& file);
+
+  /*
+   * Imports a serialized FrameOfReferenceColumn from the given file.
+   * The file must contain data in the following format:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Bit width of offsets  | uint8_t                               |   1
+   * Frame Minima          | T (int, long)                         |   frames * sizeof(T)
+   * Frame Maxima          | T (int, long)                         |   frames * sizeof(T)
+   * Packed Offsets        | uint32_t                              |   words * 4
+   */
+  template <typename T>
+  static std::shared_ptr<BaseColumn> _import_frame_of_reference_column(std::ifstream& file, ChunkOffset row_count);
+
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
   static std::shared_ptr<BaseAttributeVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
                                                                        AttributeVectorWidth attribute_vector_width);
@@ -147,6 +181,10 @@ class ImportBinary : public AbstractReadOnlyOperator {
   template <typename T = StringLength>
   static pmr_vector<std::string> _read_string_values(std::ifstream& file, const size_t count);
 
+  // Reads count many values from type T into a dictionary. Strings are read directly into a StringDictionary.
+  template <typename T>
+  static dictionary_t<T> _read_dictionary(std::ifstream& file, const size_t count);
+
   // Reads a single value of type T from the input file.
   template <typename T>
   static T _read_value(std::ifstream& file);
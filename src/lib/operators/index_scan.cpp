@@ -8,6 +8,7 @@
 
 #include "storage/index/base_index.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/zone_map.hpp"
 
 #include "utils/assert.hpp"
 
@@ -42,17 +43,29 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
   if (_included_chunk_ids.empty()) {
     jobs.reserve(_in_table->chunk_count());
     for (auto chunk_id = ChunkID{0u}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
+      if (_can_prune_chunk(chunk_id)) continue;
       jobs.push_back(_create_job_and_schedule(chunk_id, output_mutex));
     }
   } else {
     jobs.reserve(_included_chunk_ids.size());
     for (auto chunk_id : _included_chunk_ids) {
+      if (_can_prune_chunk(chunk_id)) continue;
       jobs.push_back(_create_job_and_schedule(chunk_id, output_mutex));
     }
   }
 
   CurrentScheduler::wait_for_tasks(jobs);
 
+  // If all chunks were pruned, the output still needs a chunk that defines its columns
+  if (jobs.empty()) {
+    const auto empty_pos_list = std::make_shared<PosList>();
+    auto chunk_out = Chunk{};
+    for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+      chunk_out.add_column(std::make_shared<ReferenceColumn>(_in_table, column_id, empty_pos_list));
+    }
+    _out_table->emplace_chunk(std::move(chunk_out));
+  }
+
   return _out_table;
 }
 
@@ -93,6 +106,21 @@ void IndexScan::_validate_input() {
   Assert(_in_table->get_type() == TableType::Data, "IndexScan only supports persistent tables right now.");
 }
 
+bool IndexScan::_can_prune_chunk(const ChunkID chunk_id) const {
+  // Zone maps only cover single columns. Also, they treat NULL as IS NULL, which the index scan does not support.
+  // Since the input is a data table (see _validate_input()), its chunks have their own zone maps.
+  if (_left_column_ids.size() != 1u || variant_is_null(_right_values.front())) return false;
+
+  const auto zone_maps = _in_table->get_chunk(chunk_id).zone_maps();
+  if (!zone_maps) return false;
+
+  const auto& zone_map = *zone_maps->columns[_left_column_ids.front()];
+  if (_scan_type == ScanType::OpBetween) {
+    return zone_map.can_prune(_scan_type, _right_values.front(), _right_values2.front());
+  }
+  return zone_map.can_prune(_scan_type, _right_values.front());
+}
+
 PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
 
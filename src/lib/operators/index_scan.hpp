@@ -35,6 +35,7 @@ class IndexScan : public AbstractReadOnlyOperator {
   std::shared_ptr<const Table> _on_execute() final;
 
   void _validate_input();
+  bool _can_prune_chunk(const ChunkID chunk_id) const;
   std::shared_ptr<JobTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
   PosList _scan_chunk(const ChunkID chunk_id);
 
@@ -1,8 +1,15 @@
 #include "join_hash.hpp"
 
+#include <algorithm>
+#include <deque>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -10,22 +17,26 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "storage/column_visitable.hpp"
 #include "storage/dictionary_column.hpp"
+#include "storage/iterables/attribute_vector_decoders.hpp"
 #include "storage/iterables/create_iterable_from_column.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/value_column.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
-#include "utils/cuckoo_hashtable.hpp"
+#include "utils/bloom_filter.hpp"
+#include "utils/flat_hash_table.hpp"
 #include "utils/murmur_hash.hpp"
 
 namespace opossum {
 
 JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator> left,
                    const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
-                   const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
-    : AbstractJoinOperator(left, right, mode, column_ids, scan_type) {
+                   const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type,
+                   const std::optional<size_t>& radix_bits)
+    : AbstractJoinOperator(left, right, mode, column_ids, scan_type), _radix_bits(radix_bits) {
   DebugAssert(scan_type == ScanType::OpEquals, "Operator not supported by Hash Join.");
 }
 
@@ -33,7 +44,7 @@ const std::string JoinHash::name() const { return "JoinHash"; }
 
 std::shared_ptr<AbstractOperator> JoinHash::recreate(const std::vector<AllParameterVariant>& args) const {
   return std::make_shared<JoinHash>(_input_left->recreate(args), _input_right->recreate(args), _mode, _column_ids,
-                                    _scan_type);
+                                    _scan_type, _radix_bits);
 }
 
 std::shared_ptr<const Table> JoinHash::_on_execute() {
@@ -73,7 +84,7 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
   _impl = make_unique_by_data_types<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
       build_input->column_type(build_column_id), probe_input->column_type(probe_column_id), build_operator,
-      probe_operator, _mode, adjusted_column_ids, _scan_type, inputs_swapped);
+      probe_operator, _mode, adjusted_column_ids, _scan_type, inputs_swapped, _radix_bits);
   return _impl->_on_execute();
 }
 
@@ -82,20 +93,64 @@ void JoinHash::_on_cleanup() { _impl.reset(); }
 // currently using 32bit Murmur
 using Hash = uint32_t;
 
+// Strings are joined as views into the input columns (see JoinHashImpl::_materialize_strings)
+template <typename T>
+using JoinKey = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+namespace {
+
+/*
+Gives access to the strings of a column without copying them, if the column is a ValueColumn or a DictionaryColumn.
+Strings of other encodings are copied into owned_strings, which has to outlive the returned views.
+*/
+class StringViewAccessor {
+ public:
+  explicit StringViewAccessor(const BaseColumn& column)
+      : _column(column),
+        _value_column(dynamic_cast<const ValueColumn<std::string>*>(&column)),
+        _dictionary_column(dynamic_cast<const DictionaryColumn<std::string>*>(&column)) {}
+
+  // Returns std::nullopt for NULL values
+  std::optional<std::string_view> get(const ChunkOffset chunk_offset, std::deque<std::string>& owned_strings) const {
+    if (_value_column) {
+      if (_value_column->is_nullable() && _value_column->null_values()[chunk_offset]) return std::nullopt;
+      return std::string_view{_value_column->values()[chunk_offset]};
+    }
+
+    if (_dictionary_column) {
+      const auto value_id = _dictionary_column->attribute_vector()->get(chunk_offset);
+      if (value_id == NULL_VALUE_ID) return std::nullopt;
+      return _dictionary_column->dictionary()->view(value_id);
+    }
+
+    const auto value = _column[chunk_offset];
+    if (variant_is_null(value)) return std::nullopt;
+    return std::string_view{owned_strings.emplace_back(type_cast<std::string>(value))};
+  }
+
+ private:
+  const BaseColumn& _column;
+  const ValueColumn<std::string>* const _value_column;
+  const DictionaryColumn<std::string>* const _dictionary_column;
+};
+
+}  // namespace
+
 // We need to use the impl pattern because the join operator depends on the type of the columns
 template <typename LeftType, typename RightType>
 class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
  public:
   JoinHashImpl(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
                const JoinMode mode, const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type,
-               const bool inputs_swapped)
+               const bool inputs_swapped, const std::optional<size_t>& radix_bits)
       : _left(left),
         _right(right),
         _mode(mode),
         _column_ids(column_ids),
         _scan_type(scan_type),
         _inputs_swapped(inputs_swapped),
-        _output_table(std::make_shared<Table>()) {}
+        _output_table(std::make_shared<Table>()),
+        _fixed_radix_bits(radix_bits) {}
 
   virtual ~JoinHashImpl() = default;
 
@@ -109,20 +164,97 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   const std::shared_ptr<Table> _output_table;
 
   const unsigned int _partitioning_seed = 13;
-  const size_t _radix_bits = 9;
+
+  // Copies of strings that could not be viewed in the input columns, see StringViewAccessor
+  std::deque<std::deque<std::string>> _owned_strings;
+
+  // The hash table of a partition should fit into the L2 cache (conservatively assumed to be 256 KB)
+  static constexpr size_t L2_CACHE_SIZE = 256 * 1024;
+
+  // Writing to more partitions at once thrashes the TLB, so more radix bits are split over multiple passes
+  static constexpr size_t MAX_RADIX_BITS_PER_PASS = 8;
+
+  // The remaining bits of the 32 bit hash are left to the hash tables
+  static constexpr size_t MAX_RADIX_BITS = 16;
+
+  const std::optional<size_t> _fixed_radix_bits;
+
+  // Number of radix bits used in each partitioning pass. Empty if the inputs are not partitioned at all.
+  std::vector<size_t> _radix_bits_per_pass;
+  size_t _radix_bits = 0;
+
+  /*
+  Chooses the radix bits so that the hash table of each partition of the build relation fits into the L2 cache.
+  Build relations that fit into the cache as a whole are not partitioned at all.
+  */
+  void _choose_radix_bits(const size_t build_row_count) {
+    auto radix_bits = size_t{0};
+
+    if (_fixed_radix_bits) {
+      radix_bits = *_fixed_radix_bits;
+      Assert(radix_bits <= MAX_RADIX_BITS, "Too many radix bits.");
+    } else {
+      const auto hash_table_size = HashTable::estimate_memory_usage(build_row_count);
+      while ((hash_table_size >> radix_bits) > L2_CACHE_SIZE && radix_bits < MAX_RADIX_BITS) {
+        ++radix_bits;
+      }
+    }
+
+    _radix_bits = radix_bits;
+
+    // Distribute the bits evenly over the passes
+    const auto pass_count = (radix_bits + MAX_RADIX_BITS_PER_PASS - 1) / MAX_RADIX_BITS_PER_PASS;
+    _radix_bits_per_pass.clear();
+    for (auto pass = size_t{0}; pass < pass_count; ++pass) {
+      const auto pass_bits = radix_bits / (pass_count - pass);
+      _radix_bits_per_pass.push_back(pass_bits);
+      radix_bits -= pass_bits;
+    }
+  }
+
+  /*
+  Returns the partition of a hash in the given pass. Each pass takes the next bits of the hash, starting with the
+  most significant ones, so that the partitions of a pass subdivide the partitions of the previous pass.
+  */
+  size_t _radix(const Hash hash, const size_t pass) const {
+    auto shift = size_t{32};
+    for (auto previous_pass = size_t{0}; previous_pass <= pass; ++previous_pass) {
+      shift -= _radix_bits_per_pass[previous_pass];
+    }
+    return (hash >> shift) & ((size_t{1} << _radix_bits_per_pass[pass]) - 1);
+  }
+
+  // Returns the partition of a hash after all passes
+  size_t _partition_id(const Hash hash) const { return _radix_bits == 0 ? 0 : hash >> (32 - _radix_bits); }
+
+  using HashTable = FlatHashTable<JoinKey<LeftType>>;
+
+  using BloomFilters = std::vector<std::shared_ptr<BloomFilter<LeftType>>>;
+
+  /*
+  Returns false if the build relation certainly does not contain a value with this hash. There is one bloom filter
+  per partition (nullptr if the partition is empty), which is built together with the partition's hash table.
+  */
+  bool _may_match(const Hash hash, const BloomFilters* bloom_filters) const {
+    if (!bloom_filters) return true;
+
+    const auto& bloom_filter = (*bloom_filters)[_partition_id(hash)];
+    return bloom_filter && bloom_filter->contains_hash(hash);
+  }
 
   /*
   This is how elements of the input relations are saved after materialization.
-  The original value is used to detect hash collisions.
+  The original value is used to detect hash collisions. Strings are stored as views, so that elements can be copied
+  during the partitioning without allocations. The characters are only compared if the hashes match.
   */
   template <typename T>
   struct PartitionedElement {
-    PartitionedElement() : row_id(NULL_ROW_ID), partition_hash(0), value(T()) {}
-    PartitionedElement(RowID row, Hash hash, T val) : row_id(row), partition_hash(hash), value(val) {}
+    PartitionedElement() : row_id(NULL_ROW_ID), partition_hash(0), value(JoinKey<T>()) {}
+    PartitionedElement(RowID row, Hash hash, JoinKey<T> val) : row_id(row), partition_hash(hash), value(val) {}
 
     RowID row_id;
     Hash partition_hash;
-    T value;
+    JoinKey<T> value;
   };
 
   template <typename T>
@@ -138,10 +270,58 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     std::vector<size_t> partition_offsets;
   };
 
+  /*
+  Calls functor(chunk_offset, value) for each row of a string column, where value is std::nullopt for NULL values.
+  The views point into the ValueColumns and dictionaries of the input, or of the referenced table for ReferenceColumns.
+  */
+  template <typename Functor>
+  static void _materialize_strings(const BaseColumn& column, std::deque<std::string>& owned_strings,
+                                   const Functor& functor) {
+    const auto reference_column = dynamic_cast<const ReferenceColumn*>(&column);
+    if (!reference_column) {
+      const auto accessor = StringViewAccessor{column};
+      for (ChunkOffset chunk_offset{0}; chunk_offset < column.size(); ++chunk_offset) {
+        functor(chunk_offset, accessor.get(chunk_offset, owned_strings));
+      }
+      return;
+    }
+
+    const auto& referenced_table = *reference_column->referenced_table();
+    const auto referenced_column_id = reference_column->referenced_column_id();
+
+    // Position lists mostly reference long runs of the same chunk, so the accessor is only replaced on chunk changes
+    auto accessor = std::optional<StringViewAccessor>{};
+    auto accessor_chunk_id = ChunkID{0};
+
+    ChunkOffset chunk_offset{0};
+    for (const auto& row_id : *reference_column->pos_list()) {
+      if (row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
+        functor(chunk_offset++, std::nullopt);
+        continue;
+      }
+
+      if (!accessor || row_id.chunk_id != accessor_chunk_id) {
+        accessor.emplace(*referenced_table.get_chunk(row_id.chunk_id).get_column(referenced_column_id));
+        accessor_chunk_id = row_id.chunk_id;
+      }
+      functor(chunk_offset++, accessor->get(row_id.chunk_offset, owned_strings));
+    }
+  }
+
+  /*
+  Materializes the join column in morsels (see MorselDispatcher). The elements of each morsel are written to the
+  output starting at morsel_offsets[morsel_id], and histograms[morsel_id] counts them per partition of the first
+  radix pass.
+
+  If bloom_filters are given, rows that certainly do not find a join partner are dropped right away, so that they are
+  neither stored nor partitioned.
+  */
   template <typename T>
   std::shared_ptr<Partition<T>> _materialize_input(const std::shared_ptr<const Table> in_table, ColumnID column_id,
+                                                   std::vector<size_t>& morsel_offsets,
                                                    std::vector<std::shared_ptr<std::vector<size_t>>>& histograms,
-                                                   bool keep_nulls = false) {
+                                                   bool keep_nulls = false,
+                                                   const BloomFilters* bloom_filters = nullptr) {
     // list of all elements that will be partitioned
     auto elements = std::make_shared<Partition<T>>();
     elements->resize(in_table->row_count());
@@ -149,131 +329,135 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     // arbitrary seed for the first hash iteration
     unsigned int seed = _partitioning_seed;
 
-    // fan-out
-    const size_t num_partitions = 1 << _radix_bits;
-
-    // currently, we just do one pass
-    size_t pass = 0;
-    size_t mask = static_cast<uint32_t>(pow(2, _radix_bits * (pass + 1)) - 1);
+    // fan-out of the first pass, histograms are only needed if the input is partitioned
+    const auto is_partitioned = !_radix_bits_per_pass.empty();
+    const size_t num_partitions = is_partitioned ? size_t{1} << _radix_bits_per_pass.front() : 1;
 
-    auto chunk_offsets = std::vector<size_t>(in_table->chunk_count());
+    auto dispatcher = MorselDispatcher{*in_table};
+    const auto& morsels = dispatcher.morsels();
 
-    // fill work queue
+    morsel_offsets.resize(morsels.size());
     size_t output_offset = 0;
-    for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); chunk_id++) {
-      auto column = in_table->get_chunk(chunk_id).get_column(column_id);
-
-      chunk_offsets[chunk_id] = output_offset;
-      output_offset += column->size();
+    for (auto morsel_id = size_t{0}; morsel_id < morsels.size(); ++morsel_id) {
+      morsel_offsets[morsel_id] = output_offset;
+      output_offset += morsels[morsel_id].row_count();
     }
 
-    // create histograms per chunk
-    histograms = std::vector<std::shared_ptr<std::vector<size_t>>>();
-    histograms.resize(chunk_offsets.size());
+    // create histograms per morsel
+    histograms = std::vector<std::shared_ptr<std::vector<size_t>>>(morsels.size());
 
-    std::vector<std::shared_ptr<AbstractTask>> jobs;
-    jobs.reserve(in_table->chunk_count());
-
-    for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
-        // Get information from work queue
-        auto output_offset = chunk_offsets[chunk_id];
-        auto column = in_table->get_chunk(chunk_id).get_column(column_id);
-        auto& output = static_cast<Partition<T>&>(*elements);
+    // Each morsel gets its own storage for strings that cannot be viewed in place, so that the jobs do not share one
+    auto owned_strings = std::vector<std::deque<std::string>*>(morsels.size());
+    if constexpr (std::is_same_v<T, std::string>) {
+      for (auto& morsel_owned_strings : owned_strings) morsel_owned_strings = &_owned_strings.emplace_back();
+    }
 
-        // prepare histogram
-        histograms[chunk_id] = std::make_shared<std::vector<size_t>>(num_partitions);
+    dispatcher.process([&](const size_t morsel_id, const Morsel& morsel) {
+      auto& output = static_cast<Partition<T>&>(*elements);
+
+      // prepare histogram
+      histograms[morsel_id] = std::make_shared<std::vector<size_t>>(num_partitions);
+      auto& histogram = static_cast<std::vector<size_t>&>(*histograms[morsel_id]);
+
+      auto materialized_morsel = std::vector<std::pair<RowID, JoinKey<T>>>();
+      materialized_morsel.reserve(morsel.row_count());
+
+      /*
+      For ReferenceColumns we do not use the RowIDs from the referenced tables.
+      Instead, we use the index in the ReferenceColumn itself. This way we can later correctly dereference
+      values from different inputs (important for Multi Joins).
+      The columns of ranges that do not cover their whole chunk are views of the range (see ChunkRange::column()),
+      so their offsets are relative to the beginning of the range.
+      */
+      for (const auto& range : morsel.ranges) {
+        const auto column = range.column(in_table, column_id);
+
+        const auto add_value = [&](const ChunkOffset offset, const bool is_null, const JoinKey<T>& value) {
+          if (!is_null || keep_nulls) {
+            materialized_morsel.emplace_back(RowID{range.chunk_id, range.begin + offset}, value);
+          } else {
+            // We need to add this to avoid gaps in the list of offsets when we iterate later on
+            materialized_morsel.emplace_back(RowID{range.chunk_id, INVALID_CHUNK_OFFSET}, JoinKey<T>{});
+          }
+        };
+
+        // Materialize the range
+        if constexpr (std::is_same_v<T, std::string>) {
+          _materialize_strings(*column, *owned_strings[morsel_id],
+                               [&](const ChunkOffset offset, const std::optional<std::string_view>& value) {
+                                 add_value(offset, !value, value.value_or(std::string_view{}));
+                               });
+        } else {
+          resolve_column_type<T>(*column, [&](auto& typed_column) {
+            auto iterable = create_iterable_from_column<T>(typed_column);
 
-        auto& histogram = static_cast<std::vector<size_t>&>(*histograms[chunk_id]);
+            iterable.for_each(
+                [&](const auto& value) { add_value(value.chunk_offset(), value.is_null(), value.value()); });
+          });
+        }
+      }
 
-        auto materialized_chunk = std::vector<std::pair<RowID, T>>();
+      // hash and add to the other elements
+      size_t row_id = morsel_offsets[morsel_id];
+      for (auto&& elem : materialized_morsel) {
+        if (elem.first.chunk_offset == INVALID_CHUNK_OFFSET) continue;
 
-        // Materialize the chunk
-        resolve_column_type<T>(*column, [&, chunk_id, keep_nulls](auto& typed_column) {
-          auto iterable = create_iterable_from_column<T>(typed_column);
+        const auto hash = murmur2<JoinKey<T>>(elem.second, seed);
+        if (!_may_match(hash, bloom_filters)) continue;
 
-          iterable.for_each([&, chunk_id, keep_nulls](const auto& value) {
-            if (!value.is_null() || keep_nulls) {
-              materialized_chunk.emplace_back(RowID{chunk_id, value.chunk_offset()}, value.value());
-            } else {
-              // We need to add this to avoid gaps in the list of offsets when we iterate later on
-              materialized_chunk.emplace_back(RowID{chunk_id, INVALID_CHUNK_OFFSET}, T{});
-            }
-          });
-        });
-
-        size_t row_id = output_offset;
-
-        /*
-        For ReferenceColumns we do not use the RowIDs from the referenced tables.
-        Instead, we use the index in the ReferenceColumn itself. This way we can later correctly dereference
-        values from different inputs (important for Multi Joins).
-        For performance reasons this if statement is around the for loop.
-        */
-        if (auto ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
-          // hash and add to the other elements
-          ChunkOffset offset = 0;
-          for (auto&& elem : materialized_chunk) {
-            if (elem.first.chunk_offset != INVALID_CHUNK_OFFSET) {
-              output[row_id] =
-                  PartitionedElement<T>{RowID{chunk_id, offset}, murmur2<T>(elem.second, seed), elem.second};
-
-              const Hash radix = (output[row_id].partition_hash >> (32 - _radix_bits * (pass + 1))) & mask;
-              histogram[radix]++;
-
-              row_id++;
-            }
+        output[row_id] = PartitionedElement<T>{elem.first, hash, elem.second};
 
-            offset++;
-          }
-        } else {
-          // hash and add to the other elements
-          for (auto&& elem : materialized_chunk) {
-            if (elem.first.chunk_offset == INVALID_CHUNK_OFFSET) continue;
+        if (is_partitioned) histogram[_radix(hash, 0)]++;
 
-            output[row_id] = PartitionedElement<T>{elem.first, murmur2<T>(elem.second, seed), elem.second};
+        row_id++;
+      }
+    });
 
-            const Hash radix = (output[row_id].partition_hash >> (32 - _radix_bits * (pass + 1))) & mask;
-            histogram[radix]++;
+    return elements;
+  }
 
-            row_id++;
-          }
-        }
-      }));
-      jobs.back()->schedule();
+  /*
+  Partitions the materialized input in as many passes as chosen by _choose_radix_bits. If no radix bits were chosen,
+  the materialized input is used as a single partition. It may then contain elements without a valid RowID (i.e.,
+  filtered null values), which are skipped when building and probing.
+  */
+  template <typename T>
+  RadixContainer<T> _partition(std::shared_ptr<Partition<T>> materialized, const std::vector<size_t>& morsel_offsets,
+                               std::vector<std::shared_ptr<std::vector<size_t>>>& histograms, bool keep_nulls = false) {
+    if (_radix_bits_per_pass.empty()) {
+      return RadixContainer<T>{materialized, std::vector<size_t>{0, materialized->size()}};
     }
 
-    CurrentScheduler::wait_for_tasks(jobs);
+    auto radix_container = _partition_radix_parallel<T>(materialized, morsel_offsets, histograms, keep_nulls);
 
-    return elements;
+    for (auto pass = size_t{1}; pass < _radix_bits_per_pass.size(); ++pass) {
+      radix_container = _refine_partitions(radix_container, pass);
+    }
+
+    return radix_container;
   }
 
+  // First partitioning pass, which uses the histograms of the materialization. Each job partitions one morsel.
   template <typename T>
   RadixContainer<T> _partition_radix_parallel(std::shared_ptr<Partition<T>> materialized,
-                                              std::shared_ptr<std::vector<size_t>> chunk_offsets,
+                                              const std::vector<size_t>& offsets,
                                               std::vector<std::shared_ptr<std::vector<size_t>>>& histograms,
                                               bool keep_nulls = false) {
     // fan-out
-    const size_t num_partitions = 1 << _radix_bits;
-
-    // currently, we just do one pass
-    size_t pass = 0;
-    size_t mask = static_cast<uint32_t>(pow(2, _radix_bits * (pass + 1)) - 1);
+    const size_t num_partitions = size_t{1} << _radix_bits_per_pass.front();
 
     // allocate new (shared) output
     auto output = std::make_shared<Partition<T>>();
     output->resize(materialized->size());
 
-    auto& offsets = static_cast<std::vector<size_t>&>(*chunk_offsets);
-
     RadixContainer<T> radix_output;
     radix_output.elements = output;
     radix_output.partition_offsets.resize(num_partitions + 1);
 
     // use histograms to calculate partition offsets
-    for (ChunkID chunk_id{0}; chunk_id < offsets.size(); ++chunk_id) {
+    for (auto morsel_id = size_t{0}; morsel_id < offsets.size(); ++morsel_id) {
       size_t local_sum = 0;
-      auto& histogram = static_cast<std::vector<size_t>&>(*histograms[chunk_id]);
+      auto& histogram = static_cast<std::vector<size_t>&>(*histograms[morsel_id]);
 
       for (size_t partition_id = 0; partition_id < num_partitions; ++partition_id) {
         // update local prefix sum
@@ -299,28 +483,28 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     std::vector<std::shared_ptr<AbstractTask>> jobs;
     jobs.reserve(offsets.size());
 
-    for (ChunkID chunk_id{0}; chunk_id < offsets.size(); ++chunk_id) {
-      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id] {
+    for (auto morsel_id = size_t{0}; morsel_id < offsets.size(); ++morsel_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, morsel_id] {
         // calculate output offsets for each partition
         auto output_offsets = std::vector<size_t>(num_partitions, 0);
 
-        // add up the output offsets for chunks before this one
-        for (ChunkID i{0}; i < chunk_id; ++i) {
+        // add up the output offsets for morsels before this one
+        for (auto i = size_t{0}; i < morsel_id; ++i) {
           for (size_t j = 0; j < num_partitions; ++j) {
             output_offsets[j] += histograms[i]->operator[](j);
           }
         }
-        for (auto i = chunk_id; i < offsets.size(); ++i) {
+        for (auto i = morsel_id; i < offsets.size(); ++i) {
           for (size_t j = 1; j < num_partitions; ++j) {
             output_offsets[j] += histograms[i]->operator[](j - 1);
           }
         }
 
-        size_t input_offset = offsets[chunk_id];
+        size_t input_offset = offsets[morsel_id];
 
         size_t input_size = 0;
-        if (chunk_id < offsets.size() - 1) {
-          input_size = offsets[chunk_id + 1] - input_offset;
+        if (morsel_id < offsets.size() - 1) {
+          input_size = offsets[morsel_id + 1] - input_offset;
         } else {
           input_size = materialized->size() - input_offset;
         }
@@ -333,9 +517,57 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
             continue;
           }
 
-          const size_t radix = (element.partition_hash >> (32 - _radix_bits * (pass + 1))) & mask;
+          out[output_offsets[_radix(element.partition_hash, 0)]++] = element;
+        }
+      }));
+      jobs.back()->schedule();
+    }
+
+    CurrentScheduler::wait_for_tasks(jobs);
 
-          out[output_offsets[radix]++] = element;
+    return radix_output;
+  }
+
+  /*
+  Subdivides each partition of the previous pass by the radix bits of the given pass. The partitions are refined
+  independently of each other, so that each job only writes to the few output partitions of one input partition.
+  */
+  template <typename T>
+  RadixContainer<T> _refine_partitions(const RadixContainer<T>& input, const size_t pass) {
+    const auto fan_out = size_t{1} << _radix_bits_per_pass[pass];
+    const auto input_partition_count = input.partition_offsets.size() - 1;
+
+    RadixContainer<T> radix_output;
+    radix_output.elements = std::make_shared<Partition<T>>(input.elements->size());
+    radix_output.partition_offsets.resize(input_partition_count * fan_out + 1);
+    radix_output.partition_offsets.back() = input.partition_offsets.back();
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(input_partition_count);
+
+    for (size_t input_partition_id = 0; input_partition_id < input_partition_count; ++input_partition_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, input_partition_id] {
+        const auto& in = *input.elements;
+        auto& out = *radix_output.elements;
+        const auto input_begin = input.partition_offsets[input_partition_id];
+        const auto input_end = input.partition_offsets[input_partition_id + 1];
+
+        auto histogram = std::vector<size_t>(fan_out, 0);
+        for (auto offset = input_begin; offset < input_end; ++offset) {
+          ++histogram[_radix(in[offset].partition_hash, pass)];
+        }
+
+        // The output partitions of this input partition cover the same range as the input partition
+        auto output_offsets = std::vector<size_t>(fan_out);
+        auto output_offset = input_begin;
+        for (size_t partition_id = 0; partition_id < fan_out; ++partition_id) {
+          output_offsets[partition_id] = output_offset;
+          radix_output.partition_offsets[input_partition_id * fan_out + partition_id] = output_offset;
+          output_offset += histogram[partition_id];
+        }
+
+        for (auto offset = input_begin; offset < input_end; ++offset) {
+          out[output_offsets[_radix(in[offset].partition_hash, pass)]++] = in[offset];
         }
       }));
       jobs.back()->schedule();
@@ -347,10 +579,11 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   }
 
   /*
-  Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left
+  Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left.
+  If bloom_filters is given, a bloom filter of the values is built for each partition as well.
   */
   void _build(const RadixContainer<LeftType>& radix_container,
-              std::vector<std::shared_ptr<HashTable<LeftType>>>& hashtables) {
+              std::vector<std::shared_ptr<HashTable>>& hashtables, BloomFilters* bloom_filters) {
     std::vector<std::shared_ptr<AbstractTask>> jobs;
     jobs.reserve(radix_container.partition_offsets.size() - 1);
 
@@ -367,15 +600,22 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
           return;
         }
 
-        auto hashtable = std::make_shared<HashTable<LeftType>>(partition_size);
+        // The partition size is taken from the histograms and bounds the number of distinct values
+        auto hashtable = std::make_shared<HashTable>(partition_size);
+        auto bloom_filter = bloom_filters ? std::make_shared<BloomFilter<LeftType>>(partition_size) : nullptr;
 
         for (size_t partition_offset = partition_left_begin; partition_offset < partition_left_end;
              ++partition_offset) {
           auto& element = partition_left[partition_offset];
-          hashtable->put(element.value, element.row_id);
+          if (element.row_id.chunk_offset == INVALID_CHUNK_OFFSET) continue;
+
+          hashtable->put(element.value, element.partition_hash, element.row_id);
+          if (bloom_filter) bloom_filter->insert_hash(element.partition_hash);
         }
+        hashtable->finalize();
 
         hashtables[current_partition_id] = hashtable;
+        if (bloom_filters) (*bloom_filters)[current_partition_id] = bloom_filter;
       }));
       jobs.back()->schedule();
     }
@@ -389,8 +629,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   number of hash tables that need to be looked into to just 1.
   */
   void _probe(const RadixContainer<RightType>& radix_container,
-              const std::vector<std::shared_ptr<HashTable<LeftType>>>& hashtables, std::vector<PosList>& pos_list_left,
-              std::vector<PosList>& pos_list_right) {
+              const std::vector<std::shared_ptr<HashTable>>& hashtables,
+              std::vector<PosList>& pos_list_left, std::vector<PosList>& pos_list_right) {
     std::vector<std::shared_ptr<AbstractTask>> jobs;
     jobs.reserve(radix_container.partition_offsets.size() - 1);
 
@@ -428,20 +668,19 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
               continue;
             }
 
-            // This is where the actual comparison happens. `get` only returns values that match and eliminates hash
-            // collisions.
-            auto row_ids = hashtable->get(row.value);
-
-            if (row_ids) {
-              for (const auto& row_id : *row_ids) {
-                if (row_id.chunk_offset != INVALID_CHUNK_OFFSET) {
-                  pos_list_left_local.emplace_back(row_id);
-                  pos_list_right_local.emplace_back(row.row_id);
-                }
-              }
-              // We assume that the relations have been swapped previously,
-              // so that the outer relation is the probing relation.
-            } else if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
+            // This is where the actual comparison happens. `for_each_row_id` only visits values that match and
+            // eliminates hash collisions.
+            const auto match_count =
+                hashtable->for_each_row_id(row.value, row.partition_hash, [&](const RowID& row_id) {
+                  if (row_id.chunk_offset != INVALID_CHUNK_OFFSET) {
+                    pos_list_left_local.emplace_back(row_id);
+                    pos_list_right_local.emplace_back(row.row_id);
+                  }
+                });
+
+            // We assume that the relations have been swapped previously,
+            // so that the outer relation is the probing relation.
+            if (match_count == 0 && (_mode == JoinMode::Left || _mode == JoinMode::Right)) {
               pos_list_left_local.emplace_back(RowID{ChunkID{0}, INVALID_CHUNK_OFFSET});
               pos_list_right_local.emplace_back(row.row_id);
             }
@@ -475,7 +714,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   }
 
   void _probe_semi_anti(const RadixContainer<RightType>& radix_container,
-                        const std::vector<std::shared_ptr<HashTable<LeftType>>>& hashtables,
+                        const std::vector<std::shared_ptr<HashTable>>& hashtables,
                         std::vector<PosList>& pos_lists) {
     std::vector<std::shared_ptr<AbstractTask>> jobs;
     jobs.reserve(radix_container.partition_offsets.size() - 1);
@@ -505,7 +744,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
               continue;
             }
 
-            auto matching_rows = hashtable->get(row.value);
+            const auto matching_rows = hashtable->contains(row.value, row.partition_hash);
 
             if ((_mode == JoinMode::Semi && matching_rows) || (_mode == JoinMode::Anti && !matching_rows)) {
               // Semi: found at least one match for this row -> match
@@ -517,6 +756,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
           // no hashtable on other side, but we are in Anti mode
           for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
             auto& row = partition[partition_offset];
+            if (row.row_id.chunk_offset == INVALID_CHUNK_OFFSET) continue;
+
             pos_list_local.emplace_back(row.row_id);
           }
         }
@@ -531,6 +772,232 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     CurrentScheduler::wait_for_tasks(jobs);
   }
 
+  /*
+  If the join columns of both inputs are DictionaryColumns in all chunks, or ReferenceColumns that only reference
+  DictionaryColumns, the join is performed on ValueIDs instead of values. The distinct values of the left dictionaries
+  are numbered with join ids. Each dictionary is then mapped onto these join ids once, so that the rows themselves are
+  only compared by integer lookups. Strings are neither copied nor hashed per row.
+  */
+  using DictionaryKey = std::conditional_t<std::is_same_v<LeftType, std::string>, std::string_view, LeftType>;
+
+  // The join id of NULL values, and of right values that do not occur in the left input
+  static constexpr uint32_t NULL_JOIN_ID = std::numeric_limits<uint32_t>::max();
+  static constexpr uint32_t UNMATCHED_JOIN_ID = NULL_JOIN_ID - 1u;
+
+  // The join ids of the ValueIDs of each dictionary, which are computed once per dictionary
+  using JoinIdsPerDictionary = std::unordered_map<const DictionaryColumn<LeftType>*, std::vector<uint32_t>>;
+
+  static bool _is_dictionary_encoded(const Table& table, const ColumnID column_id) {
+    if (table.row_count() == 0) return false;
+
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto column = table.get_chunk(chunk_id).get_column(column_id);
+      if (std::dynamic_pointer_cast<const DictionaryColumn<LeftType>>(column)) continue;
+
+      const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column);
+      if (!reference_column) return false;
+
+      // Position lists mostly reference one chunk after another, so each referenced chunk is usually checked once
+      const auto& referenced_table = *reference_column->referenced_table();
+      auto checked_chunk_id = std::optional<ChunkID>{};
+      for (const auto& row_id : *reference_column->pos_list()) {
+        if (row_id == NULL_ROW_ID || row_id.chunk_id == checked_chunk_id) continue;
+
+        const auto referenced_column =
+            referenced_table.get_chunk(row_id.chunk_id).get_column(reference_column->referenced_column_id());
+        if (!std::dynamic_pointer_cast<const DictionaryColumn<LeftType>>(referenced_column)) return false;
+        checked_chunk_id = row_id.chunk_id;
+      }
+    }
+    return true;
+  }
+
+  static DictionaryKey _dictionary_key(const dictionary_t<LeftType>& dictionary, const size_t index) {
+    if constexpr (std::is_same_v<LeftType, std::string>) {
+      return dictionary.view(index);
+    } else {
+      return dictionary[index];
+    }
+  }
+
+  /*
+  Returns the join id of each row of a chunk. map_dictionary(dictionary) returns the join ids of the ValueIDs of a
+  dictionary that is encountered for the first time. The attribute vectors are read through their concrete types, so
+  that no virtual call is made per row.
+  */
+  template <typename MapDictionary>
+  static std::vector<uint32_t> _chunk_join_ids(const Table& table, const ChunkID chunk_id, const ColumnID column_id,
+                                               JoinIdsPerDictionary& join_ids_per_dictionary,
+                                               const MapDictionary& map_dictionary) {
+    const auto get_join_ids = [&](const DictionaryColumn<LeftType>& column) -> const std::vector<uint32_t>& {
+      auto join_ids_it = join_ids_per_dictionary.find(&column);
+      if (join_ids_it == join_ids_per_dictionary.end()) {
+        join_ids_it = join_ids_per_dictionary.emplace(&column, map_dictionary(*column.dictionary())).first;
+      }
+      return join_ids_it->second;
+    };
+
+    const auto column = table.get_chunk(chunk_id).get_column(column_id);
+    auto chunk_join_ids = std::vector<uint32_t>(column->size());
+
+    if (const auto dictionary_column = std::dynamic_pointer_cast<const DictionaryColumn<LeftType>>(column)) {
+      const auto& join_ids = get_join_ids(*dictionary_column);
+
+      resolve_attribute_vector_type(*dictionary_column->attribute_vector(), [&](const auto& attribute_vector) {
+        auto decoder = create_attribute_vector_decoder(attribute_vector, 0u);
+        for (auto& join_id : chunk_join_ids) {
+          const auto value_id = decoder.value_id();
+          join_id = value_id == NULL_VALUE_ID ? NULL_JOIN_ID : join_ids[value_id];
+          decoder.increment();
+        }
+      });
+
+      return chunk_join_ids;
+    }
+
+    // A ReferenceColumn is resolved one run of positions in the same referenced chunk at a time
+    const auto& reference_column = static_cast<const ReferenceColumn&>(*column);
+    const auto& referenced_table = *reference_column.referenced_table();
+    const auto& pos_list = *reference_column.pos_list();
+
+    for (auto run_begin = size_t{0}; run_begin < pos_list.size();) {
+      // NULL_ROW_ID has the ChunkID 0, so NULL positions form runs of their own
+      const auto referenced_chunk_id = pos_list[run_begin].chunk_id;
+      const auto is_null = pos_list[run_begin] == NULL_ROW_ID;
+      auto run_end = run_begin + 1u;
+      while (run_end < pos_list.size() && pos_list[run_end].chunk_id == referenced_chunk_id &&
+             (pos_list[run_end] == NULL_ROW_ID) == is_null) {
+        ++run_end;
+      }
+
+      if (is_null) {
+        std::fill(chunk_join_ids.begin() + run_begin, chunk_join_ids.begin() + run_end, NULL_JOIN_ID);
+        run_begin = run_end;
+        continue;
+      }
+
+      const auto& dictionary_column = static_cast<const DictionaryColumn<LeftType>&>(
+          *referenced_table.get_chunk(referenced_chunk_id).get_column(reference_column.referenced_column_id()));
+      const auto& join_ids = get_join_ids(dictionary_column);
+
+      resolve_attribute_vector_type(*dictionary_column.attribute_vector(), [&](const auto& attribute_vector) {
+        for (auto position = run_begin; position < run_end; ++position) {
+          // get() is not virtual on the concrete attribute vector type
+          const auto value_id = attribute_vector.get(pos_list[position].chunk_offset);
+          chunk_join_ids[position] = value_id == NULL_VALUE_ID ? NULL_JOIN_ID : join_ids[value_id];
+        }
+      });
+
+      run_begin = run_end;
+    }
+
+    return chunk_join_ids;
+  }
+
+  void _join_on_value_ids(const std::shared_ptr<const Table>& left_in_table,
+                          const std::shared_ptr<const Table>& right_in_table, std::vector<PosList>& pos_lists_left,
+                          std::vector<PosList>& pos_lists_right) {
+    // Build phase: number the distinct values of the left dictionaries and translate each left row to a join id
+    auto join_ids = std::unordered_map<DictionaryKey, uint32_t>{};
+    const auto number_values = [&](const dictionary_t<LeftType>& dictionary) {
+      auto dictionary_join_ids = std::vector<uint32_t>{};
+      dictionary_join_ids.reserve(dictionary.size());
+      for (auto index = size_t{0}; index < dictionary.size(); ++index) {
+        const auto next_join_id = static_cast<uint32_t>(join_ids.size());
+        dictionary_join_ids.push_back(join_ids.emplace(_dictionary_key(dictionary, index), next_join_id).first->second);
+      }
+      return dictionary_join_ids;
+    };
+
+    auto left_join_ids_per_dictionary = JoinIdsPerDictionary{};
+    auto left_join_ids = std::vector<std::vector<uint32_t>>(left_in_table->chunk_count());
+    for (ChunkID chunk_id{0}; chunk_id < left_in_table->chunk_count(); ++chunk_id) {
+      left_join_ids[chunk_id] =
+          _chunk_join_ids(*left_in_table, chunk_id, _column_ids.first, left_join_ids_per_dictionary, number_values);
+    }
+
+    // Group the left RowIDs by join id. The RowIDs of join id i are row_ids[offsets[i]] to row_ids[offsets[i + 1]].
+    auto offsets = std::vector<size_t>(join_ids.size() + 1, 0);
+    for (const auto& chunk_join_ids : left_join_ids) {
+      for (const auto join_id : chunk_join_ids) {
+        if (join_id != NULL_JOIN_ID) ++offsets[join_id + 1];
+      }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    auto row_ids = std::vector<RowID>(offsets.back());
+    auto write_offsets = std::vector<size_t>(offsets.begin(), offsets.end() - 1);
+    for (ChunkID chunk_id{0}; chunk_id < left_in_table->chunk_count(); ++chunk_id) {
+      const auto& chunk_join_ids = left_join_ids[chunk_id];
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_join_ids.size(); ++chunk_offset) {
+        const auto join_id = chunk_join_ids[chunk_offset];
+        if (join_id == NULL_JOIN_ID) continue;
+
+        row_ids[write_offsets[join_id]++] = RowID{chunk_id, chunk_offset};
+      }
+    }
+    left_join_ids = {};
+
+    // Probe phase: one job per right chunk, which maps the dictionaries it reads onto the join ids before probing
+    const auto find_values = [&](const dictionary_t<LeftType>& dictionary) {
+      auto dictionary_join_ids = std::vector<uint32_t>(dictionary.size(), UNMATCHED_JOIN_ID);
+      for (auto index = size_t{0}; index < dictionary.size(); ++index) {
+        const auto join_id = join_ids.find(_dictionary_key(dictionary, index));
+        if (join_id != join_ids.end()) dictionary_join_ids[index] = join_id->second;
+      }
+      return dictionary_join_ids;
+    };
+
+    pos_lists_left.resize(right_in_table->chunk_count());
+    pos_lists_right.resize(right_in_table->chunk_count());
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(right_in_table->chunk_count());
+
+    for (ChunkID chunk_id{0}; chunk_id < right_in_table->chunk_count(); ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        auto right_join_ids_per_dictionary = JoinIdsPerDictionary{};
+        const auto chunk_join_ids = _chunk_join_ids(*right_in_table, chunk_id, _column_ids.second,
+                                                    right_join_ids_per_dictionary, find_values);
+
+        PosList pos_list_left_local;
+        PosList pos_list_right_local;
+
+        for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_join_ids.size(); ++chunk_offset) {
+          const auto join_id = chunk_join_ids[chunk_offset];
+          const auto is_match = join_id < UNMATCHED_JOIN_ID;
+          const auto match_begin = is_match ? offsets[join_id] : size_t{0};
+          const auto match_end = is_match ? offsets[join_id + 1] : size_t{0};
+          const auto row_id = RowID{chunk_id, chunk_offset};
+
+          if (_mode == JoinMode::Semi) {
+            if (match_begin != match_end) pos_list_right_local.emplace_back(row_id);
+          } else if (_mode == JoinMode::Anti) {
+            // Like the materialization, Anti joins drop NULL values
+            if (join_id != NULL_JOIN_ID && match_begin == match_end) pos_list_right_local.emplace_back(row_id);
+          } else {
+            for (auto match = match_begin; match < match_end; ++match) {
+              pos_list_left_local.emplace_back(row_ids[match]);
+              pos_list_right_local.emplace_back(row_id);
+            }
+
+            // The outer relation is the probing relation (see _probe)
+            if (match_begin == match_end && (_mode == JoinMode::Left || _mode == JoinMode::Right)) {
+              pos_list_left_local.emplace_back(NULL_ROW_ID);
+              pos_list_right_local.emplace_back(row_id);
+            }
+          }
+        }
+
+        pos_lists_left[chunk_id] = std::move(pos_list_left_local);
+        pos_lists_right[chunk_id] = std::move(pos_list_right_local);
+      }));
+      jobs.back()->schedule();
+    }
+
+    CurrentScheduler::wait_for_tasks(jobs);
+  }
+
   /*
   Copy the column meta-data from input to output table.
   */
@@ -562,6 +1029,18 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       _copy_table_metadata(_right_in_table, _output_table);
     }
 
+    std::vector<PosList> left_pos_lists;
+    std::vector<PosList> right_pos_lists;
+
+    if constexpr (std::is_same_v<LeftType, RightType>) {
+      if (_is_dictionary_encoded(*_left_in_table, _column_ids.first) &&
+          _is_dictionary_encoded(*_right_in_table, _column_ids.second)) {
+        _join_on_value_ids(_left_in_table, _right_in_table, left_pos_lists, right_pos_lists);
+        _write_output(_left_in_table, _right_in_table, left_pos_lists, right_pos_lists);
+        return _output_table;
+      }
+    }
+
     /*
      * This flag is used in the materialization and probing phases.
      * When dealing with an OUTER join, we need to make sure that we keep the NULL values for the outer relation.
@@ -569,30 +1048,11 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
      */
     auto keep_nulls = (_mode == JoinMode::Left || _mode == JoinMode::Right);
 
-    // Pre-partitioning
-    // Save chunk offsets into the input relation
-    size_t left_chunk_count = _left_in_table->chunk_count();
-    size_t right_chunk_count = _right_in_table->chunk_count();
-
-    auto left_chunk_offsets = std::make_shared<std::vector<size_t>>();
-    auto right_chunk_offsets = std::make_shared<std::vector<size_t>>();
-
-    left_chunk_offsets->resize(left_chunk_count);
-    right_chunk_offsets->resize(right_chunk_count);
-
-    size_t offset_left = 0;
-    for (ChunkID i{0}; i < left_chunk_count; ++i) {
-      left_chunk_offsets->operator[](i) = offset_left;
-      offset_left += _left_in_table->get_chunk(i).size();
-    }
-
-    size_t offset_right = 0;
-    for (ChunkID i{0}; i < right_chunk_count; ++i) {
-      right_chunk_offsets->operator[](i) = offset_right;
-      offset_right += _right_in_table->get_chunk(i).size();
-    }
+    _choose_radix_bits(_left_in_table->row_count());
 
-    // Materialization phase
+    // Materialization phase, which also yields the offsets of the morsels in the materialized inputs
+    std::vector<size_t> morsel_offsets_left;
+    std::vector<size_t> morsel_offsets_right;
     std::vector<std::shared_ptr<std::vector<size_t>>> histograms_left;
     std::vector<std::shared_ptr<std::vector<size_t>>> histograms_right;
     /*
@@ -602,10 +1062,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     This helps choosing a scheduler node for the radix phase (see below).
     */
     // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
-    auto materialized_left = _materialize_input<LeftType>(_left_in_table, _column_ids.first, histograms_left);
-    // 'keep_nulls' makes sure that the relation on the right materializes NULL values when executing an OUTER join.
-    auto materialized_right =
-        _materialize_input<RightType>(_right_in_table, _column_ids.second, histograms_right, keep_nulls);
+    auto materialized_left = _materialize_input<LeftType>(_left_in_table, _column_ids.first, morsel_offsets_left,
+                                                                   histograms_left);
 
     // Radix Partitioning phase
     /*
@@ -618,23 +1076,37 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     partitions leftB and leftB should also be on the same node.
     */
     // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
-    auto radix_left = _partition_radix_parallel<LeftType>(materialized_left, left_chunk_offsets, histograms_left);
-    // 'keep_nulls' makes sure that the relation on the right keeps NULL values when executing an OUTER join.
-    auto radix_right =
-        _partition_radix_parallel<RightType>(materialized_right, right_chunk_offsets, histograms_right, keep_nulls);
+    auto radix_left = _partition<LeftType>(materialized_left, morsel_offsets_left, histograms_left);
 
     // Build phase
-    std::vector<std::shared_ptr<HashTable<LeftType>>> hashtables;
+    std::vector<std::shared_ptr<HashTable>> hashtables;
     hashtables.resize(radix_left.partition_offsets.size() - 1);
+
+    /*
+    For inner and semi joins, rows of the right relation without a join partner do not contribute to the result.
+    Bloom filters of the left values let the materialization of the right relation drop most of them, so that they
+    are not partitioned and probed. For outer and anti joins, these rows are part of the result.
+    */
+    auto bloom_filters = std::optional<BloomFilters>{};
+    if (_mode == JoinMode::Inner || _mode == JoinMode::Semi) {
+      bloom_filters.emplace(hashtables.size());
+    }
+
     /*
     NUMA notes:
     The hashtables for each partition P should also reside on the same node as the two vectors leftP and rightP.
     */
-    _build(radix_left, hashtables);
+    _build(radix_left, hashtables, bloom_filters ? &*bloom_filters : nullptr);
+
+    // 'keep_nulls' makes sure that the relation on the right materializes NULL values when executing an OUTER join.
+    auto materialized_right = _materialize_input<RightType>(_right_in_table, _column_ids.second, morsel_offsets_right,
+                                                            histograms_right, keep_nulls,
+                                                            bloom_filters ? &*bloom_filters : nullptr);
+
+    // 'keep_nulls' makes sure that the relation on the right keeps NULL values when executing an OUTER join.
+    auto radix_right = _partition<RightType>(materialized_right, morsel_offsets_right, histograms_right, keep_nulls);
 
     // Probe phase
-    std::vector<PosList> left_pos_lists;
-    std::vector<PosList> right_pos_lists;
     left_pos_lists.resize(radix_right.partition_offsets.size() - 1);
     right_pos_lists.resize(radix_right.partition_offsets.size() - 1);
     /*
@@ -648,17 +1120,26 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       _probe(radix_right, hashtables, left_pos_lists, right_pos_lists);
     }
 
+    _write_output(_left_in_table, _right_in_table, left_pos_lists, right_pos_lists);
+
+    return _output_table;
+  }
+
+  // Writes one output chunk per pair of PosLists, skipping pairs that are both empty
+  void _write_output(const std::shared_ptr<const Table>& left_in_table,
+                     const std::shared_ptr<const Table>& right_in_table, std::vector<PosList>& left_pos_lists,
+                     std::vector<PosList>& right_pos_lists) {
     /*
     Add columns to output chunk.
     We assume that either all Chunks contain ReferenceColumns or all Chunk contain Value/DictionaryColumns.
     But we expect that it is not possible to have both ReferenceColumns and Value/DictionaryColumn in one table.
     */
     auto ref_col_left =
-        std::dynamic_pointer_cast<const ReferenceColumn>(_left_in_table->get_chunk(ChunkID{0}).get_column(ColumnID{0}))
+        std::dynamic_pointer_cast<const ReferenceColumn>(left_in_table->get_chunk(ChunkID{0}).get_column(ColumnID{0}))
             ? true
             : false;
     auto ref_col_right =
-        std::dynamic_pointer_cast<const ReferenceColumn>(_right_in_table->get_chunk(ChunkID{0}).get_column(ColumnID{0}))
+        std::dynamic_pointer_cast<const ReferenceColumn>(right_in_table->get_chunk(ChunkID{0}).get_column(ColumnID{0}))
             ? true
             : false;
 
@@ -674,20 +1155,18 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
       // we need to swap back the inputs, so that the order of the output columns is not harmed
       if (_inputs_swapped) {
-        write_output_chunks(output_chunk, _right_in_table, right, ref_col_right);
+        write_output_chunks(output_chunk, right_in_table, right, ref_col_right);
 
         // Semi/Anti joins are always swapped but do not need the outer relation
         if (_mode != JoinMode::Semi && _mode != JoinMode::Anti) {
-          write_output_chunks(output_chunk, _left_in_table, left, ref_col_left);
+          write_output_chunks(output_chunk, left_in_table, left, ref_col_left);
         }
       } else {
-        write_output_chunks(output_chunk, _left_in_table, left, ref_col_left);
-        write_output_chunks(output_chunk, _right_in_table, right, ref_col_right);
+        write_output_chunks(output_chunk, left_in_table, left, ref_col_left);
+        write_output_chunks(output_chunk, right_in_table, right, ref_col_right);
       }
       _output_table->emplace_chunk(std::move(output_chunk));
     }
-
-    return _output_table;
   }
 
   static void write_output_chunks(Chunk& output_chunk, const std::shared_ptr<const Table> input_table,
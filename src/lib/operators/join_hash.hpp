@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -21,12 +22,16 @@ namespace opossum {
  *
  * Note: JoinHash does not support null values at the moment
  *
+ * The number of radix bits used for partitioning is chosen from the size of the build relation (see
+ * JoinHashImpl::_choose_radix_bits). Passing radix_bits overrides this choice, which is mostly useful for testing.
+ *
  * Find more information in our Wiki: https://github.com/hyrise/hyrise/wiki/Radix-Partitioned-and-Hash-Based-Join
  */
 class JoinHash : public AbstractJoinOperator {
  public:
   JoinHash(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
-           const JoinMode mode, const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+           const JoinMode mode, const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type,
+           const std::optional<size_t>& radix_bits = std::nullopt);
 
   const std::string name() const override;
   std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const override;
@@ -36,6 +41,7 @@ class JoinHash : public AbstractJoinOperator {
   void _on_cleanup() override;
 
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
+  const std::optional<size_t> _radix_bits;
 
   template <typename LeftType, typename RightType>
   class JoinHashImpl;
@@ -10,12 +10,13 @@
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "storage/reference_column.hpp"
 
 namespace opossum {
 
 Projection::Projection(const std::shared_ptr<const AbstractOperator> in, const ColumnExpressions& column_expressions)
-    : AbstractReadOnlyOperator(in), _column_expressions(column_expressions) {}
+    : AbstractPipelineOperator(in), _column_expressions(column_expressions) {}
 
 const std::string Projection::name() const { return "Projection"; }
 
@@ -67,6 +68,20 @@ void Projection::_create_column(boost::hana::basic_type<T> type, Chunk& chunk, c
 }
 
 std::shared_ptr<const Table> Projection::_on_execute() {
+  // Within a pipeline, the chunks are projected batch by batch
+  if (input_is_fused()) return AbstractPipelineOperator::_on_execute();
+
+  const auto input_table = _input_table_left();
+  auto output = _create_output_table(input_table);
+
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    output->emplace_chunk(_project_chunk(input_table, chunk_id, *output));
+  }
+
+  return output;
+}
+
+std::shared_ptr<Table> Projection::_create_output_table(const std::shared_ptr<const Table>& input_table) const {
   auto output = std::make_shared<Table>();
 
   // Prepare terms and output table for each column to project
@@ -76,14 +91,14 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     if (column_expression->alias()) {
       name = *column_expression->alias();
     } else if (column_expression->type() == ExpressionType::Column) {
-      name = _input_table_left()->column_name(column_expression->column_id());
+      name = input_table->column_name(column_expression->column_id());
     } else if (column_expression->is_arithmetic_operator() || column_expression->type() == ExpressionType::Literal) {
-      name = column_expression->to_string(_input_table_left()->column_names());
+      name = column_expression->to_string(input_table->column_names());
     } else {
       Fail("Expression type is not supported.");
     }
 
-    const auto type = _get_type_of_expression(column_expression, _input_table_left());
+    const auto type = _get_type_of_expression(column_expression, input_table);
     if (type == DataType::Null) {
       // in case of a NULL literal, simply add a nullable int column
       output->add_column_definition(name, DataType::Int, true);
@@ -92,25 +107,47 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     }
   }
 
-  for (ChunkID chunk_id{0}; chunk_id < _input_table_left()->chunk_count(); ++chunk_id) {
-    // fill the new table
-    Chunk chunk_out;
+  return output;
+}
 
-    // if there is mvcc information, we have to link it
-    if (_input_table_left()->get_chunk(chunk_id).has_mvcc_columns()) {
-      chunk_out.use_mvcc_columns_from(_input_table_left()->get_chunk(chunk_id));
-    }
+std::vector<Chunk> Projection::_process_morsel(
+    const std::shared_ptr<const Table>& input_table, const Morsel& morsel,
+    const std::shared_ptr<TransactionContext>& /*transaction_context*/) const {
+  const auto output = _create_output_table(input_table);
 
-    for (uint16_t expression_index = 0u; expression_index < _column_expressions.size(); ++expression_index) {
-      resolve_data_type(output->column_type(ColumnID{expression_index}), [&](auto type) {
-        _create_column(type, chunk_out, chunk_id, _column_expressions[expression_index], _input_table_left());
-      });
-    }
+  auto chunks_out = std::vector<Chunk>{};
+  for (const auto& range : morsel.ranges) {
+    // Batches of a pipeline always consist of whole chunks
+    DebugAssert(range.covers_chunk(*input_table), "Projection can only process whole chunks.");
+    chunks_out.emplace_back(_project_chunk(input_table, range.chunk_id, *output));
+  }
+  return chunks_out;
+}
+
+Chunk Projection::_create_empty_chunk(const std::shared_ptr<const Table>& input_table) const {
+  if (input_table->get_chunk(ChunkID{0}).column_count() == 0) return Chunk{};
+  return _project_chunk(input_table, ChunkID{0}, *_create_output_table(input_table));
+}
+
+bool Projection::_can_be_fused_into_consumer() const { return false; }
+
+Chunk Projection::_project_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                 const Table& output_table) const {
+  // fill the new table
+  Chunk chunk_out;
 
-    output->emplace_chunk(std::move(chunk_out));
+  // if there is mvcc information, we have to link it
+  if (input_table->get_chunk(chunk_id).has_mvcc_columns()) {
+    chunk_out.use_mvcc_columns_from(input_table->get_chunk(chunk_id));
   }
 
-  return output;
+  for (uint16_t expression_index = 0u; expression_index < _column_expressions.size(); ++expression_index) {
+    resolve_data_type(output_table.column_type(ColumnID{expression_index}), [&](auto type) {
+      _create_column(type, chunk_out, chunk_id, _column_expressions[expression_index], input_table);
+    });
+  }
+
+  return chunk_out;
 }
 
 DataType Projection::_get_type_of_expression(const std::shared_ptr<Expression>& expression,
@@ -167,6 +204,14 @@ const pmr_concurrent_vector<std::optional<T>> Projection::_evaluate_expression(
     if (auto dict_column = std::dynamic_pointer_cast<const DictionaryColumn<T>>(column)) {
       return dict_column->materialize_values();
     }
+    if (auto run_length_column = std::dynamic_pointer_cast<const RunLengthColumn<T>>(column)) {
+      return run_length_column->materialize_values();
+    }
+    if constexpr (supports_frame_of_reference_encoding_v<T>) {
+      if (auto frame_of_reference_column = std::dynamic_pointer_cast<const FrameOfReferenceColumn<T>>(column)) {
+        return frame_of_reference_column->materialize_values();
+      }
+    }
     if (auto ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
       return ref_column->template materialize_values<T>();  // Clang needs the template prefix
     }
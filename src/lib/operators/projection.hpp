@@ -10,7 +10,7 @@
 #include <utility>
 #include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_pipeline_operator.hpp"
 #include "optimizer/expression.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_column.hpp"
@@ -23,8 +23,11 @@ namespace opossum {
  * Operator to select a subset of the set of all columns found in the table
  *
  * Note: Projection does not support null values at the moment
+ *
+ * A Projection can be the last operator of a pipeline (see AbstractPipelineOperator), where it projects each chunk of
+ * a batch. As its output contains data columns, it cannot be fused into its consumer.
  */
-class Projection : public AbstractReadOnlyOperator {
+class Projection : public AbstractPipelineOperator {
  public:
   using ColumnExpressions = std::vector<std::shared_ptr<Expression>>;
 
@@ -87,6 +90,19 @@ class Projection : public AbstractReadOnlyOperator {
   static std::function<T(const T&, const T&)> _get_operator_function(ExpressionType type);
 
   std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _create_output_table(const std::shared_ptr<const Table>& input_table) const override;
+
+  std::vector<Chunk> _process_morsel(const std::shared_ptr<const Table>& input_table, const Morsel& morsel,
+                                     const std::shared_ptr<TransactionContext>& transaction_context) const override;
+
+  Chunk _create_empty_chunk(const std::shared_ptr<const Table>& input_table) const override;
+
+  bool _can_be_fused_into_consumer() const override;
+
+  // Projects one chunk of the input table, whose columns are defined by the output table
+  Chunk _project_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                       const Table& output_table) const;
 };
 
 }  // namespace opossum
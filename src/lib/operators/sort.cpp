@@ -1,215 +1,520 @@
 #include "sort.hpp"
 
-#include <functional>
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
-#include "storage/base_attribute_vector.hpp"
-#include "storage/column_visitable.hpp"
-#include "storage/iterables/chunk_offset_mapping.hpp"
-#include "storage/iterables/dictionary_column_iterable.hpp"
-#include "storage/iterables/value_column_iterable.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
+#include "storage/iterables/create_iterable_from_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/run_length_column.hpp"
 #include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/normalized_key.hpp"
 
-namespace opossum {
-
-Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const OrderByMode order_by_mode,
-           const size_t output_chunk_size)
-    : AbstractReadOnlyOperator(in),
-      _column_id(column_id),
-      _order_by_mode(order_by_mode),
-      _output_chunk_size(output_chunk_size) {}
+/*
+The normalized key of a row consists of one part per sort column, followed by the position of the row in the input
+table as a 32 bit big-endian integer. The position breaks all ties, so that the (unstable) sorting of the keys is stable
+with regard to the rows. Each part of a sort column starts with a byte that places NULLs before or after all values,
+followed by the value:
 
-ColumnID Sort::column_id() const { return _column_id; }
+  - integers have their sign bit flipped and are written big-endian,
+  - floating point numbers are flipped completely if they are negative, otherwise only their sign bit is flipped,
+  - strings are replaced by their rank among all strings of the column, written as 32 bit integer.
 
-OrderByMode Sort::order_by_mode() const { return _order_by_mode; }
+For descending columns, all bytes of the value are inverted. NULLs have a value of zero.
+*/
 
-const std::string Sort::name() const { return "Sort"; }
-
-std::shared_ptr<AbstractOperator> Sort::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<Sort>(_input_left->recreate(args), _column_id, _order_by_mode, _output_chunk_size);
-}
+namespace opossum {
 
-std::shared_ptr<const Table> Sort::_on_execute() {
-  _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, SortImpl>(_input_table_left()->column_type(_column_id),
-                                                                           _input_table_left(), _column_id,
-                                                                           _order_by_mode, _output_chunk_size);
-  return _impl->_on_execute();
+namespace {
+
+// Width of the part of a sort column, including the NULL byte
+size_t normalized_key_width(const DataType data_type) {
+  switch (data_type) {
+    case DataType::Int:
+    case DataType::Float:
+    case DataType::String:
+      return 1u + sizeof(uint32_t);
+    case DataType::Long:
+    case DataType::Double:
+      return 1u + sizeof(uint64_t);
+    default:
+      Fail("Sort: Unsupported data type");
+      return 0u;
+  }
 }
 
-void Sort::_on_cleanup() { _impl.reset(); }
+// Pairs of runs are split into pieces of this many rows, which are merged by separate tasks
+constexpr size_t ROWS_PER_MERGE_TASK = 16'384u;
 
-// This class fulfills only the materialization task for a sorted row_id_value_vector.
-template <typename SortColumnType>
-class Sort::SortImplMaterializeOutput {
+/*
+Random access to the values of one column of a table, for rows that are visited in no particular order. The column of
+each chunk is resolved once, when a row of that chunk is accessed for the first time, instead of casting it for every
+row. ReferenceColumns are resolved to the columns that they reference.
+*/
+template <typename T>
+class ColumnAccessor {
  public:
-  // creates a new table with reference columns
-  SortImplMaterializeOutput(std::shared_ptr<const Table> in,
-                            std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> id_value_map,
-                            const size_t output_chunk_size)
-      : _table_in(in), _output_chunk_size(output_chunk_size), _row_id_value_vector(id_value_map) {}
-
-  std::shared_ptr<const Table> execute() {
-    // First we create a new table as the output
-    auto output = Table::create_with_layout_from(_table_in, _output_chunk_size);
-
-    // We have decided against duplicating MVCC columns in https://github.com/hyrise/hyrise/issues/408
-
-    // After we created the output table and initialized the column structure, we can start adding values. Because the
-    // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the values are
-    // copied column by column for each output row. For each column in a row we visit the input column with a reference
-    // to the output column. This enables for the SortImplMaterializeOutput class to ignore the column types during the
-    // copying of the values.
-    ChunkID chunk_count_out;
-    size_t output_row_count = _row_id_value_vector->size();
-    if (_output_chunk_size) {
-      chunk_count_out = output_row_count % _output_chunk_size ? (output_row_count / _output_chunk_size) + 1
-                                                              : output_row_count / _output_chunk_size;
-    } else {
-      chunk_count_out = 1;
-      _output_chunk_size = output_row_count;
+  ColumnAccessor(std::shared_ptr<const Table> table, const ColumnID column_id)
+      : _table(std::move(table)), _column_id(column_id), _columns(_table->chunk_count()) {}
+
+  /*
+  Calls functor(value) with the value of the row and returns true, or returns false if the value is NULL. The value is
+  a reference into the column where possible (a std::string_view for dictionary-encoded strings), so that it can be
+  referenced for as long as the table exists.
+  */
+  template <typename Functor>
+  bool with_value(const RowID& row_id, const Functor& functor) {
+    const auto& columns = _resolve(row_id.chunk_id);
+    const auto chunk_offset = row_id.chunk_offset;
+
+    if (columns.pos_list) {
+      const auto& referenced_row_id = (*columns.pos_list)[chunk_offset];
+      if (referenced_row_id == NULL_ROW_ID) return false;
+      return columns.referenced_accessor->with_value(referenced_row_id, functor);
     }
 
-    auto row_index = 0u;
-
-    for (auto chunk_id_out = ChunkID{0}; chunk_id_out < chunk_count_out; chunk_id_out++) {
-      // Because we want to add the values row wise we have to save all columns temporarily before we can add them to
-      // the
-      // output chunk.
-      auto column_vectors = std::vector<std::shared_ptr<BaseColumn>>(output->column_count());
-      for (ColumnID column_id{0}; column_id < output->column_count(); column_id++) {
-        auto column_type = _table_in->column_type(column_id);
-        column_vectors[column_id] =
-            make_shared_by_data_type<BaseColumn, ValueColumn>(column_type, _table_in->column_is_nullable(column_id));
-      }
+    if (const auto* value_column = columns.value_column) {
+      if (value_column->is_nullable() && value_column->null_values()[chunk_offset]) return false;
+      functor(value_column->values()[chunk_offset]);
+      return true;
+    }
 
-      Chunk chunk_out;
-      // The last chunk might not be completely filled, so we have to check if we got out of range.
-      for (ChunkOffset chunk_offset_out = 0; chunk_offset_out < _output_chunk_size && row_index < output_row_count;
-           chunk_offset_out++) {
-        auto row_id_in = _row_id_value_vector->at(row_index).first;
-        for (ColumnID column_id{0}; column_id < output->column_count(); column_id++) {
-          // The actual value is added by visiting the input column, which then calls a function on the output column to
-          // copy the value
-          auto column = _table_in->get_chunk(row_id_in.chunk_id).get_column(column_id);
-          auto chunk_offset_in = row_id_in.chunk_offset;
-          if (auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
-            auto pos = reference_column->pos_list()->operator[](row_id_in.chunk_offset);
-            column = reference_column->referenced_table()
-                         ->get_chunk(pos.chunk_id)
-                         .get_column(reference_column->referenced_column_id());
-            chunk_offset_in = pos.chunk_offset;
-          }
-          column->copy_value_to_value_column(*column_vectors[column_id], chunk_offset_in);
-        }
-        row_index++;
+    if (const auto* dictionary = columns.dictionary) {
+      const auto value_id = columns.attribute_vector->get(chunk_offset);
+      if (value_id == NULL_VALUE_ID) return false;
+
+      if constexpr (std::is_same_v<T, std::string>) {
+        functor(dictionary->view(value_id));
+      } else {
+        functor((*dictionary)[value_id]);
       }
-      for (ColumnID column_id{0}; column_id < output->column_count(); column_id++) {
-        chunk_out.add_column(std::move(column_vectors[column_id]));
+      return true;
+    }
+
+    if (const auto* run_length_column = columns.run_length_column) {
+      const auto run_index = run_length_column->run_index(chunk_offset);
+      if ((*run_length_column->null_values())[run_index]) return false;
+      functor((*run_length_column->values())[run_index]);
+      return true;
+    }
+
+    if constexpr (supports_frame_of_reference_encoding_v<T>) {
+      if (const auto* frame_of_reference_column = columns.frame_of_reference_column) {
+        if (frame_of_reference_column->is_null(chunk_offset)) return false;
+        functor(frame_of_reference_column->get(chunk_offset));
+        return true;
       }
-      output->emplace_chunk(std::move(chunk_out));
     }
 
-    return output;
+    Fail("Sort: Unknown column type");
+    return false;
+  }
+
+ private:
+  using FrameOfReferenceColumnType =
+      std::conditional_t<supports_frame_of_reference_encoding_v<T>, FrameOfReferenceColumn<T>, void>;
+
+  // The column of a chunk, of which exactly one pointer is set once it is resolved
+  struct ChunkColumns {
+    bool is_resolved = false;
+
+    const ValueColumn<T>* value_column = nullptr;
+    const dictionary_t<T>* dictionary = nullptr;
+    const BaseAttributeVector* attribute_vector = nullptr;
+    const RunLengthColumn<T>* run_length_column = nullptr;
+    const FrameOfReferenceColumnType* frame_of_reference_column = nullptr;
+
+    const PosList* pos_list = nullptr;
+    ColumnAccessor* referenced_accessor = nullptr;
+  };
+
+  const ChunkColumns& _resolve(const ChunkID chunk_id) {
+    auto& columns = _columns[chunk_id];
+    if (columns.is_resolved) return columns;
+
+    // The chunk keeps its columns alive, so that the raw pointers stay valid
+    const auto& base_column = *_table->get_chunk(chunk_id).get_column(_column_id);
+
+    if (const auto* reference_column = dynamic_cast<const ReferenceColumn*>(&base_column)) {
+      columns.pos_list = reference_column->pos_list().get();
+      columns.referenced_accessor =
+          &_referenced_accessor(reference_column->referenced_table(), reference_column->referenced_column_id());
+    } else if (const auto* value_column = dynamic_cast<const ValueColumn<T>*>(&base_column)) {
+      columns.value_column = value_column;
+    } else if (const auto* dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&base_column)) {
+      columns.dictionary = dictionary_column->dictionary().get();
+      columns.attribute_vector = dictionary_column->attribute_vector().get();
+    } else if (const auto* run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&base_column)) {
+      columns.run_length_column = run_length_column;
+    } else if constexpr (supports_frame_of_reference_encoding_v<T>) {
+      columns.frame_of_reference_column = dynamic_cast<const FrameOfReferenceColumn<T>*>(&base_column);
+    }
+
+    columns.is_resolved = true;
+    return columns;
+  }
+
+  // All ReferenceColumns of a column usually reference the same table, so there is rarely more than one
+  ColumnAccessor& _referenced_accessor(const std::shared_ptr<const Table>& table, const ColumnID column_id) {
+    for (auto& accessor : _referenced_accessors) {
+      if (accessor->_table == table && accessor->_column_id == column_id) return *accessor;
+    }
+    _referenced_accessors.emplace_back(std::make_unique<ColumnAccessor>(table, column_id));
+    return *_referenced_accessors.back();
   }
 
-  std::shared_ptr<const Table> _table_in;
-  size_t _output_chunk_size;
-  std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
+  const std::shared_ptr<const Table> _table;
+  const ColumnID _column_id;
+  std::vector<ChunkColumns> _columns;
+  std::vector<std::unique_ptr<ColumnAccessor>> _referenced_accessors;
 };
 
-// we need to use the impl pattern because the scan operator of the sort depends on the type of the column
-template <typename SortColumnType>
-class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
- public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  SortImpl(const std::shared_ptr<const Table> table_in, const ColumnID column_id,
-           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0)
-      : _table_in(table_in),
-        _column_id(column_id),
-        _order_by_mode(order_by_mode),
-        _output_chunk_size(output_chunk_size) {
-    // initialize a structure which can be sorted by std::sort
-    _row_id_value_vector = std::make_shared<std::vector<RowIDValuePair>>();
-    _null_value_rows = std::make_shared<std::vector<RowIDValuePair>>();
-  }
-
-  std::shared_ptr<const Table> _on_execute() override {
-    // 1. Prepare Sort: Creating rowid-value-Structure
-    _materialize_sort_column();
-
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    if (_order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast) {
-      sort_with_operator<std::less<>>();
+/*
+Returns how many of the first diagonal rows of the merge of the sorted ranges left and right come from left (merge
+path). Like std::merge, rows of left come before equal rows of right.
+*/
+template <typename Compare>
+size_t merge_path(const uint32_t* left, const size_t left_size, const uint32_t* right, const size_t right_size,
+                  const size_t diagonal, const Compare& compare) {
+  auto low = diagonal > right_size ? diagonal - right_size : size_t{0u};
+  auto high = std::min(diagonal, left_size);
+
+  while (low < high) {
+    const auto middle = low + (high - low) / 2u;
+    if (!compare(right[diagonal - middle - 1u], left[middle])) {
+      low = middle + 1u;
     } else {
-      sort_with_operator<std::greater<>>();
+      high = middle;
     }
+  }
+  return low;
+}
 
-    // 2b. Insert null rows if necessary
-    if (_null_value_rows->size()) {
-      if (_order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast) {
-        // NULLs last
-        _row_id_value_vector->insert(_row_id_value_vector->end(), _null_value_rows->begin(), _null_value_rows->end());
-      } else {
-        // NULLs first (default behavior)
-        _row_id_value_vector->insert(_row_id_value_vector->begin(), _null_value_rows->begin(), _null_value_rows->end());
+}  // namespace
+
+SortColumnDefinition::SortColumnDefinition(const ColumnID column_id, const OrderByMode order_by_mode)
+    : column_id(column_id), order_by_mode(order_by_mode) {}
+
+bool SortColumnDefinition::nulls_first() const {
+  return order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+}
+
+bool SortColumnDefinition::descending() const {
+  return order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+}
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const OrderByMode order_by_mode,
+           const size_t output_chunk_size)
+    : Sort(in, std::vector<SortColumnDefinition>{{column_id, order_by_mode}}, output_chunk_size) {}
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t output_chunk_size)
+    : AbstractReadOnlyOperator(in), _sort_definitions(sort_definitions), _output_chunk_size(output_chunk_size) {
+  Assert(!_sort_definitions.empty(), "Sort: No columns to sort by");
+}
+
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
+
+ColumnID Sort::column_id() const { return _sort_definitions.front().column_id; }
+
+OrderByMode Sort::order_by_mode() const { return _sort_definitions.front().order_by_mode; }
+
+const std::string Sort::name() const { return "Sort"; }
+
+std::shared_ptr<AbstractOperator> Sort::recreate(const std::vector<AllParameterVariant>& args) const {
+  return std::make_shared<Sort>(_input_left->recreate(args), _sort_definitions, _output_chunk_size);
+}
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto row_count = input_table->row_count();
+  Assert(row_count < std::numeric_limits<uint32_t>::max(), "Sort: Too many rows");
+
+  // We have decided against duplicating MVCC columns in https://github.com/hyrise/hyrise/issues/408
+  auto output = Table::create_with_layout_from(input_table, _output_chunk_size);
+  if (row_count == 0u) return output;
+
+  // 1. Write the normalized keys of all rows, chunk by chunk in parallel
+  auto key_offsets = std::vector<size_t>{};
+  auto key_width = size_t{0u};
+  for (const auto& definition : _sort_definitions) {
+    key_offsets.push_back(key_width);
+    key_width += normalized_key_width(input_table->column_type(definition.column_id));
+  }
+  key_width += sizeof(uint32_t);
+
+  auto first_row_per_chunk = std::vector<size_t>(input_table->chunk_count());
+  for (ChunkID chunk_id{1}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto previous_chunk_id = ChunkID{chunk_id - 1};
+    first_row_per_chunk[chunk_id] =
+        first_row_per_chunk[previous_chunk_id] + input_table->get_chunk(previous_chunk_id).size();
+  }
+
+  auto keys = std::vector<uint8_t>(row_count * key_width);
+  auto row_ids = std::vector<RowID>(row_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(input_table->chunk_count());
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto first_row = first_row_per_chunk[chunk_id];
+      _write_keys(chunk_id, first_row, key_offsets, key_width, keys);
+
+      const auto chunk_size = input_table->get_chunk(chunk_id).size();
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        row_ids[first_row + chunk_offset] = RowID{chunk_id, chunk_offset};
       }
-    }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  jobs.clear();
+  for (auto definition_index = size_t{0}; definition_index < _sort_definitions.size(); ++definition_index) {
+    if (input_table->column_type(_sort_definitions[definition_index].column_id) != DataType::String) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, definition_index]() {
+      _write_string_ranks(definition_index, key_offsets[definition_index], key_width, row_ids, keys);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // 2. Sort the rows by their keys
+  const auto sorted_rows = _sort_rows(first_row_per_chunk, key_width, keys);
+
+  // 3. Materialize the output
+  _materialize_output(*output, sorted_rows, row_ids);
+
+  return output;
+}
 
-    // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
-    // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
-    return materialization->execute();
+void Sort::_materialize_output(Table& output, const std::vector<uint32_t>& sorted_rows,
+                               const std::vector<RowID>& row_ids) const {
+  // The output chunks are materialized in parallel
+  const auto row_count = sorted_rows.size();
+  const auto output_chunk_size = _output_chunk_size ? _output_chunk_size : row_count;
+  auto output_chunks = std::vector<Chunk>((row_count + output_chunk_size - 1u) / output_chunk_size);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(output_chunks.size());
+  for (auto chunk_index = size_t{0}; chunk_index < output_chunks.size(); ++chunk_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_index]() {
+      const auto first_sorted_row = chunk_index * output_chunk_size;
+      output_chunks[chunk_index] = _materialize_output_chunk(
+          sorted_rows, row_ids, first_sorted_row, std::min(output_chunk_size, row_count - first_sorted_row));
+    }));
+    jobs.back()->schedule();
   }
+  CurrentScheduler::wait_for_tasks(jobs);
 
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column() {
-    auto& row_id_value_vector = *_row_id_value_vector;
-    row_id_value_vector.reserve(_table_in->row_count());
+  for (auto& chunk : output_chunks) {
+    output.emplace_chunk(std::move(chunk));
+  }
+}
+
+void Sort::_write_keys(const ChunkID chunk_id, const size_t first_row, const std::vector<size_t>& key_offsets,
+                       const size_t key_width, std::vector<uint8_t>& keys) const {
+  const auto input_table = _input_table_left();
+  const auto& chunk = input_table->get_chunk(chunk_id);
+
+  for (auto definition_index = size_t{0}; definition_index < _sort_definitions.size(); ++definition_index) {
+    const auto& definition = _sort_definitions[definition_index];
+    const auto null_byte = static_cast<uint8_t>(definition.nulls_first() ? 0u : 1u);
+    const auto value_byte = static_cast<uint8_t>(1u - null_byte);
+    const auto invert = definition.descending();
 
-    auto& null_value_rows = *_null_value_rows;
+    const auto column_type = input_table->column_type(definition.column_id);
+    // Strings are ranked by _write_string_ranks, which also writes their NULL byte
+    if (column_type == DataType::String) continue;
 
-    for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
-      auto& chunk = _table_in->get_chunk(chunk_id);
+    const auto base_column = chunk.get_column(definition.column_id);
 
-      auto base_column = chunk.get_column(_column_id);
+    resolve_data_and_column_type(column_type, *base_column, [&](auto type, auto& typed_column) {
+      using ColumnDataType = typename decltype(type)::type;
 
-      resolve_column_type<SortColumnType>(*base_column, [&](auto& typed_column) {
-        auto iterable = create_iterable_from_column<SortColumnType>(typed_column);
+      if constexpr (!std::is_same_v<ColumnDataType, std::string>) {
+        auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
 
+        // The rows are counted, because the iterables of ReferenceColumns do not know the offsets of NULL rows
+        auto row = first_row;
         iterable.for_each([&](const auto& value) {
+          auto* key = &keys[row * key_width + key_offsets[definition_index]];
+
           if (value.is_null()) {
-            null_value_rows.emplace_back(RowID{chunk_id, value.chunk_offset()}, SortColumnType{});
+            key[0] = null_byte;
           } else {
-            row_id_value_vector.emplace_back(RowID{chunk_id, value.chunk_offset()}, value.value());
+            key[0] = value_byte;
+            write_big_endian(key + 1, order_preserving_bits(value.value()), invert);
           }
+
+          ++row;
         });
-      });
-    }
+      }
+    });
   }
 
-  template <typename Comparator>
-  void sort_with_operator() {
-    Comparator comparator;
-    std::stable_sort(_row_id_value_vector->begin(), _row_id_value_vector->end(),
-                     [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
+  for (auto row = first_row; row < first_row + chunk.size(); ++row) {
+    write_big_endian(&keys[row * key_width + key_width - sizeof(uint32_t)], static_cast<uint32_t>(row), false);
   }
+}
 
-  const std::shared_ptr<const Table> _table_in;
+void Sort::_write_string_ranks(const size_t definition_index, const size_t key_offset, const size_t key_width,
+                               const std::vector<RowID>& row_ids, std::vector<uint8_t>& keys) const {
+  const auto& definition = _sort_definitions[definition_index];
+  const auto null_byte = static_cast<uint8_t>(definition.nulls_first() ? 0u : 1u);
+  const auto value_byte = static_cast<uint8_t>(1u - null_byte);
+  const auto invert = definition.descending();
+
+  // The strings are not copied, but viewed where they are stored (in the dictionary for DictionaryColumns). Only the
+  // non-NULL rows are ranked, the value of NULLs stays zero.
+  auto accessor = ColumnAccessor<std::string>{_input_table_left(), definition.column_id};
+  auto strings = std::vector<std::pair<std::string_view, uint32_t>>{};
+  strings.reserve(row_ids.size());
+  for (auto row = size_t{0}; row < row_ids.size(); ++row) {
+    const auto is_value = accessor.with_value(row_ids[row], [&](const std::string_view value) {
+      strings.emplace_back(value, static_cast<uint32_t>(row));
+    });
+    keys[row * key_width + key_offset] = is_value ? value_byte : null_byte;
+  }
 
-  // column to sort by
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
-  // chunk size of the materialized output
-  const size_t _output_chunk_size;
+  std::sort(strings.begin(), strings.end());
 
-  std::shared_ptr<std::vector<RowIDValuePair>> _row_id_value_vector;
-  std::shared_ptr<std::vector<RowIDValuePair>> _null_value_rows;
-};
+  // Equal strings get the same rank
+  auto rank = uint32_t{0u};
+  for (auto index = size_t{0}; index < strings.size(); ++index) {
+    if (index > 0u && strings[index - 1u].first != strings[index].first) ++rank;
+    write_big_endian(&keys[strings[index].second * key_width + key_offset + 1u], rank, invert);
+  }
+}
+
+std::vector<uint32_t> Sort::_sort_rows(const std::vector<size_t>& first_row_per_chunk, const size_t key_width,
+                                       const std::vector<uint8_t>& keys) const {
+  const auto row_count = keys.size() / key_width;
+
+  const auto compare = [&](const uint32_t left, const uint32_t right) {
+    return std::memcmp(&keys[left * key_width], &keys[right * key_width], key_width) < 0;
+  };
+
+  auto rows = std::vector<uint32_t>(row_count);
+  std::iota(rows.begin(), rows.end(), uint32_t{0u});
+
+  // Each input chunk is a run, which is sorted on its own. The runs are delimited by run_bounds.
+  auto run_bounds = first_row_per_chunk;
+  run_bounds.push_back(row_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (auto run = size_t{0}; run + 1u < run_bounds.size(); ++run) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, run]() {
+      std::sort(rows.begin() + run_bounds[run], rows.begin() + run_bounds[run + 1u], compare);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  /*
+  Pairs of neighbouring runs are merged until a single run is left. So that the last merges, which only consist of a few
+  large pairs, are parallel, too, each pair is split into pieces of ROWS_PER_MERGE_TASK output rows. The rows of the two
+  runs that belong to a piece are found with a binary search along the diagonal of the merge matrix (merge path), so
+  that all pieces can be merged independently.
+  */
+  auto merged_rows = std::vector<uint32_t>(row_count);
+  while (run_bounds.size() > 2u) {
+    auto merged_run_bounds = std::vector<size_t>{};
+
+    jobs.clear();
+    for (auto run = size_t{0}; run + 1u < run_bounds.size(); run += 2u) {
+      const auto begin = run_bounds[run];
+      const auto middle = run_bounds[run + 1u];
+      // An odd run at the end is merged with an empty one, i.e., copied
+      const auto end = run + 2u < run_bounds.size() ? run_bounds[run + 2u] : middle;
+      merged_run_bounds.push_back(begin);
+
+      const auto* left = rows.data() + begin;
+      const auto* right = rows.data() + middle;
+      const auto left_size = middle - begin;
+      const auto right_size = end - middle;
+
+      for (auto piece_begin = size_t{0}; piece_begin < left_size + right_size; piece_begin += ROWS_PER_MERGE_TASK) {
+        const auto piece_end = std::min(piece_begin + ROWS_PER_MERGE_TASK, left_size + right_size);
+
+        jobs.emplace_back(std::make_shared<JobTask>([&, begin, left, right, left_size, right_size, piece_begin,
+                                                     piece_end]() {
+          const auto left_begin = merge_path(left, left_size, right, right_size, piece_begin, compare);
+          const auto left_end = merge_path(left, left_size, right, right_size, piece_end, compare);
+          const auto right_begin = piece_begin - left_begin;
+          const auto right_end = piece_end - left_end;
+
+          std::merge(left + left_begin, left + left_end, right + right_begin, right + right_end,
+                     merged_rows.begin() + begin + piece_begin, compare);
+        }));
+        jobs.back()->schedule();
+      }
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    merged_run_bounds.push_back(row_count);
+    run_bounds = std::move(merged_run_bounds);
+    std::swap(rows, merged_rows);
+  }
+
+  return rows;
+}
+
+Chunk Sort::_materialize_output_chunk(const std::vector<uint32_t>& sorted_rows, const std::vector<RowID>& row_ids,
+                                      const size_t first_sorted_row, const size_t row_count) const {
+  const auto input_table = _input_table_left();
+
+  // The values are copied column by column. The input columns (and the columns they reference) are resolved once per
+  // output chunk, when their first row is copied.
+  Chunk chunk_out;
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    const auto nullable = input_table->column_is_nullable(column_id);
+
+    resolve_data_type(input_table->column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto accessor = ColumnAccessor<ColumnDataType>{input_table, column_id};
+      auto values = pmr_concurrent_vector<ColumnDataType>{};
+      auto null_values = pmr_concurrent_vector<bool>{};
+      values.reserve(row_count);
+      if (nullable) null_values.reserve(row_count);
+
+      for (auto sorted_row = first_sorted_row; sorted_row < first_sorted_row + row_count; ++sorted_row) {
+        const auto is_value = accessor.with_value(row_ids[sorted_rows[sorted_row]], [&](const auto& value) {
+          values.push_back(ColumnDataType{value});
+        });
+
+        if (!is_value) {
+          Assert(nullable, "Sort: NULL in a column that is not nullable");
+          values.push_back(ColumnDataType{});
+        }
+        if (nullable) null_values.push_back(!is_value);
+      }
+
+      if (nullable) {
+        chunk_out.add_column(std::make_shared<ValueColumn<ColumnDataType>>(std::move(values), std::move(null_values)));
+      } else {
+        chunk_out.add_column(std::make_shared<ValueColumn<ColumnDataType>>(std::move(values)));
+      }
+    });
+  }
+
+  return chunk_out;
+}
 
 }  // namespace opossum
@@ -1,23 +1,35 @@
 #pragma once
 
-#include <algorithm>
-#include <functional>
 #include <memory>
 #include <string>
-#include <utility>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
-#include "resolve_type.hpp"
-#include "storage/iterables/create_iterable_from_column.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 /**
- * Operator to sort a table by a single column. This implements a stable sort, i.e., rows that share the same value will
+ * A column to sort by and its OrderByMode, which determines the direction and whether NULLs come first or last
+ */
+struct SortColumnDefinition {
+  SortColumnDefinition(const ColumnID column_id, const OrderByMode order_by_mode = OrderByMode::Ascending);
+
+  bool nulls_first() const;
+  bool descending() const;
+
+  ColumnID column_id;
+  OrderByMode order_by_mode;
+};
+
+/**
+ * Operator to sort a table by one or more columns. The first column is the primary criterion, every further column
+ * breaks the ties of the columns before it. This implements a stable sort, i.e., rows that share the same values will
  * maintain their relative order.
- * Multi-column sort is not supported yet. For now, you will have to sort by the secondary criterion, then by the first
+ *
+ * The values of the sort columns of each row are encoded into a normalized key that can be compared with memcmp (see
+ * sort.cpp). The rows of each input chunk are sorted by these keys in parallel, and the sorted runs are then merged
+ * pairwise, again in parallel. Large pairs are split into pieces that are merged independently.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
@@ -25,6 +37,12 @@ class Sort : public AbstractReadOnlyOperator {
   Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
        const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = Chunk::MAX_SIZE);
 
+  Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t output_chunk_size = Chunk::MAX_SIZE);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+  // The primary sort column and its OrderByMode
   ColumnID column_id() const;
   OrderByMode order_by_mode() const;
 
@@ -33,21 +51,29 @@ class Sort : public AbstractReadOnlyOperator {
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
-  void _on_cleanup() override;
-
-  // The operator is separated in three different classes. SortImpl is the common templated implementation of the
-  // operator. SortImpl* und SortImplMaterializeOutput are extra classes for the visitor pattern. They fulfill a certain
-  // task during the Sort process, as described later on.
-  template <typename SortColumnType>
-  class SortImpl;
-  template <typename SortColumnType>
-  class SortImplMaterializeSortColumn;
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
-
-  std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
+
+  // Writes the normalized keys of the rows of one chunk, starting at first_row (see sort.cpp for the layout). The parts
+  // of string columns are left to _write_string_ranks.
+  void _write_keys(const ChunkID chunk_id, const size_t first_row, const std::vector<size_t>& key_offsets,
+                   const size_t key_width, std::vector<uint8_t>& keys) const;
+
+  // Writes the ranks of the strings of a sort column into the keys, so that strings have a fixed width, too
+  void _write_string_ranks(const size_t definition_index, const size_t key_offset, const size_t key_width,
+                           const std::vector<RowID>& row_ids, std::vector<uint8_t>& keys) const;
+
+  // Sorts the rows by their keys
+  std::vector<uint32_t> _sort_rows(const std::vector<size_t>& first_row_per_chunk, const size_t key_width,
+                                   const std::vector<uint8_t>& keys) const;
+
+  // Copies the rows row_ids[sorted_rows[0]], row_ids[sorted_rows[1]], ... into the chunks of the output table
+  void _materialize_output(Table& output, const std::vector<uint32_t>& sorted_rows,
+                           const std::vector<RowID>& row_ids) const;
+
+  // Copies the sorted rows into the output chunk starting at the given position of the sorted rows
+  Chunk _materialize_output_chunk(const std::vector<uint32_t>& sorted_rows, const std::vector<RowID>& row_ids,
+                                  const size_t first_sorted_row, const size_t row_count) const;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
   const size_t _output_chunk_size;
 };
 
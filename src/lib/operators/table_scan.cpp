@@ -1,8 +1,8 @@
 #include "table_scan.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <string>
 #include <utility>
@@ -10,14 +10,13 @@
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "scheduler/job_task.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "storage/base_column.hpp"
 #include "storage/chunk.hpp"
 #include "storage/proxy_chunk.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/table.hpp"
+#include "storage/zone_map.hpp"
 #include "table_scan/column_comparison_table_scan_impl.hpp"
 #include "table_scan/is_null_table_scan_impl.hpp"
 #include "table_scan/like_table_scan_impl.hpp"
@@ -28,167 +27,293 @@
 
 namespace opossum {
 
+TableScanPredicate::TableScanPredicate(const ColumnID left_column_id, const ScanType scan_type,
+                                       const AllParameterVariant& right_parameter)
+    : left_column_id{left_column_id}, scan_type{scan_type}, right_parameter{right_parameter} {}
+
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID left_column_id,
                      const ScanType scan_type, const AllParameterVariant right_parameter)
-    : AbstractReadOnlyOperator{in},
-      _left_column_id{left_column_id},
-      _scan_type{scan_type},
-      _right_parameter{right_parameter} {}
+    : TableScan{in, {TableScanPredicate{left_column_id, scan_type, right_parameter}}} {}
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in,
+                     const std::vector<TableScanPredicate>& predicates)
+    : AbstractPipelineOperator{in}, _predicates{predicates} {
+  Assert(!_predicates.empty(), "TableScan needs at least one predicate.");
+}
 
 TableScan::~TableScan() = default;
 
-ColumnID TableScan::left_column_id() const { return _left_column_id; }
+const std::vector<TableScanPredicate>& TableScan::predicates() const { return _predicates; }
 
-ScanType TableScan::scan_type() const { return _scan_type; }
+ColumnID TableScan::left_column_id() const { return _predicates.front().left_column_id; }
 
-const AllParameterVariant& TableScan::right_parameter() const { return _right_parameter; }
+ScanType TableScan::scan_type() const { return _predicates.front().scan_type; }
+
+const AllParameterVariant& TableScan::right_parameter() const { return _predicates.front().right_parameter; }
 
 const std::string TableScan::name() const { return "TableScan"; }
 
 const std::string TableScan::description() const {
-  std::string column_name = std::string("Col #") + std::to_string(_left_column_id);
+  auto predicates_string = std::string{};
+
+  for (const auto& predicate : _predicates) {
+    std::string column_name = std::string("Col #") + std::to_string(predicate.left_column_id);
 
-  if (_input_table_left()) column_name = _input_table_left()->column_name(_left_column_id);
+    if (_input_table_left()) column_name = _input_table_left()->column_name(predicate.left_column_id);
 
-  std::string predicate_string = to_string(_right_parameter);
+    if (!predicates_string.empty()) predicates_string += " AND ";
+    predicates_string += column_name + " " + scan_type_to_string.left.at(predicate.scan_type) + " " +
+                         to_string(predicate.right_parameter);
+  }
 
-  return name() + "\\n(" + column_name + " " + scan_type_to_string.left.at(_scan_type) + " " + predicate_string + ")";
+  return name() + "\\n(" + predicates_string + ")";
 }
 
 std::shared_ptr<AbstractOperator> TableScan::recreate(const std::vector<AllParameterVariant>& args) const {
-  // Replace value in the new operator, if it’s a parameter and an argument is available.
-  if (is_placeholder(_right_parameter)) {
-    const auto index = boost::get<ValuePlaceholder>(_right_parameter).index();
-    if (index < args.size()) {
-      return std::make_shared<TableScan>(_input_left->recreate(args), _left_column_id, _scan_type, args[index]);
+  // Replace values in the new operator, if they are parameters and arguments are available.
+  auto predicates = _predicates;
+  for (auto& predicate : predicates) {
+    if (is_placeholder(predicate.right_parameter)) {
+      const auto index = boost::get<ValuePlaceholder>(predicate.right_parameter).index();
+      if (index < args.size()) predicate.right_parameter = args[index];
     }
   }
-  return std::make_shared<TableScan>(_input_left->recreate(args), _left_column_id, _scan_type, _right_parameter);
+  return std::make_shared<TableScan>(_input_left->recreate(args), predicates);
 }
 
-std::shared_ptr<const Table> TableScan::_on_execute() {
-  _in_table = _input_table_left();
+std::vector<ChunkID> TableScan::_chunks_to_process(const Table& input_table) const {
+  auto chunk_ids = std::vector<ChunkID>{};
+  for (ChunkID chunk_id{0u}; chunk_id < input_table.chunk_count(); ++chunk_id) {
+    if (!_can_prune(input_table, chunk_id)) chunk_ids.emplace_back(chunk_id);
+  }
+  return chunk_ids;
+}
 
-  _init_scan();
+Chunk TableScan::_create_empty_chunk(const std::shared_ptr<const Table>& input_table) const {
+  // The columns of a reference table are resolved through its first chunk, so that they reference its referenced
+  // columns
+  const auto empty_pos_list = std::make_shared<PosList>();
+  const auto& first_chunk_in = input_table->get_chunk(ChunkID{0});
+  auto chunk_out = Chunk{};
+  for (ColumnID column_id{0u}; column_id < input_table->column_count(); ++column_id) {
+    if (input_table->get_type() == TableType::Data) {
+      chunk_out.add_column(std::make_shared<ReferenceColumn>(input_table, column_id, empty_pos_list));
+    } else {
+      const auto ref_column = std::static_pointer_cast<const ReferenceColumn>(first_chunk_in.get_column(column_id));
+      chunk_out.add_column(std::make_shared<ReferenceColumn>(ref_column->referenced_table(),
+                                                             ref_column->referenced_column_id(), empty_pos_list));
+    }
+  }
+  return chunk_out;
+}
 
-  _output_table = Table::create_with_layout_from(_in_table);
+std::vector<Chunk> TableScan::_process_morsel(
+    const std::shared_ptr<const Table>& input_table, const Morsel& morsel,
+    const std::shared_ptr<TransactionContext>& /*transaction_context*/) const {
+  // The impls are bound to the input table, which differs between the morsels of a pipeline
+  auto impls = Impls{};
+  for (const auto& predicate : _predicates) {
+    impls.emplace_back(_create_impl(input_table, predicate));
+  }
 
-  std::mutex output_mutex;
+  auto matches_per_range = std::vector<PosList>(morsel.ranges.size());
+  for (auto range_index = size_t{0u}; range_index < morsel.ranges.size(); ++range_index) {
+    matches_per_range[range_index] = _scan_range(*input_table, impls, morsel.ranges[range_index]);
+  }
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(_in_table->chunk_count());
+  // The output chunks are allocated on the same NUMA node as the input chunks. Also, the AccessCounter is reused to
+  // track accesses of the output chunk. Accesses of derived chunks are counted towards the original chunk.
+  const auto& first_chunk_in = input_table->get_chunk(morsel.ranges.front().chunk_id);
 
-  for (ChunkID chunk_id{0u}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
-    auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
-      const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = std::make_shared<PosList>(_impl->scan_chunk(chunk_id));
+  // If this is not a reference table, the matches directly reference the input table, even across chunks
+  if (input_table->get_type() == TableType::Data) {
+    auto matches_out = std::make_shared<PosList>();
+    for (const auto& matches : matches_per_range) {
+      matches_out->insert(matches_out->end(), matches.cbegin(), matches.cend());
+    }
 
-      // The output chunk is allocated on the same NUMA node as the input chunk. Also, the AccessCounter is
-      // reused to track accesses of the output chunk. Accesses of derived chunks are counted towards the
-      // original chunk.
-      Chunk chunk_out(chunk_guard->get_allocator(), chunk_guard->access_counter());
+    auto chunks_out = std::vector<Chunk>{};
+    auto& chunk_out = chunks_out.emplace_back(first_chunk_in.get_allocator(), first_chunk_in.access_counter());
+    for (ColumnID column_id{0u}; column_id < input_table->column_count(); ++column_id) {
+      chunk_out.add_column(std::make_shared<ReferenceColumn>(input_table, column_id, matches_out));
+    }
+    return chunks_out;
+  }
 
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference columns of the output. If it is a reference column,
-       * we need to resolve the row IDs so that they reference the physical data columns (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between columns as much as possible. Position lists can be shared between two columns iff
-       * (a) they point to the same table and
-       * (b) the reference columns of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (_in_table->get_type() == TableType::References) {
-        const auto& chunk_in = _in_table->get_chunk(chunk_id);
+  /**
+   * If it is a reference table, we need to resolve the row IDs so that they reference the physical data columns
+   * (value, dictionary) instead, since we don’t allow multi-level referencing. The ranges of chunks whose columns
+   * reference the same columns share an output chunk. To save time and space, we want to share position lists between
+   * columns as much as possible. Position lists can be shared between two columns iff
+   * (a) they point to the same table and
+   * (b) the reference columns of the input table point to the same positions in the same order
+   *     (i.e. they share their position list) in all of the ranges.
+   */
+  const auto reference_column = [&](const ChunkRange& range, const ColumnID column_id) {
+    const auto column = input_table->get_chunk(range.chunk_id).get_column(column_id);
+    const auto ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(column);
+    DebugAssert(ref_column != nullptr, "All columns should be of type ReferenceColumn.");
+    return ref_column;
+  };
+
+  const auto reference_same_columns = [&](const ChunkRange& left_range, const ChunkRange& right_range) {
+    for (ColumnID column_id{0u}; column_id < input_table->column_count(); ++column_id) {
+      const auto left_column = reference_column(left_range, column_id);
+      const auto right_column = reference_column(right_range, column_id);
+      if (left_column->referenced_table() != right_column->referenced_table() ||
+          left_column->referenced_column_id() != right_column->referenced_column_id()) {
+        return false;
+      }
+    }
+    return true;
+  };
 
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+  auto chunks_out = std::vector<Chunk>{};
 
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto column_in = chunk_in.get_column(column_id);
+  auto group_end = size_t{0u};
+  for (auto group_begin = size_t{0u}; group_begin < morsel.ranges.size(); group_begin = group_end) {
+    group_end = group_begin + 1u;
+    while (group_end < morsel.ranges.size() &&
+           reference_same_columns(morsel.ranges[group_begin], morsel.ranges[group_end])) {
+      ++group_end;
+    }
 
-          auto ref_column_in = std::dynamic_pointer_cast<const ReferenceColumn>(column_in);
-          DebugAssert(ref_column_in != nullptr, "All columns should be of type ReferenceColumn.");
+    auto match_count = size_t{0u};
+    for (auto range_index = group_begin; range_index < group_end; ++range_index) {
+      match_count += matches_per_range[range_index].size();
+    }
 
-          const auto pos_list_in = ref_column_in->pos_list();
+    auto& chunk_out = chunks_out.emplace_back(first_chunk_in.get_allocator(), first_chunk_in.access_counter());
+    auto filtered_pos_lists = std::map<std::vector<std::shared_ptr<const PosList>>, std::shared_ptr<PosList>>{};
 
-          const auto table_out = ref_column_in->referenced_table();
-          const auto column_id_out = ref_column_in->referenced_column_id();
+    for (ColumnID column_id{0u}; column_id < input_table->column_count(); ++column_id) {
+      auto pos_lists_in = std::vector<std::shared_ptr<const PosList>>{};
+      for (auto range_index = group_begin; range_index < group_end; ++range_index) {
+        pos_lists_in.emplace_back(reference_column(morsel.ranges[range_index], column_id)->pos_list());
+      }
 
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+      auto& filtered_pos_list = filtered_pos_lists[pos_lists_in];
 
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>();
-            filtered_pos_list->reserve(matches_out->size());
+      if (!filtered_pos_list) {
+        filtered_pos_list = std::make_shared<PosList>();
+        filtered_pos_list->reserve(match_count);
 
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              filtered_pos_list->push_back(row_id);
-            }
+        for (auto range_index = group_begin; range_index < group_end; ++range_index) {
+          const auto& pos_list_in = *pos_lists_in[range_index - group_begin];
+          for (const auto& match : matches_per_range[range_index]) {
+            filtered_pos_list->push_back(pos_list_in[match.chunk_offset]);
           }
-
-          auto ref_column_out = std::make_shared<ReferenceColumn>(table_out, column_id_out, filtered_pos_list);
-          chunk_out.add_column(ref_column_out);
-        }
-      } else {
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out);
-          chunk_out.add_column(ref_column_out);
         }
       }
 
-      std::lock_guard<std::mutex> lock(output_mutex);
-      if (chunk_out.size() > 0 || _output_table->get_chunk(ChunkID{0}).size() == 0) {
-        _output_table->emplace_chunk(std::move(chunk_out));
-      }
-    });
+      const auto first_column_in = reference_column(morsel.ranges[group_begin], column_id);
+      chunk_out.add_column(std::make_shared<ReferenceColumn>(first_column_in->referenced_table(),
+                                                             first_column_in->referenced_column_id(),
+                                                             filtered_pos_list));
+    }
+  }
 
-    jobs.push_back(job_task);
-    job_task->schedule();
+  return chunks_out;
+}
+
+PosList TableScan::_scan_range(const Table& input_table, const Impls& impls, const ChunkRange& range) {
+  const auto chunk_guard = input_table.get_chunk_with_access_counting(range.chunk_id);
+
+  // The actual scan happens in the sub classes of BaseTableScanImpl. Every predicate after the first one only checks
+  // the rows that matched so far. Ranges that do not cover the whole chunk are scanned like a selection of rows.
+  auto matches = PosList{};
+  if (range.covers_chunk(input_table)) {
+    matches = impls.front()->scan_chunk(range.chunk_id);
+  } else {
+    auto selection = PosList(range.size());
+    for (auto chunk_offset = range.begin; chunk_offset < range.end; ++chunk_offset) {
+      selection[chunk_offset - range.begin] = RowID{range.chunk_id, chunk_offset};
+    }
+    matches = impls.front()->scan_chunk(range.chunk_id, selection);
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  for (auto impl_it = impls.cbegin() + 1; impl_it != impls.cend() && !matches.empty(); ++impl_it) {
+    matches = (*impl_it)->scan_chunk(range.chunk_id, matches);
+  }
 
-  return _output_table;
+  return matches;
 }
 
-void TableScan::_on_cleanup() { _impl.reset(); }
+bool TableScan::_can_prune(const Table& input_table, const ChunkID chunk_id) const {
+  // Chunks whose zone map rules out any match are skipped
+  const auto& chunk = input_table.get_chunk(chunk_id);
 
-void TableScan::_init_scan() {
-  DebugAssert(_in_table->chunk_count() > 0u, "Input table must contain at least 1 chunk.");
+  return std::any_of(_predicates.cbegin(), _predicates.cend(), [&](const auto& predicate) {
+    if (!is_variant(predicate.right_parameter)) return false;
+    const auto& right_value = boost::get<AllTypeVariant>(predicate.right_parameter);
+
+    if (input_table.get_type() == TableType::Data) {
+      const auto zone_maps = chunk.zone_maps();
+      return zone_maps && zone_maps->columns[predicate.left_column_id]->can_prune(predicate.scan_type, right_value);
+    }
 
-  if (_scan_type == ScanType::OpLike || _scan_type == ScanType::OpNotLike) {
-    const auto left_column_type = _in_table->column_type(_left_column_id);
+    /**
+     * Chunks of reference tables do not have zone maps. Instead, the zone maps of all chunks referenced by the column
+     * have to rule out any match. Usually, all positions reference the same chunk, and if it cannot be pruned, only
+     * the first position is looked at.
+     */
+    const auto column = chunk.get_column(predicate.left_column_id);
+    const auto ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(column);
+    if (!ref_column) return false;
+
+    const auto& referenced_table = *ref_column->referenced_table();
+    const auto referenced_column_id = ref_column->referenced_column_id();
+    auto previous_chunk_id = std::optional<ChunkID>{};
+    for (const auto& row_id : *ref_column->pos_list()) {
+      // NULLs of outer joins are not covered by any zone map
+      if (row_id.chunk_offset == INVALID_CHUNK_OFFSET) return false;
+      if (row_id.chunk_id == previous_chunk_id) continue;
+
+      const auto zone_maps = referenced_table.get_chunk(row_id.chunk_id).zone_maps();
+      if (!zone_maps || !zone_maps->columns[referenced_column_id]->can_prune(predicate.scan_type, right_value)) {
+        return false;
+      }
+      previous_chunk_id = row_id.chunk_id;
+    }
+    return true;
+  });
+}
+
+std::unique_ptr<BaseTableScanImpl> TableScan::_create_impl(const std::shared_ptr<const Table>& input_table,
+                                                           const TableScanPredicate& predicate) const {
+  const auto left_column_id = predicate.left_column_id;
+  const auto scan_type = predicate.scan_type;
+  const auto& right_parameter = predicate.right_parameter;
+
+  if (scan_type == ScanType::OpLike || scan_type == ScanType::OpNotLike) {
+    const auto left_column_type = input_table->column_type(left_column_id);
     Assert((left_column_type == DataType::String), "LIKE operator only applicable on string columns.");
 
-    DebugAssert(is_variant(_right_parameter), "Right parameter must be variant.");
+    DebugAssert(is_variant(right_parameter), "Right parameter must be variant.");
 
-    const auto right_value = boost::get<AllTypeVariant>(_right_parameter);
+    const auto right_value = boost::get<AllTypeVariant>(right_parameter);
 
     DebugAssert(!variant_is_null(right_value), "Right value must not be NULL.");
 
     const auto right_wildcard = type_cast<std::string>(right_value);
 
-    _impl = std::make_unique<LikeTableScanImpl>(_in_table, _left_column_id, _scan_type, right_wildcard);
-
-    return;
+    return std::make_unique<LikeTableScanImpl>(input_table, left_column_id, scan_type, right_wildcard);
   }
 
-  if (is_variant(_right_parameter)) {
-    const auto right_value = boost::get<AllTypeVariant>(_right_parameter);
+  if (is_variant(right_parameter)) {
+    const auto right_value = boost::get<AllTypeVariant>(right_parameter);
 
     if (variant_is_null(right_value)) {
-      _impl = std::make_unique<IsNullTableScanImpl>(_in_table, _left_column_id, _scan_type);
-
-      return;
+      return std::make_unique<IsNullTableScanImpl>(input_table, left_column_id, scan_type);
     }
 
-    _impl = std::make_unique<SingleColumnTableScanImpl>(_in_table, _left_column_id, _scan_type, right_value);
-  } else /* is_column_name(_right_parameter) */ {
-    const auto right_column_id = boost::get<ColumnID>(_right_parameter);
-
-    _impl = std::make_unique<ColumnComparisonTableScanImpl>(_in_table, _left_column_id, _scan_type, right_column_id);
+    return std::make_unique<SingleColumnTableScanImpl>(input_table, left_column_id, scan_type, right_value);
   }
+
+  /* is_column_name(right_parameter) */
+  const auto right_column_id = boost::get<ColumnID>(right_parameter);
+
+  return std::make_unique<ColumnComparisonTableScanImpl>(input_table, left_column_id, scan_type, right_column_id);
 }
 
 }  // namespace opossum
@@ -5,7 +5,7 @@
 #include <string>
 #include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_pipeline_operator.hpp"
 #include "all_parameter_variant.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -13,15 +13,47 @@
 namespace opossum {
 
 class BaseTableScanImpl;
+class Chunk;
 class Table;
+struct ChunkRange;
+struct Morsel;
 
-class TableScan : public AbstractReadOnlyOperator {
+/**
+ * A predicate of a TableScan, i.e., <left_column_id> <scan_type> <right_parameter>
+ */
+struct TableScanPredicate {
+  TableScanPredicate(const ColumnID left_column_id, const ScanType scan_type,
+                     const AllParameterVariant& right_parameter);
+
+  ColumnID left_column_id;
+  ScanType scan_type;
+  AllParameterVariant right_parameter;
+};
+
+/**
+ * Selects the rows of a table that satisfy one or more predicates, i.e., a conjunction of predicates.
+ *
+ * The input is scanned in morsels (see MorselDispatcher), and each morsel yields one output chunk. The predicates are
+ * evaluated range by range in the given order. The first predicate scans all rows of the range, every further
+ * predicate only looks at the rows that satisfied all predicates before it (see BaseTableScanImpl). Hence, the most
+ * selective predicate should come first. The LQPTranslator fuses chains of PredicateNodes into one TableScan,
+ * which the PredicateReorderingRule has ordered by their estimated selectivity before.
+ *
+ * TableScans can be fused into pipelines with Validates, Projections, and other TableScans (see
+ * AbstractPipelineOperator).
+ */
+class TableScan : public AbstractPipelineOperator {
  public:
   TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID left_column_id, const ScanType scan_type,
             const AllParameterVariant right_parameter);
 
+  TableScan(const std::shared_ptr<const AbstractOperator> in, const std::vector<TableScanPredicate>& predicates);
+
   ~TableScan();
 
+  const std::vector<TableScanPredicate>& predicates() const;
+
+  // The first predicate
   ColumnID left_column_id() const;
   ScanType scan_type() const;
   const AllParameterVariant& right_parameter() const;
@@ -32,19 +64,28 @@ class TableScan : public AbstractReadOnlyOperator {
   std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const override;
 
  protected:
-  std::shared_ptr<const Table> _on_execute() override;
-  void _on_cleanup() override;
+  using Impls = std::vector<std::unique_ptr<BaseTableScanImpl>>;
 
-  void _init_scan();
+  std::vector<ChunkID> _chunks_to_process(const Table& input_table) const override;
 
- private:
-  const ColumnID _left_column_id;
-  const ScanType _scan_type;
-  const AllParameterVariant _right_parameter;
+  // Processes one morsel and returns its output chunks, usually only one
+  std::vector<Chunk> _process_morsel(const std::shared_ptr<const Table>& input_table, const Morsel& morsel,
+                                     const std::shared_ptr<TransactionContext>& transaction_context) const override;
 
-  std::shared_ptr<const Table> _in_table;
-  std::unique_ptr<BaseTableScanImpl> _impl;
-  std::shared_ptr<Table> _output_table;
+  Chunk _create_empty_chunk(const std::shared_ptr<const Table>& input_table) const override;
+
+  std::unique_ptr<BaseTableScanImpl> _create_impl(const std::shared_ptr<const Table>& input_table,
+                                                  const TableScanPredicate& predicate) const;
+
+  // Returns true if the zone maps of the chunk, or of the chunks referenced by it, show that one of the predicates
+  // matches none of its rows
+  bool _can_prune(const Table& input_table, const ChunkID chunk_id) const;
+
+  // Returns the rows of the range that satisfy all predicates
+  static PosList _scan_range(const Table& input_table, const Impls& impls, const ChunkRange& range);
+
+ private:
+  const std::vector<TableScanPredicate> _predicates;
 };
 
 }  // namespace opossum
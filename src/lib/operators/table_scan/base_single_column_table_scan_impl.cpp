@@ -30,14 +30,42 @@ PosList BaseSingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
   return matches_out;
 }
 
+PosList BaseSingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id, const PosList& selection) {
+  const auto& chunk = _in_table->get_chunk(chunk_id);
+  const auto left_column = chunk.get_column(_left_column_id);
+
+  auto matches_out = PosList{};
+
+  if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(left_column)) {
+    auto chunk_offsets_by_chunk_id =
+        split_pos_list_by_chunk_id(*reference_column->pos_list(), selection, _skip_null_row_ids);
+    _visit_referenced_columns(*reference_column, chunk_offsets_by_chunk_id, chunk_id, matches_out);
+    return matches_out;
+  }
+
+  auto mapped_chunk_offsets = std::make_unique<ChunkOffsetsList>();
+  mapped_chunk_offsets->reserve(selection.size());
+  for (const auto& row_id : selection) {
+    mapped_chunk_offsets->push_back({row_id.chunk_offset, row_id.chunk_offset});
+  }
+
+  auto context = std::make_shared<Context>(chunk_id, matches_out, std::move(mapped_chunk_offsets));
+  left_column->visit(*this, context);
+
+  return matches_out;
+}
+
 void BaseSingleColumnTableScanImpl::handle_reference_column(const ReferenceColumn& left_column,
                                                             std::shared_ptr<ColumnVisitableContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
-  const ChunkID chunk_id = context->_chunk_id;
-  auto& matches_out = context->_matches_out;
 
   auto chunk_offsets_by_chunk_id = split_pos_list_by_chunk_id(*left_column.pos_list(), _skip_null_row_ids);
+  _visit_referenced_columns(left_column, chunk_offsets_by_chunk_id, context->_chunk_id, context->_matches_out);
+}
 
+void BaseSingleColumnTableScanImpl::_visit_referenced_columns(const ReferenceColumn& left_column,
+                                                              ChunkOffsetsByChunkID& chunk_offsets_by_chunk_id,
+                                                              const ChunkID chunk_id, PosList& matches_out) {
   // Visit each referenced column
   for (auto& pair : chunk_offsets_by_chunk_id) {
     const auto& referenced_chunk_id = pair.first;
@@ -7,9 +7,11 @@
 #include "base_table_scan_impl.hpp"
 
 #include "storage/column_visitable.hpp"
+#include "storage/iterables/chunk_offset_mapping.hpp"
 #include "storage/iterables/base_iterators.hpp"
 
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -29,6 +31,9 @@ class BaseSingleColumnTableScanImpl : public BaseTableScanImpl, public ColumnVis
 
   PosList scan_chunk(ChunkID chunk_id) override;
 
+  // Visits the column with the selected chunk offsets mapped, like a reference column that only has those rows
+  PosList scan_chunk(ChunkID chunk_id, const PosList& selection) override;
+
   void handle_reference_column(const ReferenceColumn& left_column,
                                std::shared_ptr<ColumnVisitableContext> base_context) override;
 
@@ -48,7 +53,38 @@ class BaseSingleColumnTableScanImpl : public BaseTableScanImpl, public ColumnVis
     std::unique_ptr<ChunkOffsetsList> _mapped_chunk_offsets;
   };
 
+  /**
+   * @brief Evaluates run_matches once per run of a run-length encoded column and adds all rows of the matching runs
+   *
+   * Can only be used if the column is visited directly, i.e., if no chunk offsets are mapped.
+   */
+  template <typename RunPredicate>
+  void _add_matching_runs(const BaseRunLengthColumn& column, const RunPredicate& run_matches, Context& context) {
+    DebugAssert(!context._mapped_chunk_offsets, "Runs can only be added if no chunk offsets are mapped.");
+
+    auto& matches_out = context._matches_out;
+    const auto chunk_id = context._chunk_id;
+    const auto& end_positions = *column.end_positions();
+
+    auto run_begin = ChunkOffset{0u};
+    for (auto run_index = size_t{0u}; run_index < end_positions.size(); ++run_index) {
+      const auto run_end = end_positions[run_index];
+
+      if (run_matches(run_index)) {
+        for (auto chunk_offset = run_begin; chunk_offset <= run_end; ++chunk_offset) {
+          matches_out.push_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+
+      run_begin = run_end + 1u;
+    }
+  }
+
  private:
+  // Visits the columns referenced by left_column at the given chunk offsets
+  void _visit_referenced_columns(const ReferenceColumn& left_column, ChunkOffsetsByChunkID& chunk_offsets_by_chunk_id,
+                                 const ChunkID chunk_id, PosList& matches_out);
+
   const bool _skip_null_row_ids;  // see chunk_offset_mapping.hpp for explanation
 };
 
@@ -22,6 +22,13 @@ class BaseTableScanImpl {
 
   virtual PosList scan_chunk(ChunkID chunk_id) = 0;
 
+  /**
+   * Scans only the rows of the chunk that are in selection, i.e., a list of RowIDs into that chunk, and returns those
+   * that match. The TableScan uses this for every predicate but the first one. Implementations only look at the
+   * selected rows instead of scanning the whole chunk.
+   */
+  virtual PosList scan_chunk(ChunkID chunk_id, const PosList& selection) = 0;
+
  protected:
   /**
    * @defgroup The hot loops of the table scan
@@ -20,7 +20,23 @@ ColumnComparisonTableScanImpl::ColumnComparisonTableScanImpl(std::shared_ptr<con
                                                              const ColumnID right_column_id)
     : BaseTableScanImpl{in_table, left_column_id, scan_type}, _right_column_id{right_column_id} {}
 
-PosList ColumnComparisonTableScanImpl::scan_chunk(ChunkID chunk_id) {
+PosList ColumnComparisonTableScanImpl::scan_chunk(ChunkID chunk_id) { return _scan_chunk(chunk_id, nullptr); }
+
+PosList ColumnComparisonTableScanImpl::scan_chunk(ChunkID chunk_id, const PosList& selection) {
+  /**
+   * The selected rows are mapped onto themselves. For reference columns, into_referenced is an index into their
+   * position lists (see ReferenceColumnIterable), so the same mapping works for both kinds of columns.
+   */
+  auto mapped_chunk_offsets = ChunkOffsetsList{};
+  mapped_chunk_offsets.reserve(selection.size());
+  for (const auto& row_id : selection) {
+    mapped_chunk_offsets.push_back({row_id.chunk_offset, row_id.chunk_offset});
+  }
+
+  return _scan_chunk(chunk_id, &mapped_chunk_offsets);
+}
+
+PosList ColumnComparisonTableScanImpl::_scan_chunk(ChunkID chunk_id, const ChunkOffsetsList* mapped_chunk_offsets) {
   const auto& chunk = _in_table->get_chunk(chunk_id);
   const auto left_column_type = _in_table->column_type(_left_column_id);
   const auto right_column_type = _in_table->column_type(_right_column_id);
@@ -40,12 +56,12 @@ PosList ColumnComparisonTableScanImpl::scan_chunk(ChunkID chunk_id) {
 
       /**
        * This generic lambda is instantiated for each type (int, long, etc.) and
-       * each column type (value, dictionary, reference column) per column!
-       * That’s 3x5 combinations each and 15x15=225 in total. However, not all combinations are valid or possible.
-       * Only data columns (value, dictionary) or reference columns will be compared, as a table with both data and
-       * reference columns is ruled out. Moreover it is not possible to compare strings to any of the four numerical
-       * data types. Therefore, we need to check for these cases and exclude them via the constexpr-if which
-       * reduces the number of combinations to 85.
+       * each column type (value, dictionary, run-length, reference column) per column!
+       * That’s 4x5 combinations each and 20x20=400 in total. However, not all combinations are valid or possible.
+       * Only data columns (value, dictionary, run-length) or reference columns will be compared, as a table with both
+       * data and reference columns is ruled out. Moreover it is not possible to compare strings to any of the four
+       * numerical data types. Therefore, we need to check for these cases and exclude them via the constexpr-if which
+       * reduces the number of combinations to 170.
        */
 
       constexpr auto left_is_reference_column = (std::is_same<LeftColumnType, ReferenceColumn>{});
@@ -66,8 +82,8 @@ PosList ColumnComparisonTableScanImpl::scan_chunk(ChunkID chunk_id) {
         auto left_column_iterable = create_iterable_from_column<LeftType>(typed_left_column);
         auto right_column_iterable = create_iterable_from_column<RightType>(typed_right_column);
 
-        left_column_iterable.with_iterators([&](auto left_it, auto left_end) {
-          right_column_iterable.with_iterators([&](auto right_it, auto right_end) {
+        left_column_iterable.with_iterators(mapped_chunk_offsets, [&](auto left_it, auto left_end) {
+          right_column_iterable.with_iterators(mapped_chunk_offsets, [&](auto right_it, auto right_end) {
             with_comparator(_scan_type, [&](auto comparator) {
               this->_binary_scan(comparator, left_it, left_end, right_it, chunk_id, matches_out);
             });
@@ -4,6 +4,8 @@
 
 #include "base_table_scan_impl.hpp"
 
+#include "storage/iterables/chunk_offset_mapping.hpp"
+
 #include "types.hpp"
 
 namespace opossum {
@@ -29,6 +31,12 @@ class ColumnComparisonTableScanImpl : public BaseTableScanImpl {
 
   PosList scan_chunk(ChunkID chunk_id) override;
 
+  // Iterates over both columns with the selected chunk offsets mapped
+  PosList scan_chunk(ChunkID chunk_id, const PosList& selection) override;
+
+ private:
+  PosList _scan_chunk(ChunkID chunk_id, const ChunkOffsetsList* mapped_chunk_offsets);
+
  private:
   const ColumnID _right_column_id;
 };
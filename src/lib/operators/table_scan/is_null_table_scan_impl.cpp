@@ -3,6 +3,8 @@
 #include <memory>
 
 #include "storage/base_dictionary_column.hpp"
+#include "storage/base_frame_of_reference_column.hpp"
+#include "storage/base_run_length_column.hpp"
 #include "storage/base_value_column.hpp"
 #include "storage/iterables/attribute_vector_iterable.hpp"
 #include "storage/iterables/null_value_vector_iterable.hpp"
@@ -51,6 +53,48 @@ void IsNullTableScanImpl::handle_dictionary_column(const BaseDictionaryColumn& b
                                       [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
 }
 
+void IsNullTableScanImpl::handle_run_length_column(const BaseRunLengthColumn& base_column,
+                                                   std::shared_ptr<ColumnVisitableContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
+  auto& left_column = static_cast<const BaseRunLengthColumn&>(base_column);
+
+  const auto& null_values = *left_column.null_values();
+  const auto& end_positions = *left_column.end_positions();
+
+  _resolve_scan_type([&](auto comparator) {
+    if (!mapped_chunk_offsets) {
+      this->_add_matching_runs(left_column, [&](const size_t run_index) { return comparator(null_values[run_index]); },
+                               *context);
+      return;
+    }
+
+    auto& matches_out = context->_matches_out;
+    const auto chunk_id = context->_chunk_id;
+
+    for (const auto& chunk_offsets : *mapped_chunk_offsets) {
+      const auto is_null = chunk_offsets.into_referenced == INVALID_CHUNK_OFFSET ||
+                           null_values[BaseRunLengthColumn::run_index(end_positions, chunk_offsets.into_referenced)];
+
+      if (!comparator(is_null)) continue;
+      matches_out.push_back(RowID{chunk_id, chunk_offsets.into_referencing});
+    }
+  });
+}
+
+void IsNullTableScanImpl::handle_frame_of_reference_column(const BaseFrameOfReferenceColumn& base_column,
+                                                           std::shared_ptr<ColumnVisitableContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
+  auto& left_column = static_cast<const BaseFrameOfReferenceColumn&>(base_column);
+
+  // Null values are stored as NULL_VALUE_ID in the offsets, just like in the attribute vector of dictionary columns
+  auto left_column_iterable = AttributeVectorIterable{*left_column.offsets()};
+
+  left_column_iterable.with_iterators(mapped_chunk_offsets.get(),
+                                      [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
+}
+
 bool IsNullTableScanImpl::_matches_all(const BaseValueColumn& column) {
   switch (_scan_type) {
     case ScanType::OpEquals:
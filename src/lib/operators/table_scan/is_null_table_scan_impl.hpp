@@ -23,6 +23,12 @@ class IsNullTableScanImpl : public BaseSingleColumnTableScanImpl {
   void handle_dictionary_column(const BaseDictionaryColumn& base_column,
                                 std::shared_ptr<ColumnVisitableContext> base_context) override;
 
+  void handle_run_length_column(const BaseRunLengthColumn& base_column,
+                                std::shared_ptr<ColumnVisitableContext> base_context) override;
+
+  void handle_frame_of_reference_column(const BaseFrameOfReferenceColumn& base_column,
+                                        std::shared_ptr<ColumnVisitableContext> base_context) override;
+
  private:
   /**
    * @defgroup Methods used for handling value columns
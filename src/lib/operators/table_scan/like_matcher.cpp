@@ -0,0 +1,202 @@
+#include "like_matcher.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "simd_scan_kernels.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+bool starts_with(const std::string_view value, const std::string_view prefix) {
+  return value.size() >= prefix.size() && value.compare(0u, prefix.size(), prefix) == 0;
+}
+
+bool ends_with(const std::string_view value, const std::string_view suffix) {
+  return value.size() >= suffix.size() && value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+#if defined(__x86_64__)
+
+// See LikeMatcher::find_substring. begin + needle.size() <= end has been checked by the caller.
+__attribute__((target("avx2"))) size_t find_substring_avx2(const std::string_view haystack,
+                                                           const std::string_view needle, const size_t begin,
+                                                           const size_t end) {
+  constexpr auto block_size = sizeof(__m256i);
+
+  const auto first_characters = _mm256_set1_epi8(needle.front());
+  const auto last_characters = _mm256_set1_epi8(needle.back());
+  const auto last_offset = needle.size() - 1u;
+
+  auto position = begin;
+  for (; position + last_offset + block_size <= end; position += block_size) {
+    const auto first_block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack.data() + position));
+    const auto last_block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack.data() + position + last_offset));
+
+    const auto candidates = _mm256_and_si256(_mm256_cmpeq_epi8(first_block, first_characters),
+                                             _mm256_cmpeq_epi8(last_block, last_characters));
+    auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(candidates));
+
+    while (mask) {
+      const auto candidate = position + static_cast<size_t>(__builtin_ctz(mask));
+      if (std::memcmp(haystack.data() + candidate, needle.data(), needle.size()) == 0) return candidate;
+      mask &= mask - 1u;
+    }
+  }
+
+  return haystack.substr(0u, end).find(needle, position);
+}
+
+#endif
+
+}  // namespace
+
+LikeMatcher::LikeMatcher(const std::string& pattern) : _pattern{pattern} {
+  if (_pattern.find('_') != std::string::npos) {
+    _pattern_type = PatternType::General;
+    return;
+  }
+
+  if (_pattern.find('%') == std::string::npos) {
+    _pattern_type = PatternType::Exact;
+    _segments.emplace_back(_pattern);
+    return;
+  }
+
+  _starts_with_wildcard = _pattern.front() == '%';
+  _ends_with_wildcard = _pattern.back() == '%';
+
+  auto segment_begin = size_t{0u};
+  while (segment_begin <= _pattern.size()) {
+    const auto segment_end = std::min(_pattern.find('%', segment_begin), _pattern.size());
+    if (segment_end > segment_begin) {
+      _segments.emplace_back(_pattern.substr(segment_begin, segment_end - segment_begin));
+    }
+    segment_begin = segment_end + 1u;
+  }
+
+  if (_segments.empty()) {
+    // The pattern consists of '%'s only, every value starts with the empty string
+    _pattern_type = PatternType::Prefix;
+    _segments.emplace_back();
+  } else if (_segments.size() == 1u && !_starts_with_wildcard) {
+    _pattern_type = PatternType::Prefix;
+  } else if (_segments.size() == 1u && !_ends_with_wildcard) {
+    _pattern_type = PatternType::Suffix;
+  } else if (_segments.size() == 1u) {
+    _pattern_type = PatternType::Contains;
+  } else {
+    _pattern_type = PatternType::MultiSegment;
+  }
+}
+
+LikeMatcher::PatternType LikeMatcher::pattern_type() const { return _pattern_type; }
+
+bool LikeMatcher::matches(const std::string_view value) const {
+  switch (_pattern_type) {
+    case PatternType::Exact:
+      return value == _segments.front();
+
+    case PatternType::Prefix:
+      return starts_with(value, _segments.front());
+
+    case PatternType::Suffix:
+      return ends_with(value, _segments.front());
+
+    case PatternType::Contains:
+      return find_substring(value, _segments.front(), 0u, value.size()) != std::string_view::npos;
+
+    case PatternType::MultiSegment:
+      return _matches_multi_segment(value);
+
+    case PatternType::General:
+      return _matches_general(value);
+  }
+
+  Fail("Unknown pattern type");
+  return false;
+}
+
+size_t LikeMatcher::find_substring(const std::string_view haystack, const std::string_view needle, const size_t begin,
+                                   const size_t end) {
+  DebugAssert(end <= haystack.size(), "End is out of range.");
+
+  if (begin > end || end - begin < needle.size()) return std::string_view::npos;
+  if (needle.empty()) return begin;
+
+#if defined(__x86_64__)
+  if (best_scan_kernel_isa() >= ScanKernelIsa::Avx2) return find_substring_avx2(haystack, needle, begin, end);
+#endif
+
+  return haystack.substr(0u, end).find(needle, begin);
+}
+
+bool LikeMatcher::_matches_multi_segment(const std::string_view value) const {
+  auto begin = size_t{0u};
+  auto end = value.size();
+
+  auto segment_it = _segments.cbegin();
+  auto segments_end = _segments.cend();
+
+  // Segments without a '%' before (after) them have to be at the begin (end) of the value
+  if (!_starts_with_wildcard) {
+    if (!starts_with(value, *segment_it)) return false;
+    begin = segment_it->size();
+    ++segment_it;
+  }
+
+  if (!_ends_with_wildcard) {
+    --segments_end;
+    if (end - begin < segments_end->size() || !ends_with(value, *segments_end)) return false;
+    end -= segments_end->size();
+  }
+
+  // All other segments have to appear in order, each one as early as possible
+  for (; segment_it != segments_end; ++segment_it) {
+    const auto position = find_substring(value, *segment_it, begin, end);
+    if (position == std::string_view::npos) return false;
+    begin = position + segment_it->size();
+  }
+
+  return true;
+}
+
+bool LikeMatcher::_matches_general(const std::string_view value) const {
+  auto value_index = size_t{0u};
+  auto pattern_index = size_t{0u};
+
+  // The position after the last '%' and the position in the value that it was matched with
+  auto wildcard_pattern_index = std::string::npos;
+  auto wildcard_value_index = size_t{0u};
+
+  while (value_index < value.size()) {
+    if (pattern_index < _pattern.size() && _pattern[pattern_index] == '%') {
+      wildcard_pattern_index = ++pattern_index;
+      wildcard_value_index = value_index;
+    } else if (pattern_index < _pattern.size() &&
+               (_pattern[pattern_index] == '_' || _pattern[pattern_index] == value[value_index])) {
+      ++pattern_index;
+      ++value_index;
+    } else if (wildcard_pattern_index != std::string::npos) {
+      // Let the last '%' match one more character and retry
+      pattern_index = wildcard_pattern_index;
+      value_index = ++wildcard_value_index;
+    } else {
+      return false;
+    }
+  }
+
+  while (pattern_index < _pattern.size() && _pattern[pattern_index] == '%') ++pattern_index;
+  return pattern_index == _pattern.size();
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * @brief Matches strings against an SQL LIKE pattern
+ *
+ * '%' matches any number of characters and '_' matches exactly one character (i.e., one byte). As in the SQL
+ * standard, the comparison is case sensitive.
+ *
+ * The pattern is classified once, so that the common cases do not need a general matching algorithm:
+ *
+ * Pattern         | Type          | Check
+ * abc             | Exact         | value == abc
+ * abc%            | Prefix        | value starts with abc
+ * %abc            | Suffix        | value ends with abc
+ * %abc%           | Contains      | abc is a substring of value
+ * ab%c%d          | MultiSegment  | value starts with ab, ends with d, and contains c in between
+ * a_c%            | General       | the wildcards are matched with backtracking to the last %
+ *
+ * Substrings are searched with AVX2 if the CPU supports it (see find_substring).
+ */
+class LikeMatcher {
+ public:
+  explicit LikeMatcher(const std::string& pattern);
+
+  bool matches(const std::string_view value) const;
+
+  enum class PatternType { Exact, Prefix, Suffix, Contains, MultiSegment, General };
+
+  PatternType pattern_type() const;
+
+  /**
+   * Returns the first position in [begin, end) at which needle starts and ends before end, or std::string_view::npos.
+   * Compares the first and the last character of the needle with 32 positions of the haystack at once and only
+   * compares the remaining characters at the positions where both match.
+   */
+  static size_t find_substring(const std::string_view haystack, const std::string_view needle, const size_t begin,
+                               const size_t end);
+
+ private:
+  bool _matches_multi_segment(const std::string_view value) const;
+  bool _matches_general(const std::string_view value) const;
+
+  const std::string _pattern;
+  PatternType _pattern_type;
+
+  // The parts of the pattern between the '%'s. Only used for patterns without '_'.
+  std::vector<std::string> _segments;
+  bool _starts_with_wildcard = false;
+  bool _ends_with_wildcard = false;
+};
+
+}  // namespace opossum
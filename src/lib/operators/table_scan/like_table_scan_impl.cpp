@@ -1,20 +1,16 @@
 #include "like_table_scan_impl.hpp"
 
-#include <boost/algorithm/string/replace.hpp>
-
-#include <algorithm>
-#include <array>
-#include <map>
 #include <memory>
-#include <regex>
-#include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "storage/dictionary_column.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/string_dictionary.hpp"
 #include "storage/iterables/attribute_vector_iterable.hpp"
-#include "storage/iterables/constant_value_iterable.hpp"
+#include "storage/iterables/run_length_column_iterable.hpp"
 #include "storage/iterables/value_column_iterable.hpp"
 #include "storage/value_column.hpp"
 
@@ -24,11 +20,8 @@ LikeTableScanImpl::LikeTableScanImpl(std::shared_ptr<const Table> in_table, cons
                                      const ScanType scan_type, const std::string& right_wildcard)
     : BaseSingleColumnTableScanImpl{in_table, left_column_id, scan_type},
       _right_wildcard{right_wildcard},
-      _invert_results(scan_type == ScanType::OpNotLike) {
-  // convert the given SQL-like search term into a c++11 regex to use it for the actual matching
-  auto regex_string = _sqllike_to_regex(_right_wildcard);
-  _regex = std::regex{regex_string, std::regex_constants::icase};  // case insensitivity
-}
+      _invert_results(scan_type == ScanType::OpNotLike),
+      _matcher{right_wildcard} {}
 
 void LikeTableScanImpl::handle_value_column(const BaseValueColumn& base_column,
                                             std::shared_ptr<ColumnVisitableContext> base_context) {
@@ -40,12 +33,11 @@ void LikeTableScanImpl::handle_value_column(const BaseValueColumn& base_column,
   auto& left_column = static_cast<const ValueColumn<std::string>&>(base_column);
 
   auto left_iterable = ValueColumnIterable<std::string>{left_column};
-  auto right_iterable = ConstantValueIterable<std::regex>{_regex};
 
-  const auto regex_match = [this](const std::string& str) { return std::regex_match(str, _regex) ^ _invert_results; };
+  const auto like_match = [this](const std::string& str) { return _matcher.matches(str) ^ _invert_results; };
 
   left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
-    this->_unary_scan(regex_match, left_it, left_end, chunk_id, matches_out);
+    this->_unary_scan(like_match, left_it, left_end, chunk_id, matches_out);
   });
 }
 
@@ -85,8 +77,42 @@ void LikeTableScanImpl::handle_dictionary_column(const BaseDictionaryColumn& bas
   });
 }
 
-std::pair<size_t, std::vector<bool>> LikeTableScanImpl::_find_matches_in_dictionary(
-    const pmr_vector<std::string>& dictionary) {
+void LikeTableScanImpl::handle_run_length_column(const BaseRunLengthColumn& base_column,
+                                                 std::shared_ptr<ColumnVisitableContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+  auto& matches_out = context->_matches_out;
+  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
+  const auto chunk_id = context->_chunk_id;
+
+  const auto& left_column = static_cast<const RunLengthColumn<std::string>&>(base_column);
+
+  if (mapped_chunk_offsets) {
+    auto left_iterable = RunLengthColumnIterable<std::string>{left_column};
+
+    const auto like_match = [this](const std::string& str) { return _matcher.matches(str) ^ _invert_results; };
+
+    left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+      this->_unary_scan(like_match, left_it, left_end, chunk_id, matches_out);
+    });
+
+    return;
+  }
+
+  const auto& null_values = *left_column.null_values();
+  const auto run_matches = _find_matches_in_dictionary(*left_column.values()).second;
+
+  const auto run_lookup = [&](const size_t run_index) { return !null_values[run_index] && run_matches[run_index]; };
+
+  _add_matching_runs(left_column, run_lookup, *context);
+}
+
+void LikeTableScanImpl::handle_frame_of_reference_column(const BaseFrameOfReferenceColumn& base_column,
+                                                         std::shared_ptr<ColumnVisitableContext> base_context) {
+  Fail("LIKE operator only applicable on string columns.");
+}
+
+template <typename Dictionary>
+std::pair<size_t, std::vector<bool>> LikeTableScanImpl::_find_matches_in_dictionary(const Dictionary& dictionary) {
   auto result = std::pair<size_t, std::vector<bool>>{};
 
   auto& count = result.first;
@@ -95,8 +121,14 @@ std::pair<size_t, std::vector<bool>> LikeTableScanImpl::_find_matches_in_diction
   count = 0u;
   dictionary_matches.reserve(dictionary.size());
 
-  for (const auto& value : dictionary) {
-    const auto result = std::regex_match(value, _regex) ^ _invert_results;
+  for (auto index = size_t{0u}; index < dictionary.size(); ++index) {
+    // StringDictionaries return copies from operator[], so their strings are viewed instead
+    auto result = false;
+    if constexpr (std::is_same_v<Dictionary, StringDictionary>) {
+      result = _matcher.matches(dictionary.view(index)) ^ _invert_results;
+    } else {
+      result = _matcher.matches(dictionary[index]) ^ _invert_results;
+    }
     count += static_cast<size_t>(result);
     dictionary_matches.push_back(result);
   }
@@ -104,28 +136,4 @@ std::pair<size_t, std::vector<bool>> LikeTableScanImpl::_find_matches_in_diction
   return result;
 }
 
-std::string LikeTableScanImpl::_sqllike_to_regex(std::string sqllike) {
-  constexpr auto replace_by = std::array<std::pair<const char*, const char*>, 15u>{{{".", "\\."},
-                                                                                    {"^", "\\^"},
-                                                                                    {"$", "\\$"},
-                                                                                    {"+", "\\+"},
-                                                                                    {"?", "\\?"},
-                                                                                    {"(", "\\("},
-                                                                                    {")", "\\"},
-                                                                                    {"{", "\\{"},
-                                                                                    {"}", "\\}"},
-                                                                                    {"\\", "\\\\"},
-                                                                                    {"|", "\\|"},
-                                                                                    {".", "\\."},
-                                                                                    {"*", "\\*"},
-                                                                                    {"%", ".*"},
-                                                                                    {"_", "."}}};
-
-  for (const auto& pair : replace_by) {
-    boost::replace_all(sqllike, pair.first, pair.second);
-  }
-
-  return "^" + sqllike + "$";
-}
-
 }  // namespace opossum
@@ -1,13 +1,12 @@
 #pragma once
 
-#include <map>
 #include <memory>
-#include <regex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_single_column_table_scan_impl.hpp"
+#include "like_matcher.hpp"
 
 #include "types.hpp"
 
@@ -19,10 +18,13 @@ class Table;
  * @brief Implements a column scan using the LIKE operator
  *
  * - The only supported type is std::string.
+ * - The pattern is matched case sensitively by a LikeMatcher, which handles prefixes, suffixes, and substrings
+ *   without a general matching algorithm
  * - Value columns are scanned sequentially
  * - For dictionary columns, we check the values in the dictionary and store the results in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the column satisfy the expression.
+ * - For run-length encoded columns, the expression is evaluated once per run
  */
 class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
  public:
@@ -35,6 +37,13 @@ class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
   void handle_dictionary_column(const BaseDictionaryColumn& base_column,
                                 std::shared_ptr<ColumnVisitableContext> base_context) override;
 
+  void handle_run_length_column(const BaseRunLengthColumn& base_column,
+                                std::shared_ptr<ColumnVisitableContext> base_context) override;
+
+  // frame-of-reference encoded columns only store integers
+  void handle_frame_of_reference_column(const BaseFrameOfReferenceColumn& base_column,
+                                        std::shared_ptr<ColumnVisitableContext> base_context) override;
+
  private:
   /**
    * @defgroup Methods used for handling dictionary columns
@@ -42,19 +51,10 @@ class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
    */
 
   /**
-   * @returns number of matches and the result of each dictionary entry
+   * @returns number of matches and the result of each dictionary entry (also used for the values of runs)
    */
-  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const pmr_vector<std::string>& dictionary);
-
-  /**@}*/
-
- private:
-  /**
-   * @defgroup Methods which are used to convert an SQL wildcard into a C++ regex.
-   * @{
-   */
-
-  static std::string _sqllike_to_regex(std::string sqllike);
+  template <typename Dictionary>
+  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const Dictionary& dictionary);
 
   /**@}*/
 
@@ -62,7 +62,7 @@ class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
   const std::string _right_wildcard;
   const bool _invert_results;
 
-  std::regex _regex;
+  const LikeMatcher _matcher;
 };
 
 }  // namespace opossum
@@ -0,0 +1,240 @@
+#include "simd_scan_kernels.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T, size_t size>
+using Vector [[gnu::vector_size(size)]] = T;
+
+/**
+ * Evaluates left <scan_type> right for scalars as well as for vectors, where each lane of the result is all ones if the
+ * comparison holds. The result is passed by reference, because returning vectors from a function that is not compiled
+ * for the vector's instruction set changes the ABI. As the function is always inlined, the comparison is compiled for
+ * the instruction set of the kernel.
+ */
+template <ScanType scan_type, typename Left, typename Right, typename Result>
+[[gnu::always_inline]] inline void compare(const Left& left, const Right& right, Result& result) {
+  if constexpr (scan_type == ScanType::OpEquals) {
+    result = left == right;
+  } else if constexpr (scan_type == ScanType::OpNotEquals) {
+    result = left != right;
+  } else if constexpr (scan_type == ScanType::OpLessThan) {
+    result = left < right;
+  } else if constexpr (scan_type == ScanType::OpLessThanEquals) {
+    result = left <= right;
+  } else if constexpr (scan_type == ScanType::OpGreaterThan) {
+    result = left > right;
+  } else {
+    result = left >= right;
+  }
+}
+
+// The movemask instructions yield one bit per byte. Only the lowest bit of each lane is kept.
+template <typename T>
+constexpr uint64_t lane_bits() {
+  auto bits = uint64_t{0u};
+  for (auto bit = size_t{0u}; bit < 64u; bit += sizeof(T)) bits |= uint64_t{1u} << bit;
+  return bits;
+}
+
+// Writes the RowIDs of the lanes whose bits are set, with one bit per byte of T
+template <typename T>
+[[gnu::always_inline]] inline size_t write_matches(uint64_t mask, const ChunkID chunk_id,
+                                                   const ChunkOffset chunk_offset, RowID* matches_out) {
+  auto match_count = size_t{0u};
+  while (mask) {
+    const auto lane = static_cast<ChunkOffset>(__builtin_ctzll(mask) / sizeof(T));
+    matches_out[match_count++] = RowID{chunk_id, chunk_offset + lane};
+    mask &= mask - 1u;
+  }
+  return match_count;
+}
+
+// The scalar fallback, which is also used for the values after the last full vector
+template <typename T, ScanType scan_type, bool has_excluded_value>
+size_t scan_scalar(const T* values, const size_t count, const T search_value, const T excluded_value,
+                   const ChunkID chunk_id, const ChunkOffset first_chunk_offset, RowID* matches_out) {
+  auto match_count = size_t{0u};
+  for (auto index = size_t{0u}; index < count; ++index) {
+    const auto value = values[index];
+
+    auto matches = false;
+    compare<scan_type>(value, search_value, matches);
+    if constexpr (has_excluded_value) matches &= value != excluded_value;
+
+    // Write the RowID in any case and only advance if it matches, so that there is no branch to mispredict
+    matches_out[match_count] = RowID{chunk_id, static_cast<ChunkOffset>(first_chunk_offset + index)};
+    match_count += matches;
+  }
+  return match_count;
+}
+
+#if defined(__x86_64__)
+
+template <typename T, ScanType scan_type, bool has_excluded_value>
+__attribute__((target("avx2"))) size_t scan_avx2(const T* values, const size_t count, const T search_value,
+                                                 const T excluded_value, const ChunkID chunk_id,
+                                                 const ChunkOffset first_chunk_offset, RowID* matches_out) {
+  using ValueVector = Vector<T, 32u>;
+  using MaskVector = decltype(ValueVector{} == ValueVector{});
+  constexpr auto lane_count = sizeof(ValueVector) / sizeof(T);
+
+  auto match_count = size_t{0u};
+  auto index = size_t{0u};
+  for (; index + lane_count <= count; index += lane_count) {
+    auto value_vector = ValueVector{};
+    std::memcpy(&value_vector, values + index, sizeof(ValueVector));
+
+    auto mask_vector = MaskVector{};
+    compare<scan_type>(value_vector, search_value, mask_vector);
+    if constexpr (has_excluded_value) mask_vector &= value_vector != excluded_value;
+
+    const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(reinterpret_cast<__m256i>(mask_vector)));
+    match_count += write_matches<T>(mask & lane_bits<T>(), chunk_id,
+                                    static_cast<ChunkOffset>(first_chunk_offset + index), matches_out + match_count);
+  }
+
+  return match_count + scan_scalar<T, scan_type, has_excluded_value>(
+                           values + index, count - index, search_value, excluded_value, chunk_id,
+                           static_cast<ChunkOffset>(first_chunk_offset + index), matches_out + match_count);
+}
+
+template <typename T, ScanType scan_type, bool has_excluded_value>
+__attribute__((target("avx512f,avx512bw"))) size_t scan_avx512(const T* values, const size_t count,
+                                                               const T search_value, const T excluded_value,
+                                                               const ChunkID chunk_id,
+                                                               const ChunkOffset first_chunk_offset,
+                                                               RowID* matches_out) {
+  using ValueVector = Vector<T, 64u>;
+  using MaskVector = decltype(ValueVector{} == ValueVector{});
+  constexpr auto lane_count = sizeof(ValueVector) / sizeof(T);
+
+  auto match_count = size_t{0u};
+  auto index = size_t{0u};
+  for (; index + lane_count <= count; index += lane_count) {
+    auto value_vector = ValueVector{};
+    std::memcpy(&value_vector, values + index, sizeof(ValueVector));
+
+    auto mask_vector = MaskVector{};
+    compare<scan_type>(value_vector, search_value, mask_vector);
+    if constexpr (has_excluded_value) mask_vector &= value_vector != excluded_value;
+
+    const auto mask = static_cast<uint64_t>(_mm512_movepi8_mask(reinterpret_cast<__m512i>(mask_vector)));
+    match_count += write_matches<T>(mask & lane_bits<T>(), chunk_id,
+                                    static_cast<ChunkOffset>(first_chunk_offset + index), matches_out + match_count);
+  }
+
+  return match_count + scan_scalar<T, scan_type, has_excluded_value>(
+                           values + index, count - index, search_value, excluded_value, chunk_id,
+                           static_cast<ChunkOffset>(first_chunk_offset + index), matches_out + match_count);
+}
+
+#endif
+
+template <typename T, ScanType scan_type, bool has_excluded_value>
+size_t scan_values_with_isa(const T* values, const size_t count, const T search_value, const T excluded_value,
+                            const ChunkID chunk_id, const ChunkOffset first_chunk_offset, RowID* matches_out,
+                            const ScanKernelIsa isa) {
+#if defined(__x86_64__)
+  switch (isa) {
+    case ScanKernelIsa::Avx512:
+      return scan_avx512<T, scan_type, has_excluded_value>(values, count, search_value, excluded_value, chunk_id,
+                                                           first_chunk_offset, matches_out);
+    case ScanKernelIsa::Avx2:
+      return scan_avx2<T, scan_type, has_excluded_value>(values, count, search_value, excluded_value, chunk_id,
+                                                         first_chunk_offset, matches_out);
+    case ScanKernelIsa::Scalar:
+      break;
+  }
+#endif
+
+  return scan_scalar<T, scan_type, has_excluded_value>(values, count, search_value, excluded_value, chunk_id,
+                                                       first_chunk_offset, matches_out);
+}
+
+template <typename T, ScanType scan_type>
+size_t scan_values_with_scan_type(const T* values, const size_t count, const T search_value,
+                                  const std::optional<T> excluded_value, const ChunkID chunk_id,
+                                  const ChunkOffset first_chunk_offset, RowID* matches_out, const ScanKernelIsa isa) {
+  if (excluded_value) {
+    return scan_values_with_isa<T, scan_type, true>(values, count, search_value, *excluded_value, chunk_id,
+                                                    first_chunk_offset, matches_out, isa);
+  }
+  return scan_values_with_isa<T, scan_type, false>(values, count, search_value, T{}, chunk_id, first_chunk_offset,
+                                                   matches_out, isa);
+}
+
+}  // namespace
+
+ScanKernelIsa best_scan_kernel_isa() {
+#if defined(__x86_64__)
+  static const auto isa = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return ScanKernelIsa::Avx512;
+    if (__builtin_cpu_supports("avx2")) return ScanKernelIsa::Avx2;
+    return ScanKernelIsa::Scalar;
+  }();
+  return isa;
+#else
+  return ScanKernelIsa::Scalar;
+#endif
+}
+
+template <typename T>
+size_t scan_values(const T* values, const size_t count, const ScanType scan_type, const T search_value,
+                   const ChunkID chunk_id, const ChunkOffset first_chunk_offset, RowID* matches_out,
+                   const std::optional<T> excluded_value, const ScanKernelIsa isa) {
+  DebugAssert(isa <= best_scan_kernel_isa(), "Instruction set is not supported by this CPU.");
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return scan_values_with_scan_type<T, ScanType::OpEquals>(values, count, search_value, excluded_value, chunk_id,
+                                                               first_chunk_offset, matches_out, isa);
+    case ScanType::OpNotEquals:
+      return scan_values_with_scan_type<T, ScanType::OpNotEquals>(values, count, search_value, excluded_value,
+                                                                  chunk_id, first_chunk_offset, matches_out, isa);
+    case ScanType::OpLessThan:
+      return scan_values_with_scan_type<T, ScanType::OpLessThan>(values, count, search_value, excluded_value, chunk_id,
+                                                                 first_chunk_offset, matches_out, isa);
+    case ScanType::OpLessThanEquals:
+      return scan_values_with_scan_type<T, ScanType::OpLessThanEquals>(values, count, search_value, excluded_value,
+                                                                       chunk_id, first_chunk_offset, matches_out, isa);
+    case ScanType::OpGreaterThan:
+      return scan_values_with_scan_type<T, ScanType::OpGreaterThan>(values, count, search_value, excluded_value,
+                                                                    chunk_id, first_chunk_offset, matches_out, isa);
+    case ScanType::OpGreaterThanEquals:
+      return scan_values_with_scan_type<T, ScanType::OpGreaterThanEquals>(values, count, search_value, excluded_value,
+                                                                          chunk_id, first_chunk_offset, matches_out,
+                                                                          isa);
+    default:
+      Fail("Unsupported comparison type encountered");
+      return 0u;
+  }
+}
+
+template size_t scan_values<int32_t>(const int32_t*, const size_t, const ScanType, const int32_t, const ChunkID,
+                                     const ChunkOffset, RowID*, const std::optional<int32_t>, const ScanKernelIsa);
+template size_t scan_values<int64_t>(const int64_t*, const size_t, const ScanType, const int64_t, const ChunkID,
+                                     const ChunkOffset, RowID*, const std::optional<int64_t>, const ScanKernelIsa);
+template size_t scan_values<float>(const float*, const size_t, const ScanType, const float, const ChunkID,
+                                   const ChunkOffset, RowID*, const std::optional<float>, const ScanKernelIsa);
+template size_t scan_values<double>(const double*, const size_t, const ScanType, const double, const ChunkID,
+                                    const ChunkOffset, RowID*, const std::optional<double>, const ScanKernelIsa);
+template size_t scan_values<uint8_t>(const uint8_t*, const size_t, const ScanType, const uint8_t, const ChunkID,
+                                     const ChunkOffset, RowID*, const std::optional<uint8_t>, const ScanKernelIsa);
+template size_t scan_values<uint16_t>(const uint16_t*, const size_t, const ScanType, const uint16_t, const ChunkID,
+                                      const ChunkOffset, RowID*, const std::optional<uint16_t>, const ScanKernelIsa);
+template size_t scan_values<uint32_t>(const uint32_t*, const size_t, const ScanType, const uint32_t, const ChunkID,
+                                      const ChunkOffset, RowID*, const std::optional<uint32_t>, const ScanKernelIsa);
+
+}  // namespace opossum
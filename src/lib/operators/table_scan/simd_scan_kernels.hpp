@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Vectorized kernels that compare contiguous values with a constant
+ *
+ * They are used by the SingleColumnTableScanImpl for the values of value columns and for the ValueIDs of attribute
+ * vectors. Each kernel compares a whole vector register of values at once, turns the comparison result into a bit mask,
+ * and writes the positions of all set bits into the output at once. There are kernels for AVX-512 and AVX2
+ * as well as a scalar fallback. Which one is used is decided at runtime, depending on what the CPU supports.
+ *
+ * Supported types are int32_t, int64_t, float, and double (values) as well as uint8_t, uint16_t, and uint32_t
+ * (ValueIDs).
+ */
+
+enum class ScanKernelIsa { Scalar, Avx2, Avx512 };
+
+// The widest instruction set that is supported by both the build and the CPU
+ScanKernelIsa best_scan_kernel_isa();
+
+/**
+ * Writes RowID{chunk_id, first_chunk_offset + i} for each value values[i] that satisfies values[i] <scan_type>
+ * search_value into matches_out and returns the number of matches. matches_out has to have room for count RowIDs.
+ * Values that are equal to excluded_value never match, which is used to skip the NULLs of attribute vectors.
+ *
+ * Only the comparison scan types (OpEquals to OpGreaterThanEquals) are supported.
+ */
+template <typename T>
+size_t scan_values(const T* values, const size_t count, const ScanType scan_type, const T search_value,
+                   const ChunkID chunk_id, const ChunkOffset first_chunk_offset, RowID* matches_out,
+                   const std::optional<T> excluded_value = std::nullopt,
+                   const ScanKernelIsa isa = best_scan_kernel_isa());
+
+}  // namespace opossum
@@ -1,15 +1,26 @@
 #include "single_column_table_scan_impl.hpp"
 
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "simd_scan_kernels.hpp"
 #include "storage/base_dictionary_column.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/frame_of_reference_column.hpp"
 #include "storage/iterables/attribute_vector_iterable.hpp"
 #include "storage/iterables/constant_value_iterable.hpp"
 #include "storage/iterables/create_iterable_from_column.hpp"
+#include "storage/value_column.hpp"
 
 #include "resolve_type.hpp"
+#include "type_cast.hpp"
 #include "type_comparison.hpp"
 
 namespace opossum {
@@ -33,6 +44,13 @@ void SingleColumnTableScanImpl::handle_value_column(const BaseValueColumn& base_
 
     auto& left_column = static_cast<const ValueColumn<Type>&>(base_column);
 
+    if constexpr (std::is_arithmetic_v<Type>) {
+      if (!mapped_chunk_offsets) {
+        _scan_values_vectorized(left_column, *context);
+        return;
+      }
+    }
+
     auto left_column_iterable = create_iterable_from_column(left_column);
     auto right_value_iterable = ConstantValueIterable<Type>{_right_value};
 
@@ -88,7 +106,18 @@ void SingleColumnTableScanImpl::handle_dictionary_column(const BaseDictionaryCol
   const auto& attribute_vector = *left_column.attribute_vector();
   auto left_iterable = AttributeVectorIterable{attribute_vector};
 
-  if (_right_value_matches_all(left_column, search_value_id)) {
+  const auto matches_all = _right_value_matches_all(left_column, search_value_id);
+
+  if (!matches_all && _right_value_matches_none(left_column, search_value_id)) {
+    return;
+  }
+
+  if (!mapped_chunk_offsets) {
+    _scan_value_ids_vectorized(attribute_vector, search_value_id, matches_all, *context);
+    return;
+  }
+
+  if (matches_all) {
     left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
       static const auto always_true = [](const auto&) { return true; };
       this->_unary_scan(always_true, left_it, left_end, chunk_id, matches_out);
@@ -97,10 +126,6 @@ void SingleColumnTableScanImpl::handle_dictionary_column(const BaseDictionaryCol
     return;
   }
 
-  if (_right_value_matches_none(left_column, search_value_id)) {
-    return;
-  }
-
   auto right_iterable = ConstantValueIterable<ValueID>{search_value_id};
 
   left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
@@ -112,6 +137,260 @@ void SingleColumnTableScanImpl::handle_dictionary_column(const BaseDictionaryCol
   });
 }
 
+void SingleColumnTableScanImpl::handle_run_length_column(const BaseRunLengthColumn& base_column,
+                                                         std::shared_ptr<ColumnVisitableContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+  auto& matches_out = context->_matches_out;
+  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
+  const auto chunk_id = context->_chunk_id;
+
+  const auto left_column_type = _in_table->column_type(_left_column_id);
+
+  resolve_data_type(left_column_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    auto& left_column = static_cast<const RunLengthColumn<Type>&>(base_column);
+
+    if (!mapped_chunk_offsets) {
+      const auto& values = *left_column.values();
+      const auto& null_values = *left_column.null_values();
+      const auto right_value = type_cast<Type>(_right_value);
+
+      with_comparator(_scan_type, [&](auto comparator) {
+        const auto run_matches = [&](const size_t run_index) {
+          return !null_values[run_index] && comparator(values[run_index], right_value);
+        };
+
+        this->_add_matching_runs(left_column, run_matches, *context);
+      });
+
+      return;
+    }
+
+    auto left_column_iterable = create_iterable_from_column(left_column);
+    auto right_value_iterable = ConstantValueIterable<Type>{_right_value};
+
+    left_column_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+      right_value_iterable.with_iterators([&](auto right_it, auto right_end) {
+        with_comparator(_scan_type, [&](auto comparator) {
+          _binary_scan(comparator, left_it, left_end, right_it, chunk_id, matches_out);
+        });
+      });
+    });
+  });
+}
+
+void SingleColumnTableScanImpl::handle_frame_of_reference_column(
+    const BaseFrameOfReferenceColumn& base_column, std::shared_ptr<ColumnVisitableContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+  auto& matches_out = context->_matches_out;
+  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
+  const auto chunk_id = context->_chunk_id;
+
+  const auto left_column_type = _in_table->column_type(_left_column_id);
+
+  resolve_data_type(left_column_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    if constexpr (supports_frame_of_reference_encoding_v<Type>) {
+      auto& left_column = static_cast<const FrameOfReferenceColumn<Type>&>(base_column);
+
+      if (!mapped_chunk_offsets) {
+        _scan_frames(left_column, *context);
+        return;
+      }
+
+      auto left_column_iterable = create_iterable_from_column(left_column);
+      auto right_value_iterable = ConstantValueIterable<Type>{_right_value};
+
+      left_column_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+        right_value_iterable.with_iterators([&](auto right_it, auto right_end) {
+          with_comparator(_scan_type, [&](auto comparator) {
+            _binary_scan(comparator, left_it, left_end, right_it, chunk_id, matches_out);
+          });
+        });
+      });
+    } else {
+      Fail("Frame-of-reference encoding is only supported for integer columns.");
+    }
+  });
+}
+
+template <typename T>
+void SingleColumnTableScanImpl::_scan_frames(const FrameOfReferenceColumn<T>& column, Context& context) {
+  auto& matches_out = context._matches_out;
+  const auto chunk_id = context._chunk_id;
+
+  const auto& minima = *column.minima();
+  const auto& maxima = *column.maxima();
+  const auto& offsets = *column.offsets();
+  const auto right_value = type_cast<T>(_right_value);
+
+  constexpr auto block_size = BitPackedAttributeVector::block_size;
+  const auto column_size = static_cast<ChunkOffset>(column.size());
+
+  auto block = BitPackedAttributeVector::Block{};
+
+  with_comparator(_scan_type, [&](auto comparator) {
+    for (auto frame_id = size_t{0u}; frame_id < minima.size(); ++frame_id) {
+      const auto minimum = minima[frame_id];
+      const auto maximum = maxima[frame_id];
+
+      /**
+       * If the right value lies outside of [minimum, maximum], the comparison has the same result for all values of
+       * the frame. Otherwise, value <op> right_value is equivalent to offset <op> (right_value - minimum).
+       */
+      const auto matches_all = right_value < minimum || right_value > maximum;
+
+      if (matches_all && !comparator(minimum, right_value)) continue;
+
+      const auto search_offset = matches_all ? 0u : FrameOfReferenceColumn<T>::encode(minimum, right_value);
+
+      const auto frame_begin = static_cast<ChunkOffset>(frame_id * FrameOfReferenceColumn<T>::frame_size);
+      const auto frame_end = std::min(static_cast<ChunkOffset>(frame_begin + FrameOfReferenceColumn<T>::frame_size),
+                                      column_size);
+
+      for (auto block_begin = frame_begin; block_begin < frame_end; block_begin += block_size) {
+        offsets.decode_block(block_begin / block_size, block);
+
+        const auto block_end = std::min(static_cast<ChunkOffset>(block_begin + block_size), frame_end);
+        for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+          const auto offset = block[chunk_offset - block_begin];
+          if (offset == NULL_VALUE_ID) continue;
+
+          if (matches_all || comparator(offset, search_offset)) {
+            matches_out.push_back(RowID{chunk_id, chunk_offset});
+          }
+        }
+      }
+    }
+  });
+}
+
+template <typename T>
+void SingleColumnTableScanImpl::_scan_values_vectorized(const ValueColumn<T>& column, Context& context) {
+  auto& matches_out = context._matches_out;
+  const auto chunk_id = context._chunk_id;
+  const auto& values = column.values();
+  const auto search_value = type_cast<T>(_right_value);
+
+  const auto value_count = values.size();
+
+  const auto first_match = matches_out.size();
+  matches_out.resize(first_match + value_count);
+  auto match_count = size_t{0u};
+
+  /**
+   * The values are stored in a tbb::concurrent_vector, which makes no guarantees about how its elements are laid out
+   * in memory. They are therefore copied block by block into a contiguous buffer that fits into the L1 cache, on which
+   * the kernels are run.
+   */
+  constexpr auto block_size = size_t{1024u};
+  auto block = std::array<T, block_size>{};
+
+  auto value_it = values.cbegin();
+  for (auto begin = size_t{0u}; begin < value_count; begin += block_size) {
+    const auto count = std::min(block_size, value_count - begin);
+    std::copy_n(value_it, count, block.begin());
+    value_it += count;
+
+    match_count += scan_values(block.data(), count, _scan_type, search_value, chunk_id, static_cast<ChunkOffset>(begin),
+                               matches_out.data() + first_match + match_count);
+  }
+
+  // NULLs are stored as some value, so matching NULLs have to be removed again
+  if (column.is_nullable()) {
+    const auto& null_values = column.null_values();
+    const auto matches_begin = matches_out.begin() + first_match;
+    const auto matches_end = std::remove_if(matches_begin, matches_begin + match_count,
+                                            [&](const RowID& row_id) { return null_values[row_id.chunk_offset]; });
+    match_count = static_cast<size_t>(matches_end - matches_begin);
+  }
+
+  matches_out.resize(first_match + match_count);
+}
+
+void SingleColumnTableScanImpl::_scan_value_ids_vectorized(const BaseAttributeVector& attribute_vector,
+                                                           const ValueID search_value_id, const bool matches_all,
+                                                           Context& context) {
+  auto& matches_out = context._matches_out;
+  const auto chunk_id = context._chunk_id;
+
+  resolve_attribute_vector_type(attribute_vector, [&](const auto& typed_attribute_vector) {
+    using AttributeVectorType = std::decay_t<decltype(typed_attribute_vector)>;
+    constexpr auto is_bit_packed = std::is_same_v<AttributeVectorType, BitPackedAttributeVector>;
+
+    // Bit-packed ValueIDs are decoded block by block, in which NULLs become NULL_VALUE_ID
+    constexpr auto null_value_id = [] {
+      if constexpr (is_bit_packed) {
+        return std::numeric_limits<ValueID::base_type>::max();  // NULL_VALUE_ID
+      } else {
+        return AttributeVectorType::CLAMPED_NULL_VALUE_ID;
+      }
+    }();
+    using uintX_t = std::decay_t<decltype(null_value_id)>;
+
+    /**
+     * The scan types are mapped as in _with_operator_for_dict_column_scan. NULLs are stored as the largest ValueID,
+     * so they have to be excluded for != and >=. If all values match, all ValueIDs but the NULLs are selected.
+     */
+    auto scan_type = ScanType::OpNotEquals;
+    auto search_value = null_value_id;
+    auto excluded_value = std::optional<uintX_t>{};
+
+    if (!matches_all) {
+      search_value = static_cast<uintX_t>(search_value_id);
+
+      switch (_scan_type) {
+        case ScanType::OpEquals:
+          scan_type = ScanType::OpEquals;
+          break;
+
+        case ScanType::OpNotEquals:
+          excluded_value = null_value_id;
+          break;
+
+        case ScanType::OpLessThan:
+        case ScanType::OpLessThanEquals:
+          scan_type = ScanType::OpLessThan;
+          break;
+
+        case ScanType::OpGreaterThan:
+        case ScanType::OpGreaterThanEquals:
+          scan_type = ScanType::OpGreaterThanEquals;
+          excluded_value = null_value_id;
+          break;
+
+        default:
+          Fail("Unsupported comparison type encountered");
+      }
+    }
+
+    const auto first_match = matches_out.size();
+    matches_out.resize(first_match + typed_attribute_vector.size());
+    auto match_count = size_t{0u};
+
+    if constexpr (is_bit_packed) {
+      constexpr auto block_size = BitPackedAttributeVector::block_size;
+      const auto value_count = typed_attribute_vector.size();
+      auto block = BitPackedAttributeVector::Block{};
+
+      for (auto begin = size_t{0u}; begin < value_count; begin += block_size) {
+        typed_attribute_vector.decode_block(begin / block_size, block);
+        match_count += scan_values(block.data(), std::min(size_t{block_size}, value_count - begin), scan_type,
+                                   search_value, chunk_id, static_cast<ChunkOffset>(begin),
+                                   matches_out.data() + first_match + match_count, excluded_value);
+      }
+    } else {
+      const auto& attributes = typed_attribute_vector.attributes();
+      match_count = scan_values(attributes.data(), attributes.size(), scan_type, search_value, chunk_id,
+                                ChunkOffset{0u}, matches_out.data() + first_match, excluded_value);
+    }
+
+    matches_out.resize(first_match + match_count);
+  });
+}
+
 ValueID SingleColumnTableScanImpl::_get_search_value_id(const BaseDictionaryColumn& column) {
   switch (_scan_type) {
     case ScanType::OpEquals:
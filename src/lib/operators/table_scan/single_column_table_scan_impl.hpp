@@ -13,15 +13,27 @@
 
 namespace opossum {
 
+class BaseAttributeVector;
 class BaseDictionaryColumn;
 
+template <typename T>
+class FrameOfReferenceColumn;
+
+template <typename T>
+class ValueColumn;
+
 /**
  * @brief Compares one column to a constant value
  *
- * - Value columns are scanned sequentially
+ * - Value columns are scanned sequentially. Numerical values are compared by the vectorized kernels of
+ *   simd_scan_kernels.hpp if the column is visited directly, i.e., not through a reference column.
  * - For dictionary columns, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
- *   enables us to detect if all or none of the values in the column satisfy the expression.
+ *   enables us to detect if all or none of the values in the column satisfy the expression. The ValueIDs of attribute
+ *   vectors are compared by the vectorized kernels, too. Bit-packed ValueIDs are decoded block by block for that.
+ * - For run-length encoded columns, the constant value is compared once per run
+ * - For frame-of-reference encoded columns, frames are skipped if their minimum and maximum show that none of their
+ *   values match. The constant value is converted into an offset so that the offsets need not be decoded.
  */
 class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
  public:
@@ -34,6 +46,12 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
   void handle_dictionary_column(const BaseDictionaryColumn& base_column,
                                 std::shared_ptr<ColumnVisitableContext> base_context) override;
 
+  void handle_run_length_column(const BaseRunLengthColumn& base_column,
+                                std::shared_ptr<ColumnVisitableContext> base_context) override;
+
+  void handle_frame_of_reference_column(const BaseFrameOfReferenceColumn& base_column,
+                                        std::shared_ptr<ColumnVisitableContext> base_context) override;
+
  private:
   /**
    * @defgroup Methods used for handling dictionary columns
@@ -46,6 +64,10 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
 
   bool _right_value_matches_none(const BaseDictionaryColumn& column, const ValueID search_value_id);
 
+  // Scans the ValueIDs with the vectorized kernels. Bit-packed ValueIDs are decoded into blocks first.
+  void _scan_value_ids_vectorized(const BaseAttributeVector& attribute_vector, const ValueID search_value_id,
+                                  const bool matches_all, Context& context);
+
   template <typename Functor>
   void _with_operator_for_dict_column_scan(const ScanType scan_type, const Functor& func) {
     switch (scan_type) {
@@ -75,6 +97,20 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
 
   /**@}*/
 
+  // Scans the values of a numerical value column with the vectorized kernels
+  template <typename T>
+  void _scan_values_vectorized(const ValueColumn<T>& column, Context& context);
+
+  /**
+   * @defgroup Methods used for handling frame-of-reference encoded columns
+   * @{
+   */
+
+  template <typename T>
+  void _scan_frames(const FrameOfReferenceColumn<T>& column, Context& context);
+
+  /**@}*/
+
  private:
   const AllTypeVariant _right_value;
 };
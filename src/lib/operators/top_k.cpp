@@ -0,0 +1,174 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/iterables/create_iterable_from_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/normalized_key.hpp"
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t num_rows, const size_t output_chunk_size)
+    : Sort(in, sort_definitions, output_chunk_size), _num_rows(num_rows) {}
+
+size_t TopK::num_rows() const { return _num_rows; }
+
+const std::string TopK::name() const { return "TopK"; }
+
+std::shared_ptr<AbstractOperator> TopK::recreate(const std::vector<AllParameterVariant>& args) const {
+  return std::make_shared<TopK>(_input_left->recreate(args), _sort_definitions, _num_rows, _output_chunk_size);
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(input_table->row_count() < std::numeric_limits<uint32_t>::max(), "TopK: Too many rows");
+
+  auto output = Table::create_with_layout_from(input_table, _output_chunk_size);
+  if (_num_rows == 0u || input_table->row_count() == 0u) return output;
+
+  // 1. Find the candidates of each chunk in parallel
+  auto candidates_per_chunk = std::vector<std::vector<Candidate>>(input_table->chunk_count());
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(input_table->chunk_count());
+
+  auto first_row = size_t{0u};
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, first_row]() {
+      candidates_per_chunk[chunk_id] = _chunk_candidates(chunk_id, first_row);
+    }));
+    jobs.back()->schedule();
+
+    first_row += input_table->get_chunk(chunk_id).size();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // 2. Merge the candidates and keep the best num_rows of them
+  auto candidates = std::vector<Candidate>{};
+  for (auto& chunk_candidates : candidates_per_chunk) {
+    std::move(chunk_candidates.begin(), chunk_candidates.end(), std::back_inserter(candidates));
+  }
+
+  // The keys are unique, because they end with the position of the row
+  const auto compare = [](const Candidate& left, const Candidate& right) { return left.first < right.first; };
+  const auto output_row_count = std::min(_num_rows, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + output_row_count, candidates.end(), compare);
+
+  // 3. Materialize the output
+  auto row_ids = std::vector<RowID>(output_row_count);
+  std::transform(candidates.begin(), candidates.begin() + output_row_count, row_ids.begin(),
+                 [](const Candidate& candidate) { return candidate.second; });
+
+  auto sorted_rows = std::vector<uint32_t>(output_row_count);
+  std::iota(sorted_rows.begin(), sorted_rows.end(), uint32_t{0u});
+
+  _materialize_output(*output, sorted_rows, row_ids);
+
+  return output;
+}
+
+std::vector<TopK::Candidate> TopK::_chunk_candidates(const ChunkID chunk_id, const size_t first_row) const {
+  const auto input_table = _input_table_left();
+  const auto& chunk = input_table->get_chunk(chunk_id);
+
+  /**
+   * Normalize the values column by column (see utils/normalized_key.hpp). The normalized values of all rows of a
+   * column are stored in one buffer, so that no key is allocated per row. Unlike the keys of Sort, they contain the
+   * strings themselves, which avoids ranking all strings of the input.
+   */
+  auto column_keys = std::vector<std::string>(_sort_definitions.size());
+  auto column_key_offsets = std::vector<std::vector<size_t>>(_sort_definitions.size());
+
+  for (auto definition_index = size_t{0}; definition_index < _sort_definitions.size(); ++definition_index) {
+    const auto& definition = _sort_definitions[definition_index];
+    const auto null_byte = static_cast<char>(definition.nulls_first() ? 0 : 1);
+    const auto value_byte = static_cast<char>(1 - null_byte);
+    const auto invert = definition.descending();
+
+    auto& keys = column_keys[definition_index];
+    auto& key_offsets = column_key_offsets[definition_index];
+    key_offsets.reserve(chunk.size() + 1u);
+    key_offsets.push_back(0u);
+
+    const auto column_type = input_table->column_type(definition.column_id);
+    const auto base_column = chunk.get_column(definition.column_id);
+
+    resolve_data_and_column_type(column_type, *base_column, [&](auto type, auto& typed_column) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+
+      // The rows are counted, because the iterables of ReferenceColumns do not know the offsets of NULL rows
+      iterable.for_each([&](const auto& value) {
+        if (value.is_null()) {
+          keys.push_back(null_byte);
+        } else {
+          keys.push_back(value_byte);
+          append_normalized_value(keys, value.value(), invert);
+        }
+        key_offsets.push_back(keys.size());
+      });
+    });
+  }
+
+  /**
+   * Returns whether the row is better than the candidate with the given key. The normalized values of a column are
+   * prefix-free, so the first difference lies within the row's value of that column. Rows are visited in order, so
+   * the position of the row, which breaks all ties, makes a row with equal values the worse one.
+   */
+  const auto is_better = [&](const ChunkOffset chunk_offset, const std::string& key) {
+    auto key_position = size_t{0};
+    for (auto definition_index = size_t{0}; definition_index < _sort_definitions.size(); ++definition_index) {
+      const auto begin = column_key_offsets[definition_index][chunk_offset];
+      const auto length = column_key_offsets[definition_index][chunk_offset + 1u] - begin;
+      const auto result = key.compare(key_position, length, column_keys[definition_index], begin, length);
+      if (result != 0) return result > 0;
+      key_position += length;
+    }
+    return false;
+  };
+
+  const auto build_key = [&](const ChunkOffset chunk_offset) {
+    auto key = std::string{};
+    for (auto definition_index = size_t{0}; definition_index < _sort_definitions.size(); ++definition_index) {
+      const auto begin = column_key_offsets[definition_index][chunk_offset];
+      const auto end = column_key_offsets[definition_index][chunk_offset + 1u];
+      key.append(column_keys[definition_index], begin, end - begin);
+    }
+    append_normalized_value(key, static_cast<uint32_t>(first_row + chunk_offset), false);
+    return key;
+  };
+
+  // The heap is ordered so that its front is the worst candidate, which is replaced by any better row
+  const auto compare = [](const Candidate& left, const Candidate& right) { return left.first < right.first; };
+
+  auto heap = std::vector<Candidate>{};
+  heap.reserve(std::min(_num_rows, static_cast<size_t>(chunk.size())));
+
+  for (ChunkOffset chunk_offset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+    if (heap.size() < _num_rows) {
+      heap.emplace_back(build_key(chunk_offset), RowID{chunk_id, chunk_offset});
+      std::push_heap(heap.begin(), heap.end(), compare);
+    } else if (is_better(chunk_offset, heap.front().first)) {
+      std::pop_heap(heap.begin(), heap.end(), compare);
+      heap.back() = Candidate{build_key(chunk_offset), RowID{chunk_id, chunk_offset}};
+      std::push_heap(heap.begin(), heap.end(), compare);
+    }
+  }
+
+  return heap;
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first num_rows rows of the input as sorted by a Sort with the same sort definitions, i.e.,
+ * it executes ORDER BY ... LIMIT num_rows without sorting the whole input.
+ *
+ * Each chunk keeps its best num_rows rows in a bounded heap, which is ordered by normalized keys of variable length
+ * (see utils/normalized_key.hpp). A row is compared against the worst candidate of the heap on the normalized values
+ * of its columns, and its key is only built if it enters the heap. The candidates of all chunks are sorted at the end
+ * and the best num_rows are materialized like the output of Sort.
+ */
+class TopK : public Sort {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t num_rows, const size_t output_chunk_size = Chunk::MAX_SIZE);
+
+  size_t num_rows() const;
+
+  const std::string name() const override;
+  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const override;
+
+ protected:
+  // A row of the input and its normalized key
+  using Candidate = std::pair<std::string, RowID>;
+
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // Returns the best num_rows rows of a chunk, unordered. first_row is the position of the chunk's first row.
+  std::vector<Candidate> _chunk_candidates(const ChunkID chunk_id, const size_t first_row) const;
+
+  const size_t _num_rows;
+};
+
+}  // namespace opossum
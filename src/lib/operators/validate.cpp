@@ -6,7 +6,9 @@
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/zone_map.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -28,92 +30,188 @@ bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset c
   return snapshot_commit_id < end_cid && ((snapshot_commit_id >= begin_cid) != (row_tid == our_tid));
 }
 
-}  // namespace
+// True if all rows of the chunk are visible to the snapshot, so that their MVCC columns do not have to be checked
+bool is_chunk_visible(const Chunk& chunk, CommitID snapshot_commit_id) {
+  const auto zone_maps = chunk.zone_maps();
+  if (!zone_maps || zone_maps->visible_from_cid > snapshot_commit_id) return false;
 
-Validate::Validate(const std::shared_ptr<AbstractOperator> in) : AbstractReadOnlyOperator(in) {}
+  // Our own deletions are covered as well, because the flag is set before a row is locked
+  return !chunk.mvcc_columns()->has_deletions;
+}
 
-const std::string Validate::name() const { return "Validate"; }
+// Returns the rows of the range that are visible to the transaction. For reference columns, these are the visible
+// entries of the input's PosList, which is shared if all rows of a whole chunk are visible.
+std::shared_ptr<const PosList> validate_range(const Table& table_in, const ChunkRange& range, CommitID our_tid,
+                                              CommitID snapshot_commit_id) {
+  const auto& chunk_in = table_in.get_chunk(range.chunk_id);
+  auto pos_list_out = std::make_shared<PosList>();
+  const auto ref_col_in = std::dynamic_pointer_cast<const ReferenceColumn>(chunk_in.get_column(ColumnID{0}));
+
+  // If the columns in this chunk reference a column, build a poslist for a reference column.
+  if (ref_col_in) {
+    DebugAssert(chunk_in.references_exactly_one_table(),
+                "Input to Validate contains a Chunk referencing more than one table.");
+
+    const auto referenced_table = ref_col_in->referenced_table();
+    DebugAssert(referenced_table->get_chunk(ChunkID{0}).has_mvcc_columns(),
+                "Trying to use Validate on a table that has no MVCC columns");
+
+    const auto& pos_list_in = *ref_col_in->pos_list();
+
+    // As long as all rows are visible, pos_list_out stays empty. Only when the first invisible row is found, the
+    // visible rows before it are copied.
+    auto all_rows_visible = true;
+
+    // The rows are checked in runs of the same referenced chunk, which are usually as long as the chunk itself,
+    // so that each chunk's MVCC columns are locked only once.
+    auto run_end = size_t{range.begin};
+    for (auto run_begin = size_t{range.begin}; run_begin < range.end; run_begin = run_end) {
+      const auto referenced_chunk_id = pos_list_in[run_begin].chunk_id;
+      run_end = run_begin + 1u;
+      while (run_end < range.end && pos_list_in[run_end].chunk_id == referenced_chunk_id) ++run_end;
+
+      const auto& referenced_chunk = referenced_table->get_chunk(referenced_chunk_id);
+
+      if (is_chunk_visible(referenced_chunk, snapshot_commit_id)) {
+        if (!all_rows_visible) {
+          pos_list_out->insert(pos_list_out->end(), pos_list_in.cbegin() + run_begin, pos_list_in.cbegin() + run_end);
+        }
+        continue;
+      }
 
-std::shared_ptr<AbstractOperator> Validate::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<Validate>(_input_left->recreate(args));
+      const auto mvcc_columns = referenced_chunk.mvcc_columns();
+      for (auto index = run_begin; index < run_end; ++index) {
+        const auto& row_id = pos_list_in[index];
+        const auto row_is_visible = is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_columns);
+
+        if (all_rows_visible && !row_is_visible) {
+          all_rows_visible = false;
+          pos_list_out->assign(pos_list_in.cbegin() + range.begin, pos_list_in.cbegin() + index);
+        } else if (!all_rows_visible && row_is_visible) {
+          pos_list_out->emplace_back(row_id);
+        }
+      }
+    }
+
+    if (!all_rows_visible) return pos_list_out;
+
+    // If all rows are visible, the input's PosList is shared instead of building a new one.
+    if (range.covers_chunk(table_in)) return ref_col_in->pos_list();
+    pos_list_out->assign(pos_list_in.cbegin() + range.begin, pos_list_in.cbegin() + range.end);
+    return pos_list_out;
+  }
+
+  // Otherwise we have a Value- or DictionaryColumn and simply iterate over all rows to build a poslist.
+  DebugAssert(chunk_in.has_mvcc_columns(), "Trying to use Validate on a table that has no MVCC columns");
+
+  // If all rows of the chunk were committed after our snapshot, none of them is visible
+  const auto zone_maps = chunk_in.zone_maps();
+  if (zone_maps && zone_maps->min_begin_cid > snapshot_commit_id) return pos_list_out;
+
+  pos_list_out->resize(range.size());
+
+  if (is_chunk_visible(chunk_in, snapshot_commit_id)) {
+    for (auto chunk_offset = range.begin; chunk_offset < range.end; ++chunk_offset) {
+      (*pos_list_out)[chunk_offset - range.begin] = RowID{range.chunk_id, chunk_offset};
+    }
+  } else {
+    const auto mvcc_columns = chunk_in.mvcc_columns();
+
+    // Write the RowID in any case and only advance if it is visible, so that there is no branch to mispredict
+    auto visible_count = size_t{0u};
+    for (auto chunk_offset = range.begin; chunk_offset < range.end; ++chunk_offset) {
+      (*pos_list_out)[visible_count] = RowID{range.chunk_id, chunk_offset};
+      visible_count += is_row_visible(our_tid, snapshot_commit_id, chunk_offset, *mvcc_columns);
+    }
+    pos_list_out->resize(visible_count);
+  }
+
+  return pos_list_out;
 }
 
-std::shared_ptr<const Table> Validate::_on_execute() {
-  Fail("Validate can't be called without a transaction context.");
-  return {};
+// Adds the columns of chunk_out, which reference the same columns as the columns of chunk_in
+void add_reference_columns(Chunk& chunk_out, const std::shared_ptr<const Table>& table_in, const Chunk& chunk_in,
+                           const std::shared_ptr<const PosList>& pos_list) {
+  for (ColumnID column_id{0}; column_id < chunk_in.column_count(); ++column_id) {
+    const auto column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk_in.get_column(column_id));
+    if (column) {
+      chunk_out.add_column(
+          std::make_shared<ReferenceColumn>(column->referenced_table(), column->referenced_column_id(), pos_list));
+    } else {
+      chunk_out.add_column(std::make_shared<ReferenceColumn>(table_in, column_id, pos_list));
+    }
+  }
 }
 
-std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionContext> transaction_context) {
-  DebugAssert(transaction_context != nullptr, "Validate requires a valid TransactionContext.");
+// Rows of different chunks can only share an output chunk if the columns of the chunks reference the same columns
+bool reference_same_columns(const Chunk& left, const Chunk& right) {
+  for (ColumnID column_id{0}; column_id < left.column_count(); ++column_id) {
+    const auto left_column = std::dynamic_pointer_cast<const ReferenceColumn>(left.get_column(column_id));
+    const auto right_column = std::dynamic_pointer_cast<const ReferenceColumn>(right.get_column(column_id));
+    if (!left_column || !right_column) return !left_column && !right_column;
 
-  const auto _in_table = _input_table_left();
-  auto output = Table::create_with_layout_from(_in_table);
+    if (left_column->referenced_table() != right_column->referenced_table() ||
+        left_column->referenced_column_id() != right_column->referenced_column_id()) {
+      return false;
+    }
+  }
+  return true;
+}
 
-  const auto our_tid = transaction_context->transaction_id();
-  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+}  // namespace
 
-  for (ChunkID chunk_id{0}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
-    const auto& chunk_in = _in_table->get_chunk(chunk_id);
+Validate::Validate(const std::shared_ptr<AbstractOperator> in) : AbstractPipelineOperator(in) {}
 
-    auto chunk_out = Chunk{};
-    auto pos_list_out = std::make_shared<PosList>();
-    auto referenced_table = std::shared_ptr<const Table>();
-    const auto ref_col_in = std::dynamic_pointer_cast<const ReferenceColumn>(chunk_in.get_column(ColumnID{0}));
+const std::string Validate::name() const { return "Validate"; }
 
-    // If the columns in this chunk reference a column, build a poslist for a reference column.
-    if (ref_col_in) {
-      DebugAssert(chunk_in.references_exactly_one_table(),
-                  "Input to Validate contains a Chunk referencing more than one table.");
+std::shared_ptr<AbstractOperator> Validate::recreate(const std::vector<AllParameterVariant>& args) const {
+  return std::make_shared<Validate>(_input_left->recreate(args));
+}
 
-      // Check all rows in the old poslist and put them in pos_list_out if they are visible.
-      referenced_table = ref_col_in->referenced_table();
-      DebugAssert(referenced_table->get_chunk(ChunkID{0}).has_mvcc_columns(),
-                  "Trying to use Validate on a table that has no MVCC columns");
+std::vector<Chunk> Validate::_process_morsel(const std::shared_ptr<const Table>& input_table, const Morsel& morsel,
+                                             const std::shared_ptr<TransactionContext>& transaction_context) const {
+  DebugAssert(transaction_context != nullptr, "Validate requires a valid TransactionContext.");
 
-      for (auto row_id : *ref_col_in->pos_list()) {
-        const auto& referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+  const auto our_tid = transaction_context->transaction_id();
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
 
-        auto mvcc_columns = referenced_chunk.mvcc_columns();
+  const auto& ranges = morsel.ranges;
+  auto chunks_out = std::vector<Chunk>{};
+
+  // Consecutive ranges whose columns reference the same columns are combined into one output chunk
+  auto group_end = size_t{0u};
+  for (auto group_begin = size_t{0u}; group_begin < ranges.size(); group_begin = group_end) {
+    const auto& first_chunk_in = input_table->get_chunk(ranges[group_begin].chunk_id);
+    group_end = group_begin + 1u;
+    while (group_end < ranges.size() &&
+           reference_same_columns(first_chunk_in, input_table->get_chunk(ranges[group_end].chunk_id))) {
+      ++group_end;
+    }
 
-        if (is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_columns)) {
-          pos_list_out->emplace_back(row_id);
-        }
+    auto pos_list = validate_range(*input_table, ranges[group_begin], our_tid, snapshot_commit_id);
+    if (group_end - group_begin > 1u) {
+      auto combined_pos_list = std::make_shared<PosList>(*pos_list);
+      for (auto range_index = group_begin + 1u; range_index < group_end; ++range_index) {
+        const auto range_pos_list = validate_range(*input_table, ranges[range_index], our_tid, snapshot_commit_id);
+        combined_pos_list->insert(combined_pos_list->end(), range_pos_list->cbegin(), range_pos_list->cend());
       }
+      pos_list = combined_pos_list;
+    }
 
-      // Construct the actual ReferenceColumn objects and add them to the chunk.
-      for (ColumnID column_id{0}; column_id < chunk_in.column_count(); ++column_id) {
-        const auto column = std::static_pointer_cast<const ReferenceColumn>(chunk_in.get_column(column_id));
-        const auto referenced_column_id = column->referenced_column_id();
-        auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, referenced_column_id, pos_list_out);
-        chunk_out.add_column(ref_col_out);
-      }
+    add_reference_columns(chunks_out.emplace_back(), input_table, first_chunk_in, pos_list);
+  }
 
-      // Otherwise we have a Value- or DictionaryColumn and simply iterate over all rows to build a poslist.
-    } else {
-      referenced_table = _in_table;
-      DebugAssert(chunk_in.has_mvcc_columns(), "Trying to use Validate on a table that has no MVCC columns");
-      const auto mvcc_columns = chunk_in.mvcc_columns();
-
-      // Generate pos_list_out.
-      auto chunk_size = chunk_in.size();  // The compiler fails to optimize this in the for clause :(
-      for (auto i = 0u; i < chunk_size; i++) {
-        if (is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_columns)) {
-          pos_list_out->emplace_back(RowID{chunk_id, i});
-        }
-      }
+  return chunks_out;
+}
 
-      // Create actual ReferenceColumn objects.
-      for (ColumnID column_id{0}; column_id < chunk_in.column_count(); ++column_id) {
-        auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, column_id, pos_list_out);
-        chunk_out.add_column(ref_col_out);
-      }
-    }
+Chunk Validate::_create_empty_chunk(const std::shared_ptr<const Table>& input_table) const {
+  const auto& first_chunk_in = input_table->get_chunk(ChunkID{0});
 
-    if (chunk_out.size() > 0 || output->get_chunk(ChunkID{0}).size() == 0) {
-      output->emplace_chunk(std::move(chunk_out));
-    }
+  auto chunk_out = Chunk{};
+  if (first_chunk_in.column_count() > 0) {
+    add_reference_columns(chunk_out, input_table, first_chunk_in, std::make_shared<PosList>());
   }
-  return output;
+  return chunk_out;
 }
 
 }  // namespace opossum
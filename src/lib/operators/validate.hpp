@@ -4,7 +4,7 @@
 #include <string>
 #include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_pipeline_operator.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -15,8 +15,15 @@ namespace opossum {
  * within the context of a given transaction
  *
  * Assumption: Validate happens before joins.
+ *
+ * The MVCC columns of each referenced chunk are locked once for all of its rows. Chunks whose zone maps show that all
+ * rows are visible to the snapshot (see Chunk::ZoneMaps::visible_from_cid) are not checked row by row at all.
+ *
+ * The input is validated in morsels (see MorselDispatcher). The rows of a morsel share an output chunk, unless they
+ * come from input chunks that reference different tables. Validates can be fused into pipelines (see
+ * AbstractPipelineOperator).
  */
-class Validate : public AbstractReadOnlyOperator {
+class Validate : public AbstractPipelineOperator {
  public:
   explicit Validate(const std::shared_ptr<AbstractOperator> in);
 
@@ -25,8 +32,10 @@ class Validate : public AbstractReadOnlyOperator {
   std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args) const override;
 
  protected:
-  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
-  std::shared_ptr<const Table> _on_execute() override;
+  std::vector<Chunk> _process_morsel(const std::shared_ptr<const Table>& input_table, const Morsel& morsel,
+                                     const std::shared_ptr<TransactionContext>& transaction_context) const override;
+
+  Chunk _create_empty_chunk(const std::shared_ptr<const Table>& input_table) const override;
 };
 
 }  // namespace opossum
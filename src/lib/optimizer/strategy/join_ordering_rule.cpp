@@ -0,0 +1,601 @@
+#include "join_ordering_rule.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "optimizer/expression.hpp"
+#include "optimizer/table_statistics.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+using NodeSet = uint64_t;
+
+NodeSet single_node(const size_t node) { return NodeSet{1} << node; }
+
+bool contains(const NodeSet nodes, const size_t node) { return (nodes & single_node(node)) != 0; }
+
+// Calls the functor for each node of the set in ascending order
+template <typename Functor>
+void for_each_node(const NodeSet nodes, const Functor& functor) {
+  for (auto node = size_t{0}; node < std::numeric_limits<NodeSet>::digits; ++node) {
+    if (contains(nodes, node)) functor(node);
+  }
+}
+
+// Calls the functor for each non-empty subset of the set in ascending order of their bit patterns
+template <typename Functor>
+void for_each_subset(const NodeSet nodes, const Functor& functor) {
+  for (auto subset = nodes & (~nodes + 1); subset != 0; subset = nodes & (subset - nodes)) {
+    functor(subset);
+  }
+}
+
+bool is_comparison(const ScanType scan_type) {
+  return scan_type == ScanType::OpEquals || scan_type == ScanType::OpNotEquals || scan_type == ScanType::OpLessThan ||
+         scan_type == ScanType::OpLessThanEquals || scan_type == ScanType::OpGreaterThan ||
+         scan_type == ScanType::OpGreaterThanEquals;
+}
+
+// Returns the ScanType for the predicate with swapped operands, e.g., a < b for b > a
+ScanType flip_scan_type(const ScanType scan_type) {
+  switch (scan_type) {
+    case ScanType::OpLessThan:
+      return ScanType::OpGreaterThan;
+    case ScanType::OpLessThanEquals:
+      return ScanType::OpGreaterThanEquals;
+    case ScanType::OpGreaterThan:
+      return ScanType::OpLessThan;
+    case ScanType::OpGreaterThanEquals:
+      return ScanType::OpLessThanEquals;
+    default:
+      return scan_type;
+  }
+}
+
+/**
+ * Enumerates all pairs of a connected subgraph and a connected complement (csg-cmp-pairs) of a connected graph, as
+ * described in the DPccp paper. The nodes have to be numbered in breadth-first order. Then, each pair is emitted only
+ * once (not with swapped sides), and only after the pairs of all of its subgraphs.
+ */
+class CsgCmpPairEnumerator {
+ public:
+  using EmitPair = std::function<void(NodeSet, NodeSet)>;
+
+  CsgCmpPairEnumerator(const std::vector<NodeSet>& neighbors, const EmitPair& emit_pair)
+      : _neighbors(neighbors), _emit_pair(emit_pair) {}
+
+  void enumerate() const {
+    for (auto node = _neighbors.size(); node-- > 0;) {
+      _emit_csg(single_node(node));
+      _enumerate_csg_rec(single_node(node), _nodes_up_to(node));
+    }
+  }
+
+ private:
+  NodeSet _nodes_up_to(const size_t node) const { return (single_node(node) - 1) | single_node(node); }
+
+  NodeSet _neighborhood(const NodeSet nodes, const NodeSet excluded_nodes) const {
+    auto neighborhood = NodeSet{0};
+    for_each_node(nodes, [&](const size_t node) { neighborhood |= _neighbors[node]; });
+    return neighborhood & ~nodes & ~excluded_nodes;
+  }
+
+  // Emits the pairs of the connected subgraph and each of its connected complements with higher node numbers
+  void _emit_csg(const NodeSet csg) const {
+    auto lowest_node = size_t{0};
+    while (!contains(csg, lowest_node)) ++lowest_node;
+
+    const auto excluded_nodes = csg | _nodes_up_to(lowest_node);
+    const auto neighborhood = _neighborhood(csg, excluded_nodes);
+
+    for (auto node = _neighbors.size(); node-- > 0;) {
+      if (!contains(neighborhood, node)) continue;
+
+      _emit_pair(csg, single_node(node));
+      _enumerate_cmp_rec(csg, single_node(node), excluded_nodes | (neighborhood & _nodes_up_to(node)));
+    }
+  }
+
+  void _enumerate_csg_rec(const NodeSet csg, const NodeSet excluded_nodes) const {
+    const auto neighborhood = _neighborhood(csg, excluded_nodes);
+    for_each_subset(neighborhood, [&](const NodeSet subset) { _emit_csg(csg | subset); });
+    for_each_subset(neighborhood,
+                    [&](const NodeSet subset) { _enumerate_csg_rec(csg | subset, excluded_nodes | neighborhood); });
+  }
+
+  void _enumerate_cmp_rec(const NodeSet csg, const NodeSet cmp, const NodeSet excluded_nodes) const {
+    const auto neighborhood = _neighborhood(cmp, excluded_nodes);
+    for_each_subset(neighborhood, [&](const NodeSet subset) { _emit_pair(csg, cmp | subset); });
+    for_each_subset(neighborhood, [&](const NodeSet subset) {
+      _enumerate_cmp_rec(csg, cmp | subset, excluded_nodes | neighborhood);
+    });
+  }
+
+  const std::vector<NodeSet>& _neighbors;
+  const EmitPair& _emit_pair;
+};
+
+}  // namespace
+
+std::string JoinOrderingRule::name() const { return "Join Ordering Rule"; }
+
+bool JoinOrderingRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) {
+  if (!_is_join_graph_node(node)) {
+    return _apply_to_children(node);
+  }
+
+  auto join_graph = JoinGraph{};
+  join_graph.output_columns = _add_to_join_graph(node, true, join_graph);
+
+  // Predicates on a single relation are left to the PredicateReorderingRule
+  if (join_graph.relations.size() < 2) {
+    return _apply_to_children(node);
+  }
+
+  auto lqp_changed = false;
+
+  const auto can_be_ordered =
+      join_graph.relations.size() <= std::numeric_limits<RelationSet>::digits &&
+      std::all_of(join_graph.relations.begin(), join_graph.relations.end(),
+                  [&](const auto& relation) { return _provides_statistics(relation); });
+
+  if (can_be_ordered) {
+    join_graph.neighbors.resize(join_graph.relations.size());
+    for (const auto& join_predicate : join_graph.join_predicates) {
+      join_graph.neighbors[join_predicate.left_column.first] |= single_node(join_predicate.right_column.first);
+      join_graph.neighbors[join_predicate.right_column.first] |= single_node(join_predicate.left_column.first);
+    }
+
+    // Start with the plans for the single relations, with their local predicates applied
+    auto plans = JoinPlans{};
+    for (auto relation = size_t{0}; relation < join_graph.relations.size(); ++relation) {
+      auto plan = JoinPlan{};
+      plan.relation_order = {relation};
+      plan.statistics = join_graph.relations[relation]->get_statistics();
+      for (const auto& predicate : join_graph.local_predicates[relation]) {
+        plan.statistics = plan.statistics->predicate_statistics(predicate.column_id, predicate.scan_type,
+                                                                predicate.value, predicate.value2);
+      }
+      plans.emplace(single_node(relation), std::move(plan));
+    }
+
+    auto components = _connected_components(join_graph);
+    for (const auto component : components) {
+      if (std::bitset<std::numeric_limits<RelationSet>::digits>(component).count() <= MAX_RELATION_COUNT_FOR_DP) {
+        _order_by_dynamic_programming(join_graph, component, plans);
+      } else {
+        _order_greedily(join_graph, component, plans);
+      }
+    }
+
+    // Cross join the components, the smallest ones first
+    std::sort(components.begin(), components.end(), [&](const auto left, const auto right) {
+      return plans.at(left).statistics->row_count() < plans.at(right).statistics->row_count();
+    });
+
+    auto relations = components.front();
+    for (auto component_index = size_t{1}; component_index < components.size(); ++component_index) {
+      auto plan = _join_plans(join_graph, plans, relations, components[component_index]);
+      relations |= components[component_index];
+      plans.emplace(relations, std::move(plan));
+    }
+
+    const auto& best_plan = plans.at(relations);
+    if (best_plan.cost < _current_cost(node, join_graph)) {
+      auto join_tree = _build_join_tree(join_graph, plans, relations);
+
+      // Restore the order of the output columns if it changed
+      auto plan_output_columns = std::vector<RelationColumn>{};
+      for (const auto relation : best_plan.relation_order) {
+        for (auto column_id = ColumnID{0}; column_id < join_graph.relations[relation]->output_column_count();
+             ++column_id) {
+          plan_output_columns.emplace_back(relation, column_id);
+        }
+      }
+
+      if (plan_output_columns != join_graph.output_columns) {
+        auto column_ids = std::vector<ColumnID>{};
+        for (const auto& output_column : join_graph.output_columns) {
+          const auto iter = std::find(plan_output_columns.begin(), plan_output_columns.end(), output_column);
+          column_ids.emplace_back(static_cast<ColumnID::base_type>(iter - plan_output_columns.begin()));
+        }
+
+        const auto projection_node = std::make_shared<ProjectionNode>(Expression::create_columns(column_ids));
+        projection_node->set_left_child(join_tree);
+        join_tree = projection_node;
+      }
+
+      // Untie the join graph from its relations and put the new join tree in its place
+      const auto parents = node->parents();
+      const auto child_sides = node->get_child_sides();
+
+      for (const auto& join_graph_node : join_graph.nodes) {
+        join_graph_node->set_left_child(nullptr);
+        join_graph_node->set_right_child(nullptr);
+      }
+
+      for (size_t parent_idx = 0; parent_idx < parents.size(); ++parent_idx) {
+        parents[parent_idx]->set_child(child_sides[parent_idx], join_tree);
+      }
+
+      lqp_changed = true;
+    }
+  }
+
+  for (const auto& relation : join_graph.relations) {
+    lqp_changed |= apply_to(relation);
+  }
+
+  return lqp_changed;
+}
+
+std::vector<JoinOrderingRule::RelationColumn> JoinOrderingRule::_add_to_join_graph(
+    const std::shared_ptr<AbstractLQPNode>& node, bool is_topmost_node, JoinGraph& join_graph) const {
+  auto output_columns = std::vector<RelationColumn>{};
+
+  // A node that is used by other nodes as well cannot be moved, so the subtree starting with it is a relation
+  if (!_is_join_graph_node(node) || (!is_topmost_node && node->parents().size() > 1)) {
+    const auto relation = join_graph.relations.size();
+    join_graph.relations.emplace_back(node);
+    join_graph.local_predicates.emplace_back();
+
+    for (auto column_id = ColumnID{0}; column_id < node->output_column_count(); ++column_id) {
+      output_columns.emplace_back(relation, column_id);
+    }
+    return output_columns;
+  }
+
+  join_graph.nodes.emplace_back(node);
+  output_columns = _add_to_join_graph(node->left_child(), false, join_graph);
+
+  if (node->type() == LQPNodeType::Join) {
+    const auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
+    const auto right_columns = _add_to_join_graph(node->right_child(), false, join_graph);
+
+    if (join_node->join_mode() == JoinMode::Inner) {
+      const auto& join_column_ids = *join_node->join_column_ids();
+      join_graph.join_predicates.emplace_back(JoinPredicate{
+          output_columns[join_column_ids.first], *join_node->scan_type(), right_columns[join_column_ids.second]});
+    }
+
+    output_columns.insert(output_columns.end(), right_columns.begin(), right_columns.end());
+    return output_columns;
+  }
+
+  const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
+  const auto& column = output_columns[predicate_node->column_id()];
+  auto value = predicate_node->value();
+
+  if (value.type() == typeid(ColumnID)) {
+    const auto& value_column = output_columns[boost::get<ColumnID>(value)];
+    if (value_column.first != column.first) {
+      join_graph.join_predicates.emplace_back(JoinPredicate{column, predicate_node->scan_type(), value_column});
+      return output_columns;
+    }
+    value = value_column.second;
+  }
+
+  join_graph.local_predicates[column.first].emplace_back(
+      LocalPredicate{column.second, predicate_node->scan_type(), value, predicate_node->value2()});
+  return output_columns;
+}
+
+bool JoinOrderingRule::_is_join_graph_node(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type() == LQPNodeType::Join) {
+    const auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
+    return join_node->join_mode() == JoinMode::Cross ||
+           (join_node->join_mode() == JoinMode::Inner && is_comparison(*join_node->scan_type()));
+  }
+
+  if (node->type() == LQPNodeType::Predicate) {
+    // Predicates between two columns can only be join predicates if they are comparisons
+    const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
+    return predicate_node->value().type() != typeid(ColumnID) ||
+           (!predicate_node->value2() && is_comparison(predicate_node->scan_type()));
+  }
+
+  return false;
+}
+
+bool JoinOrderingRule::_provides_statistics(const std::shared_ptr<AbstractLQPNode>& node) const {
+  switch (node->type()) {
+    case LQPNodeType::StoredTable:
+    case LQPNodeType::Mock:
+      return true;
+
+    // These nodes keep the columns of their inputs in place, so the ColumnIDs of their statistics stay valid
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Validate:
+    case LQPNodeType::Sort:
+    case LQPNodeType::Limit:
+      return _provides_statistics(node->left_child());
+
+    case LQPNodeType::Join:
+      if (std::dynamic_pointer_cast<JoinNode>(node)->join_mode() == JoinMode::Natural) return false;
+      return _provides_statistics(node->left_child()) && _provides_statistics(node->right_child());
+
+    // Projections and Aggregates pass on the statistics of their input although they remap its columns
+    default:
+      return false;
+  }
+}
+
+JoinOrderingRule::RelationSet JoinOrderingRule::_neighborhood(const JoinGraph& join_graph,
+                                                              const RelationSet relations) const {
+  auto neighborhood = RelationSet{0};
+  for_each_node(relations, [&](const size_t relation) { neighborhood |= join_graph.neighbors[relation]; });
+  return neighborhood & ~relations;
+}
+
+std::vector<JoinOrderingRule::RelationSet> JoinOrderingRule::_connected_components(
+    const JoinGraph& join_graph) const {
+  auto remaining_relations = RelationSet{0};
+  for (auto relation = size_t{0}; relation < join_graph.relations.size(); ++relation) {
+    remaining_relations |= single_node(relation);
+  }
+
+  auto components = std::vector<RelationSet>{};
+  while (remaining_relations != 0) {
+    // Start with the remaining relation with the lowest number and add its neighbors until there are no more
+    auto component = remaining_relations & (~remaining_relations + 1);
+    for (auto neighborhood = _neighborhood(join_graph, component); neighborhood != 0;
+         neighborhood = _neighborhood(join_graph, component)) {
+      component |= neighborhood;
+    }
+
+    components.emplace_back(component);
+    remaining_relations &= ~component;
+  }
+
+  return components;
+}
+
+void JoinOrderingRule::_order_by_dynamic_programming(const JoinGraph& join_graph, const RelationSet component,
+                                                     JoinPlans& plans) const {
+  // Number the relations of the component in breadth-first order, as required by the CsgCmpPairEnumerator
+  auto relations = std::vector<size_t>{};
+  auto visited_relations = component & (~component + 1);
+  for_each_node(visited_relations, [&](const size_t relation) { relations.emplace_back(relation); });
+
+  for (auto node = size_t{0}; node < relations.size(); ++node) {
+    const auto unvisited_neighbors = join_graph.neighbors[relations[node]] & ~visited_relations;
+    for_each_node(unvisited_neighbors, [&](const size_t relation) { relations.emplace_back(relation); });
+    visited_relations |= unvisited_neighbors;
+  }
+
+  auto neighbors = std::vector<NodeSet>(relations.size());
+  for (auto node = size_t{0}; node < relations.size(); ++node) {
+    for (auto neighbor = size_t{0}; neighbor < relations.size(); ++neighbor) {
+      if (contains(join_graph.neighbors[relations[node]], relations[neighbor])) {
+        neighbors[node] |= single_node(neighbor);
+      }
+    }
+  }
+
+  const auto to_relation_set = [&](const NodeSet nodes) {
+    auto relation_set = RelationSet{0};
+    for_each_node(nodes, [&](const size_t node) { relation_set |= single_node(relations[node]); });
+    return relation_set;
+  };
+
+  const auto emit_pair = CsgCmpPairEnumerator::EmitPair{[&](const NodeSet csg, const NodeSet cmp) {
+    auto plan = _join_plans(join_graph, plans, to_relation_set(csg), to_relation_set(cmp));
+    const auto joined_relations = to_relation_set(csg | cmp);
+
+    const auto iter = plans.find(joined_relations);
+    if (iter == plans.end()) {
+      plans.emplace(joined_relations, std::move(plan));
+    } else if (plan.cost < iter->second.cost) {
+      iter->second = std::move(plan);
+    }
+  }};
+
+  CsgCmpPairEnumerator{neighbors, emit_pair}.enumerate();
+
+  DebugAssert(plans.count(component), "DPccp did not find a plan for the connected component");
+}
+
+void JoinOrderingRule::_order_greedily(const JoinGraph& join_graph, const RelationSet component,
+                                       JoinPlans& plans) const {
+  auto subplans = std::vector<RelationSet>{};
+  for_each_node(component, [&](const size_t relation) { subplans.emplace_back(single_node(relation)); });
+
+  // Join the two connected subplans with the smallest result until only one is left
+  while (subplans.size() > 1) {
+    auto best_plan = std::optional<JoinPlan>{};
+    auto best_left_index = size_t{0};
+    auto best_right_index = size_t{0};
+
+    for (auto left_index = size_t{0}; left_index < subplans.size(); ++left_index) {
+      for (auto right_index = left_index + 1; right_index < subplans.size(); ++right_index) {
+        if ((_neighborhood(join_graph, subplans[left_index]) & subplans[right_index]) == 0) continue;
+
+        auto plan = _join_plans(join_graph, plans, subplans[left_index], subplans[right_index]);
+        if (!best_plan || plan.statistics->row_count() < best_plan->statistics->row_count()) {
+          best_plan = std::move(plan);
+          best_left_index = left_index;
+          best_right_index = right_index;
+        }
+      }
+    }
+
+    DebugAssert(best_plan, "Subplans of a connected component must be connected");
+
+    const auto joined_relations = subplans[best_left_index] | subplans[best_right_index];
+    plans.emplace(joined_relations, std::move(*best_plan));
+    subplans[best_left_index] = joined_relations;
+    subplans.erase(subplans.begin() + best_right_index);
+  }
+}
+
+JoinOrderingRule::JoinPlan JoinOrderingRule::_join_plans(const JoinGraph& join_graph, const JoinPlans& plans,
+                                                         RelationSet left_relations,
+                                                         RelationSet right_relations) const {
+  if (plans.at(left_relations).statistics->row_count() < plans.at(right_relations).statistics->row_count()) {
+    std::swap(left_relations, right_relations);
+  }
+
+  const auto& left_plan = plans.at(left_relations);
+  const auto& right_plan = plans.at(right_relations);
+
+  auto plan = JoinPlan{};
+  plan.left_relations = left_relations;
+  plan.right_relations = right_relations;
+  plan.relation_order = left_plan.relation_order;
+  plan.relation_order.insert(plan.relation_order.end(), right_plan.relation_order.begin(),
+                             right_plan.relation_order.end());
+
+  // The statistics are derived just as JoinNode and PredicateNode derive them, so that _current_cost() yields the same
+  // cost for the join tree created from this plan
+  const auto predicates = _plan_join_predicates(join_graph, plans, left_relations, right_relations);
+  if (predicates.empty()) {
+    plan.statistics = left_plan.statistics->generate_cross_join_statistics(right_plan.statistics);
+  } else {
+    const auto& join_predicate = predicates.front();
+    plan.statistics = left_plan.statistics->generate_predicated_join_statistics(
+        right_plan.statistics, JoinMode::Inner, {join_predicate.left_column_id, join_predicate.right_column_id},
+        join_predicate.scan_type);
+  }
+
+  plan.cost = left_plan.cost + right_plan.cost + plan.statistics->row_count();
+
+  const auto left_column_count = _column_count(join_graph, left_plan);
+  for (auto predicate_index = size_t{1}; predicate_index < predicates.size(); ++predicate_index) {
+    const auto& predicate = predicates[predicate_index];
+    const auto right_column_id =
+        ColumnID{static_cast<ColumnID::base_type>(left_column_count + predicate.right_column_id)};
+    plan.statistics = plan.statistics->predicate_statistics(predicate.left_column_id, predicate.scan_type,
+                                                            right_column_id);
+  }
+
+  return plan;
+}
+
+std::vector<JoinOrderingRule::PlanJoinPredicate> JoinOrderingRule::_plan_join_predicates(
+    const JoinGraph& join_graph, const JoinPlans& plans, const RelationSet left_relations,
+    const RelationSet right_relations) const {
+  const auto& left_plan = plans.at(left_relations);
+  const auto& right_plan = plans.at(right_relations);
+
+  auto predicates = std::vector<PlanJoinPredicate>{};
+  for (const auto& join_predicate : join_graph.join_predicates) {
+    const auto& left_column = join_predicate.left_column;
+    const auto& right_column = join_predicate.right_column;
+
+    if (contains(left_relations, left_column.first) && contains(right_relations, right_column.first)) {
+      predicates.emplace_back(PlanJoinPredicate{_column_id_in_plan(join_graph, left_plan, left_column),
+                                                join_predicate.scan_type,
+                                                _column_id_in_plan(join_graph, right_plan, right_column)});
+    } else if (contains(left_relations, right_column.first) && contains(right_relations, left_column.first)) {
+      predicates.emplace_back(PlanJoinPredicate{_column_id_in_plan(join_graph, left_plan, right_column),
+                                                flip_scan_type(join_predicate.scan_type),
+                                                _column_id_in_plan(join_graph, right_plan, left_column)});
+    }
+  }
+
+  // Equi-predicates make for the fastest joins (see LQPTranslator)
+  std::stable_partition(predicates.begin(), predicates.end(),
+                        [](const auto& predicate) { return predicate.scan_type == ScanType::OpEquals; });
+
+  return predicates;
+}
+
+ColumnID JoinOrderingRule::_column_id_in_plan(const JoinGraph& join_graph, const JoinPlan& plan,
+                                              const RelationColumn& column) const {
+  auto column_offset = size_t{0};
+  for (const auto relation : plan.relation_order) {
+    if (relation == column.first) break;
+    column_offset += join_graph.relations[relation]->output_column_count();
+  }
+
+  return ColumnID{static_cast<ColumnID::base_type>(column_offset + column.second)};
+}
+
+size_t JoinOrderingRule::_column_count(const JoinGraph& join_graph, const JoinPlan& plan) const {
+  auto column_count = size_t{0};
+  for (const auto relation : plan.relation_order) {
+    column_count += join_graph.relations[relation]->output_column_count();
+  }
+  return column_count;
+}
+
+float JoinOrderingRule::_current_cost(const std::shared_ptr<AbstractLQPNode>& node,
+                                      const JoinGraph& join_graph) const {
+  if (std::find(join_graph.relations.begin(), join_graph.relations.end(), node) != join_graph.relations.end()) {
+    return 0.0f;
+  }
+
+  if (node->type() == LQPNodeType::Join) {
+    return _current_cost(node->left_child(), join_graph) + _current_cost(node->right_child(), join_graph) +
+           node->get_statistics()->row_count();
+  }
+
+  return _current_cost(node->left_child(), join_graph);
+}
+
+std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_build_join_tree(const JoinGraph& join_graph,
+                                                                    const JoinPlans& plans,
+                                                                    const RelationSet relations) const {
+  const auto& plan = plans.at(relations);
+
+  if (plan.left_relations == 0) {
+    const auto relation = plan.relation_order.front();
+    auto node = join_graph.relations[relation];
+
+    for (const auto& predicate : join_graph.local_predicates[relation]) {
+      const auto predicate_node =
+          std::make_shared<PredicateNode>(predicate.column_id, predicate.scan_type, predicate.value, predicate.value2);
+      predicate_node->set_left_child(node);
+      node = predicate_node;
+    }
+
+    return node;
+  }
+
+  const auto left_node = _build_join_tree(join_graph, plans, plan.left_relations);
+  const auto right_node = _build_join_tree(join_graph, plans, plan.right_relations);
+  const auto predicates = _plan_join_predicates(join_graph, plans, plan.left_relations, plan.right_relations);
+
+  auto join_node = std::shared_ptr<JoinNode>{};
+  if (predicates.empty()) {
+    join_node = std::make_shared<JoinNode>(JoinMode::Cross);
+  } else {
+    const auto& join_predicate = predicates.front();
+    const auto join_column_ids = std::make_pair(join_predicate.left_column_id, join_predicate.right_column_id);
+    join_node = std::make_shared<JoinNode>(JoinMode::Inner, join_column_ids, join_predicate.scan_type);
+  }
+  join_node->set_left_child(left_node);
+  join_node->set_right_child(right_node);
+
+  // The other join predicates are applied to the output of the join
+  auto node = std::shared_ptr<AbstractLQPNode>{join_node};
+  const auto left_column_count = left_node->output_column_count();
+  for (auto predicate_index = size_t{1}; predicate_index < predicates.size(); ++predicate_index) {
+    const auto& predicate = predicates[predicate_index];
+    const auto right_column_id =
+        ColumnID{static_cast<ColumnID::base_type>(left_column_count + predicate.right_column_id)};
+    const auto predicate_node = std::make_shared<PredicateNode>(predicate.left_column_id, predicate.scan_type,
+                                                                right_column_id);
+    predicate_node->set_left_child(node);
+    node = predicate_node;
+  }
+
+  return node;
+}
+
+}  // namespace opossum
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abstract_rule.hpp"
+#include "all_parameter_variant.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class TableStatistics;
+
+/**
+ * This optimizer rule reorders inner and cross joins based on the estimated row counts of their results.
+ * The rule rewrites, e.g., the LQP that the SQLTranslator creates for
+ *
+ * SELECT * FROM a, b, c WHERE a.id = c.a_id AND b.id = c.b_id AND a.x > 5
+ *
+ * i.e., Predicates above the Cross Joins of the FROM clause, to Inner Joins in the order with the smallest cost.
+ *
+ *
+ *
+ * HOW THIS WORKS
+ *
+ * The rule traverses the LQP recursively searching for join graphs, i.e., trees of Inner/Cross JoinNodes and
+ * PredicateNodes in which all nodes except for the topmost one have exactly one parent. The subtrees below a join
+ * graph are its relations (usually StoredTableNodes). Predicates on a single relation (a.x > 5) will be placed directly
+ * above it, predicates that compare the columns of two relations (a.id = c.a_id) are the edges of the join graph.
+ *
+ * The cost of a join order is the sum of the row counts of its joins, as estimated by the TableStatistics. For join
+ * graphs with up to MAX_RELATION_COUNT_FOR_DP relations, the rule finds the cheapest bushy join tree by dynamic
+ * programming over all pairs of connected subgraphs and their connected complements (DPccp, see Moerkotte & Neumann,
+ * "Analysis of Two Existing and One New Dynamic Programming Algorithm for the Generation of Optimal Bushy Join Trees
+ * without Cross Products", VLDB 2006). This way, cross products are never considered within a connected join graph.
+ * Larger join graphs are ordered greedily, joining the two connected subplans with the smallest result first. If the
+ * join graph is not connected, the plans of its connected components are cross joined, the smallest ones first.
+ *
+ * Of the edges between two subplans, the first equi-predicate (or the first one at all) becomes the condition of
+ * their JoinNode, the others become PredicateNodes above it. The new join tree replaces the join graph only if it is
+ * cheaper than the current one. Since the order of the output columns changes, a ProjectionNode restores it if needed.
+ *
+ * Note: Other nodes, such as Projections or Outer Joins, end a join graph, i.e., they are relations. The rule is
+ * applied to their inputs separately.
+ */
+class JoinOrderingRule : public AbstractRule {
+ public:
+  // Join graphs with more relations are ordered greedily
+  static constexpr size_t MAX_RELATION_COUNT_FOR_DP = 12;
+
+  std::string name() const override;
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) override;
+
+ private:
+  // A set of relations of a join graph, with one bit per relation
+  using RelationSet = uint64_t;
+
+  // A relation and one of its columns
+  using RelationColumn = std::pair<size_t, ColumnID>;
+
+  // A predicate that only references the columns of one relation, with the ColumnIDs of that relation
+  struct LocalPredicate {
+    ColumnID column_id;
+    ScanType scan_type;
+    AllParameterVariant value;
+    std::optional<AllTypeVariant> value2;
+  };
+
+  // A predicate that compares the columns of two relations, i.e., an edge of the join graph
+  struct JoinPredicate {
+    RelationColumn left_column;
+    ScanType scan_type;
+    RelationColumn right_column;
+  };
+
+  struct JoinGraph {
+    std::vector<std::shared_ptr<AbstractLQPNode>> relations;
+
+    // Per relation, in the order in which they are applied
+    std::vector<std::vector<LocalPredicate>> local_predicates;
+
+    std::vector<JoinPredicate> join_predicates;
+
+    // The nodes of the join graph, which are replaced if the join order changes
+    std::vector<std::shared_ptr<AbstractLQPNode>> nodes;
+
+    // The output columns of the topmost node
+    std::vector<RelationColumn> output_columns;
+
+    // Per relation, the relations it shares a join predicate with
+    std::vector<RelationSet> neighbors;
+  };
+
+  // The cheapest join tree found for a set of relations
+  struct JoinPlan {
+    // Both are empty for a single relation
+    RelationSet left_relations = 0;
+    RelationSet right_relations = 0;
+
+    // The relations in the order in which their columns appear in the output
+    std::vector<size_t> relation_order;
+
+    std::shared_ptr<TableStatistics> statistics;
+    float cost = 0.0f;
+  };
+
+  using JoinPlans = std::unordered_map<RelationSet, JoinPlan>;
+
+  // The predicates of a join between two plans, with the ColumnIDs of the left and the right plan, respectively
+  struct PlanJoinPredicate {
+    ColumnID left_column_id;
+    ScanType scan_type;
+    ColumnID right_column_id;
+  };
+
+  // Adds the node and its inputs to the join graph and returns its output columns
+  std::vector<RelationColumn> _add_to_join_graph(const std::shared_ptr<AbstractLQPNode>& node, bool is_topmost_node,
+                                                 JoinGraph& join_graph) const;
+
+  bool _is_join_graph_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  // The TableStatistics can only be estimated for subtrees of StoredTableNodes or MockNodes and nodes that keep
+  // the columns of their inputs in place (Predicates, Joins, Validates, Sorts, and Limits)
+  bool _provides_statistics(const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  // Returns the relations that share a join predicate with one of the relations, but are not among them
+  RelationSet _neighborhood(const JoinGraph& join_graph, RelationSet relations) const;
+
+  // Returns the sets of relations that are connected by join predicates
+  std::vector<RelationSet> _connected_components(const JoinGraph& join_graph) const;
+
+  void _order_by_dynamic_programming(const JoinGraph& join_graph, RelationSet component, JoinPlans& plans) const;
+  void _order_greedily(const JoinGraph& join_graph, RelationSet component, JoinPlans& plans) const;
+
+  // Returns the plan that joins the plans for the two sets of relations, the larger one being the left input
+  JoinPlan _join_plans(const JoinGraph& join_graph, const JoinPlans& plans, RelationSet left_relations,
+                       RelationSet right_relations) const;
+
+  // Returns the join predicates between the plans, equi-predicates first
+  std::vector<PlanJoinPredicate> _plan_join_predicates(const JoinGraph& join_graph, const JoinPlans& plans,
+                                                       RelationSet left_relations, RelationSet right_relations) const;
+
+  ColumnID _column_id_in_plan(const JoinGraph& join_graph, const JoinPlan& plan, const RelationColumn& column) const;
+
+  size_t _column_count(const JoinGraph& join_graph, const JoinPlan& plan) const;
+
+  // Returns the cost of the current join tree, as estimated for the JoinPlans
+  float _current_cost(const std::shared_ptr<AbstractLQPNode>& node, const JoinGraph& join_graph) const;
+
+  std::shared_ptr<AbstractLQPNode> _build_join_tree(const JoinGraph& join_graph, const JoinPlans& plans,
+                                                    RelationSet relations) const;
+};
+
+}  // namespace opossum
@@ -11,7 +11,9 @@
 
 #include "all_type_variant.hpp"
 #include "storage/dictionary_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/run_length_column.hpp"
 #include "storage/value_column.hpp"
 #include "utils/assert.hpp"
 
@@ -172,7 +174,7 @@ void resolve_data_type(DataType data_type, const Functor& func) {
  * Given a BaseColumn and its known column type, resolve the column implementation and call the lambda
  *
  * @param func is a generic lambda or similar accepting a reference to a specialized column (value, dictionary,
- * reference)
+ * run-length, frame-of-reference, reference). Frame-of-reference columns are only considered for integer types.
  *
  *
  * Example:
@@ -183,6 +185,12 @@ void resolve_data_type(DataType data_type, const Functor& func) {
  *   template <typename T>
  *   void process_column(DictionaryColumn<T>& column);
  *
+ *   template <typename T>
+ *   void process_column(RunLengthColumn<T>& column);
+ *
+ *   template <typename T>
+ *   void process_column(FrameOfReferenceColumn<T>& column);
+ *
  *   void process_column(ReferenceColumn& column);
  *
  *   resolve_column_type<T>(base_column, [&](auto& typed_column) {
@@ -198,15 +206,28 @@ std::enable_if_t<std::is_same<BaseColumn, std::remove_const_t<BaseColumnType>>::
     /*void*/ resolve_column_type(BaseColumnType& column, const Functor& func) {
   using ValueColumnPtr = ConstOutIfConstIn<BaseColumnType, ValueColumn<ColumnDataType>>*;
   using DictionaryColumnPtr = ConstOutIfConstIn<BaseColumnType, DictionaryColumn<ColumnDataType>>*;
+  using RunLengthColumnPtr = ConstOutIfConstIn<BaseColumnType, RunLengthColumn<ColumnDataType>>*;
   using ReferenceColumnPtr = ConstOutIfConstIn<BaseColumnType, ReferenceColumn>*;
 
   if (auto value_column = dynamic_cast<ValueColumnPtr>(&column)) {
     func(*value_column);
   } else if (auto dict_column = dynamic_cast<DictionaryColumnPtr>(&column)) {
     func(*dict_column);
+  } else if (auto run_length_column = dynamic_cast<RunLengthColumnPtr>(&column)) {
+    func(*run_length_column);
   } else if (auto ref_column = dynamic_cast<ReferenceColumnPtr>(&column)) {
     func(*ref_column);
   } else {
+    // FrameOfReferenceColumn<T> does not exist for non-integer types, so func must not be instantiated for them
+    if constexpr (supports_frame_of_reference_encoding_v<ColumnDataType>) {
+      using FrameOfReferenceColumnPtr = ConstOutIfConstIn<BaseColumnType, FrameOfReferenceColumn<ColumnDataType>>*;
+
+      if (auto frame_of_reference_column = dynamic_cast<FrameOfReferenceColumnPtr>(&column)) {
+        func(*frame_of_reference_column);
+        return;
+      }
+    }
+
     Fail("Unrecognized column type encountered.");
   }
 }
@@ -216,7 +237,7 @@ std::enable_if_t<std::is_same<BaseColumn, std::remove_const_t<BaseColumnType>>::
  *
  * @param data_type is an enum value of any of the supported column types
  * @param func is a generic lambda or similar accepting two parameters: a hana::type object and
- *   a reference to a specialized column (value, dictionary, reference)
+ *   a reference to a specialized column (value, dictionary, run-length, frame-of-reference, reference)
  *
  *
  * Example:
@@ -228,6 +249,12 @@ std::enable_if_t<std::is_same<BaseColumn, std::remove_const_t<BaseColumnType>>::
  *   void process_column(hana::basic_type<T> type, DictionaryColumn<T>& column);
  *
  *   template <typename T>
+ *   void process_column(hana::basic_type<T> type, RunLengthColumn<T>& column);
+ *
+ *   template <typename T>
+ *   void process_column(hana::basic_type<T> type, FrameOfReferenceColumn<T>& column);
+ *
+ *   template <typename T>
  *   void process_column(hana::basic_type<T> type, ReferenceColumn& column);
  *
  *   resolve_data_and_column_type(data_type, base_column, [&](auto type, auto& typed_column) {
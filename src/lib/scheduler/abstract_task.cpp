@@ -7,6 +7,7 @@
 
 #include "abstract_scheduler.hpp"
 #include "current_scheduler.hpp"
+#include "query_group.hpp"
 #include "task_queue.hpp"
 #include "worker.hpp"
 
@@ -14,6 +15,8 @@
 
 namespace opossum {
 
+AbstractTask::AbstractTask() : _query_group(QueryGroup::current()) {}
+
 TaskID AbstractTask::id() const { return _id; }
 
 NodeID AbstractTask::node_id() const { return _node_id; }
@@ -39,6 +42,16 @@ void AbstractTask::set_as_predecessor_of(std::shared_ptr<AbstractTask> successor
 
 void AbstractTask::set_node_id(NodeID node_id) { _node_id = node_id; }
 
+const std::shared_ptr<QueryGroup>& AbstractTask::query_group() const { return _query_group; }
+
+void AbstractTask::set_query_group(std::shared_ptr<QueryGroup> query_group) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the QueryGroup after the Task was scheduled");
+
+  _query_group = std::move(query_group);
+}
+
+SchedulePriority AbstractTask::priority() const { return _priority; }
+
 bool AbstractTask::try_mark_as_enqueued() { return !_is_enqueued.exchange(true); }
 
 void AbstractTask::set_done_callback(const std::function<void()>& done_callback) {
@@ -50,6 +63,9 @@ void AbstractTask::set_done_callback(const std::function<void()>& done_callback)
 void AbstractTask::schedule(NodeID preferred_node_id, SchedulePriority priority) {
   _mark_as_scheduled();
 
+  if (priority == SchedulePriority::Normal && _query_group) priority = _query_group->priority();
+  _priority = priority;
+
   if (CurrentScheduler::is_set()) {
     CurrentScheduler::get()->schedule(shared_from_this(), preferred_node_id, priority);
   } else {
@@ -85,7 +101,9 @@ void AbstractTask::execute() {
   DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
+  const auto previous_query_group = QueryGroup::set_current(_query_group);
   _on_execute();
+  QueryGroup::set_current(previous_query_group);
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
@@ -115,7 +133,9 @@ void AbstractTask::_on_predecessor_done() {
       auto worker = Worker::get_this_thread_worker();
       DebugAssert(static_cast<bool>(worker), "No worker");
 
-      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::High));
+      // Tasks that become ready are preferred, unless they belong to a group with a different priority
+      _priority = _query_group ? _query_group->priority() : SchedulePriority::High;
+      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(_priority));
     } else {
       if (_is_scheduled) execute();
       // Otherwise it will get execute()d once it is scheduled. It is entirely possible for Tasks to "become ready"
@@ -12,6 +12,7 @@
 
 namespace opossum {
 
+class QueryGroup;
 class Worker;
 
 /**
@@ -23,6 +24,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   friend class Worker;
 
  public:
+  // The task belongs to the QueryGroup that is current on the creating thread
+  AbstractTask();
   virtual ~AbstractTask() = default;
 
   /**
@@ -63,6 +66,19 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * The QueryGroup of the task, may be nullptr. Its priority is used when the task is scheduled with the Normal
+   * priority, and Workers only execute the task if the group does not occupy too many Workers already.
+   */
+  const std::shared_ptr<QueryGroup>& query_group() const;
+  void set_query_group(std::shared_ptr<QueryGroup> query_group);
+
+  /**
+   * The priority with which the task is put into a TaskQueue, i.e., the one passed to schedule() or the priority of
+   * its QueryGroup instead of Normal. Workers that defer the task put it back with this priority.
+   */
+  SchedulePriority priority() const;
+
   /**
    * Callback to be executed right after the Task finished.
    * Notice the execution of the callback might happen on ANY thread
@@ -94,7 +110,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   bool try_mark_as_enqueued();
 
   /**
-   * Executes the task in the current Thread, blocks until all operations are finished
+   * Executes the task in the current Thread, blocks until all operations are finished. The QueryGroup of the task is
+   * current while it is executed, so that the tasks it creates belong to the same group.
    */
   void execute();
 
@@ -124,6 +141,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   TaskID _id = INVALID_TASK_ID;
   NodeID _node_id = INVALID_NODE_ID;
+  std::shared_ptr<QueryGroup> _query_group;
+  SchedulePriority _priority = SchedulePriority::Normal;
   bool _done = false;
   std::function<void()> _done_callback;
 
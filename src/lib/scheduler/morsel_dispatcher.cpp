@@ -0,0 +1,187 @@
+#include "morsel_dispatcher.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "abstract_scheduler.hpp"
+#include "current_scheduler.hpp"
+#include "job_task.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "task_queue.hpp"
+#include "topology.hpp"
+#include "utils/assert.hpp"
+#include "utils/numa_memory_resource.hpp"
+#include "worker.hpp"
+
+namespace {
+
+std::atomic<size_t> default_morsel_size_setting{opossum::MorselDispatcher::DEFAULT_MORSEL_SIZE};
+
+}  // namespace
+
+namespace opossum {
+
+bool ChunkRange::covers_chunk(const Table& table) const {
+  return begin == 0u && end == table.get_chunk(chunk_id).size();
+}
+
+std::shared_ptr<const BaseColumn> ChunkRange::column(const std::shared_ptr<const Table>& table,
+                                                     const ColumnID column_id) const {
+  auto column = table->get_chunk(chunk_id).get_column(column_id);
+  if (covers_chunk(*table)) return column;
+
+  if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+    const auto& pos_list = *reference_column->pos_list();
+    const auto range_pos_list = std::make_shared<PosList>(pos_list.cbegin() + begin, pos_list.cbegin() + end);
+    return std::make_shared<ReferenceColumn>(reference_column->referenced_table(),
+                                             reference_column->referenced_column_id(), range_pos_list);
+  }
+
+  auto range_pos_list = std::make_shared<PosList>(size());
+  for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+    (*range_pos_list)[chunk_offset - begin] = RowID{chunk_id, chunk_offset};
+  }
+  return std::make_shared<ReferenceColumn>(table, column_id, range_pos_list);
+}
+
+size_t Morsel::row_count() const {
+  return std::accumulate(ranges.cbegin(), ranges.cend(), size_t{0},
+                         [](const size_t sum, const ChunkRange& range) { return sum + range.size(); });
+}
+
+size_t MorselDispatcher::default_morsel_size() { return default_morsel_size_setting; }
+
+void MorselDispatcher::set_default_morsel_size(const size_t morsel_size) {
+  Assert(morsel_size > 0u, "Morsels must not be empty.");
+  default_morsel_size_setting = morsel_size;
+}
+
+void MorselDispatcher::reset_default_morsel_size() { default_morsel_size_setting = DEFAULT_MORSEL_SIZE; }
+
+MorselDispatcher::MorselDispatcher(const Table& table, const std::vector<ChunkID>& chunk_ids,
+                                   const size_t morsel_size) {
+  DebugAssert(morsel_size > 0u, "Morsels must not be empty.");
+  DebugAssert(std::is_sorted(chunk_ids.cbegin(), chunk_ids.cend()), "Chunks have to be given in ascending order.");
+
+  const auto node_count = CurrentScheduler::is_set() ? CurrentScheduler::get()->topology()->nodes().size() : size_t{1};
+
+  auto morsel = Morsel{};
+  auto morsel_row_count = size_t{0};
+  const auto finish_morsel = [&]() {
+    if (morsel.ranges.empty()) return;
+    _morsels.emplace_back(std::move(morsel));
+    morsel = Morsel{};
+    morsel_row_count = 0u;
+  };
+
+  for (const auto chunk_id : chunk_ids) {
+    const auto& chunk = table.get_chunk(chunk_id);
+
+    // Chunks that were not allocated by a NUMAMemoryResource are treated as if they were on the first node
+    const auto memory_resource = dynamic_cast<NUMAMemoryResource*>(chunk.get_allocator().resource());
+    const auto chunk_node_id =
+        memory_resource && memory_resource->get_node_id() != NUMAMemoryResource::UNDEFINED_NODE_ID
+            ? NodeID{static_cast<NodeID::base_type>(static_cast<size_t>(memory_resource->get_node_id()) % node_count)}
+            : NodeID{0};
+
+    // A morsel only contains rows of one node
+    if (chunk_node_id != morsel.node_id) finish_morsel();
+    morsel.node_id = chunk_node_id;
+
+    auto begin = ChunkOffset{0};
+    while (begin < chunk.size()) {
+      const auto end = static_cast<ChunkOffset>(std::min(size_t{chunk.size()}, begin + morsel_size - morsel_row_count));
+      morsel.ranges.emplace_back(ChunkRange{chunk_id, begin, end});
+      morsel_row_count += end - begin;
+      begin = end;
+
+      if (morsel_row_count == morsel_size) {
+        finish_morsel();
+        morsel.node_id = chunk_node_id;
+      }
+    }
+  }
+  finish_morsel();
+
+  _morsel_ids_per_node.resize(node_count);
+  for (auto morsel_id = size_t{0}; morsel_id < _morsels.size(); ++morsel_id) {
+    _morsel_ids_per_node[_morsels[morsel_id].node_id].emplace_back(morsel_id);
+  }
+  _next_index_per_node = std::vector<std::atomic<size_t>>(node_count);
+}
+
+MorselDispatcher::MorselDispatcher(const Table& table, const size_t morsel_size)
+    : MorselDispatcher(table,
+                       [&]() {
+                         auto chunk_ids = std::vector<ChunkID>(table.chunk_count());
+                         std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0});
+                         return chunk_ids;
+                       }(),
+                       morsel_size) {}
+
+const std::vector<Morsel>& MorselDispatcher::morsels() const { return _morsels; }
+
+void MorselDispatcher::process(const std::function<void(size_t, const Morsel&)>& functor) {
+  if (!CurrentScheduler::is_set()) {
+    for (auto morsel_id = size_t{0}; morsel_id < _morsels.size(); ++morsel_id) {
+      functor(morsel_id, _morsels[morsel_id]);
+    }
+    return;
+  }
+
+  const auto& nodes = CurrentScheduler::get()->topology()->nodes();
+
+  const auto process_morsels = [&](const NodeID scheduled_node_id) {
+    // The task might have been stolen by a worker of another node
+    const auto worker = Worker::get_this_thread_worker();
+    const auto node_id = worker ? worker->queue()->node_id() : scheduled_node_id;
+
+    while (const auto morsel_id = _next_morsel_id(node_id)) {
+      functor(*morsel_id, _morsels[*morsel_id]);
+
+      // Between two morsels, a long-running query gives way to more urgent queries
+      if (worker) worker->yield_to_more_urgent_tasks();
+    }
+  };
+
+  // One job per CPU, where the first CPUs of all nodes come first, so that few jobs are spread over the nodes
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  const auto max_cpu_count_per_node =
+      std::max_element(nodes.cbegin(), nodes.cend(), [](const auto& left, const auto& right) {
+        return left.cpus.size() < right.cpus.size();
+      })->cpus.size();
+
+  for (auto cpu_index = size_t{0}; cpu_index < max_cpu_count_per_node; ++cpu_index) {
+    for (NodeID node_id{0}; node_id < nodes.size() && jobs.size() < _morsels.size(); ++node_id) {
+      if (cpu_index >= nodes[node_id].cpus.size()) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, node_id]() { process_morsels(node_id); }));
+      jobs.back()->schedule(node_id);
+    }
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+std::optional<size_t> MorselDispatcher::_next_morsel_id(const NodeID node_id) {
+  const auto node_count = _morsel_ids_per_node.size();
+
+  for (auto offset = size_t{0}; offset < node_count; ++offset) {
+    const auto current_node_id = (node_id + offset) % node_count;
+    const auto& morsel_ids = _morsel_ids_per_node[current_node_id];
+    auto& next_index = _next_index_per_node[current_node_id];
+
+    // Check first, so that the counters of exhausted nodes are not incremented over and over again
+    if (next_index.load(std::memory_order_relaxed) >= morsel_ids.size()) continue;
+
+    const auto index = next_index++;
+    if (index < morsel_ids.size()) return morsel_ids[index];
+  }
+
+  return std::nullopt;
+}
+
+}  // namespace opossum
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Table;
+
+/**
+ * A range of consecutive rows of one chunk
+ */
+struct ChunkRange {
+  ChunkID chunk_id;
+  ChunkOffset begin;
+  ChunkOffset end;
+
+  ChunkOffset size() const { return end - begin; }
+
+  bool covers_chunk(const Table& table) const;
+
+  /**
+   * Returns the column of the chunk if the range covers the whole chunk. Otherwise, returns a ReferenceColumn that
+   * only contains the rows of the range, so that the i-th value of the returned column is the value at begin + i.
+   */
+  std::shared_ptr<const BaseColumn> column(const std::shared_ptr<const Table>& table, const ColumnID column_id) const;
+};
+
+/**
+ * A unit of work of an operator, i.e., roughly MorselDispatcher::default_morsel_size() consecutive rows of its input.
+ * Large chunks are split into several morsels, while the rows of consecutive small chunks are combined into one.
+ */
+struct Morsel {
+  std::vector<ChunkRange> ranges;
+
+  // The NUMA node on which the chunks of the morsel are allocated
+  NodeID node_id{0};
+
+  size_t row_count() const;
+};
+
+/**
+ * @brief Distributes the rows of a table as morsels to a fixed number of workers
+ *
+ * Operators that split their work by chunks get one task per chunk, so that one huge chunk serializes their work and
+ * thousands of small chunks flood the scheduler. Instead, process() starts one JobTask per CPU (but no more than there
+ * are morsels), and each of them repeatedly fetches the next morsel until none are left. The tasks prefer morsels of
+ * their own NUMA node and only take those of other nodes once their node has none left.
+ *
+ * This way, the degree of parallelism is independent of Chunk::MAX_SIZE and of how fragmented an intermediate result
+ * is. Operators process a morsel range by range (see ChunkRange::column()), so that they handle ranges of chunks
+ * just like whole chunks.
+ *
+ * Between two morsels, the tasks check for more urgent tasks (see Worker::yield_to_more_urgent_tasks()), so that
+ * the morsels are the preemption points of long-running queries.
+ */
+class MorselDispatcher : private Noncopyable {
+ public:
+  static constexpr size_t DEFAULT_MORSEL_SIZE = 50'000u;
+
+  /**
+   * The morsel size used by the operators. Can be changed for benchmarks and tests. Is reset by
+   * reset_default_morsel_size().
+   */
+  static size_t default_morsel_size();
+  static void set_default_morsel_size(const size_t morsel_size);
+  static void reset_default_morsel_size();
+
+  // Splits the given chunks of the table (in ascending order) into morsels. Empty chunks are skipped.
+  MorselDispatcher(const Table& table, const std::vector<ChunkID>& chunk_ids,
+                   const size_t morsel_size = default_morsel_size());
+
+  // Splits all chunks of the table into morsels
+  explicit MorselDispatcher(const Table& table, const size_t morsel_size = default_morsel_size());
+
+  const std::vector<Morsel>& morsels() const;
+
+  /**
+   * Calls functor(morsel_id, morsel) once for each morsel, where morsel_id is the index of the morsel in morsels().
+   * Returns once all morsels have been processed. Without a scheduler, the morsels are processed in order.
+   */
+  void process(const std::function<void(size_t, const Morsel&)>& functor);
+
+ private:
+  // Returns the id of a morsel that has not been handed out yet, preferably one of the given node
+  std::optional<size_t> _next_morsel_id(const NodeID node_id);
+
+  std::vector<Morsel> _morsels;
+
+  // The ids of the morsels of each node and the index of the next one to be handed out
+  std::vector<std::vector<size_t>> _morsel_ids_per_node;
+  std::vector<std::atomic<size_t>> _next_index_per_node;
+};
+
+}  // namespace opossum
@@ -56,20 +56,28 @@ namespace opossum {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
- * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
- * pull a ready task. This occurs in two cases:
- *  1) all tasks in the queue are not ready
- *  2) the queue is empty
- * In both cases the current worker is checking another queue for a ready task. Checking another queue means accessing
- * another node (remote node). As of the physical distance of nodes, accessing a remote nodes is ~1.6 times slower than
- * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ * Each Worker owns a lock-free WorkStealingDeque. Tasks that a Worker schedules on its own node are pushed to its
+ * deque, and the Worker pops them in LIFO order, so that it works on data that is still in its caches. A worker gets
+ * idle if its deque and the TaskQueue of its node are empty. It then steals the oldest task of a randomly chosen Worker
+ * of the same node. Only if there is none, it steals from other nodes (remote nodes). As of the physical distance of
+ * nodes, accessing a remote nodes is ~1.6 times slower than accessing a local node. [1]
+ * If a Worker does not find any task at all, it parks on the TaskQueue of its node (using a futex on Linux) until a
+ * task is pushed to that node or TaskQueue::PARKING_TIMEOUT expires. Thus, a worker is woken up right away for local
+ * tasks, while remote tasks are only stolen if the remote node has not found a worker for them in the meantime.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
+ *
+ *
+ * QUERY GROUPS
+ *
+ * Without further measures, one large analytical query fills all TaskQueues with its jobs and short transactions
+ * wait behind them. Therefore, tasks can be tagged with a QueryGroup, which they inherit from the task that creates
+ * them. A group determines the priority of its tasks (with Low for long-running queries), its weight, and optionally
+ * a maximum number of Workers. Before executing a task, a Worker checks whether the task's group already occupies its
+ * share of the Workers, i.e., a share proportional to its weight among all groups that currently run tasks. If so,
+ * the task is deferred in favor of tasks of other groups. Finally, the tasks that process morsels (see
+ * MorselDispatcher) execute more urgent tasks of their node between two morsels, so that a long-running query does
+ * not block a Worker for longer than one morsel.
  */
 
 class ProcessingUnit;
@@ -1,12 +1,14 @@
 #include "operator_task.hpp"
 
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "concurrency/transaction_manager.hpp"
 
 #include "operators/abstract_operator.hpp"
+#include "operators/abstract_pipeline_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 
 #include "scheduler/job_task.hpp"
@@ -14,6 +16,35 @@
 #include "scheduler/worker.hpp"
 
 namespace opossum {
+
+namespace {
+
+using ConsumerCounts = std::unordered_map<const AbstractOperator*, size_t>;
+
+void count_consumers(const std::shared_ptr<const AbstractOperator>& op, ConsumerCounts& consumer_counts) {
+  for (const auto& input : {op->input_left(), op->input_right()}) {
+    if (!input) continue;
+
+    // Operators that are used as input more than once are only visited once
+    if (consumer_counts[input.get()]++ == 0u) count_consumers(input, consumer_counts);
+  }
+}
+
+void fuse_pipeline_operators(const std::shared_ptr<AbstractOperator>& op, const ConsumerCounts& consumer_counts) {
+  const auto pipeline_operator = std::dynamic_pointer_cast<AbstractPipelineOperator>(op);
+  if (pipeline_operator && !pipeline_operator->input_is_fused() && !op->operator_task() &&
+      pipeline_operator->can_fuse_input()) {
+    const auto input = op->mutable_input_left();
+    if (consumer_counts.at(input.get()) == 1u && !input->operator_task()) pipeline_operator->fuse_input();
+  }
+
+  for (const auto& input : {op->mutable_input_left(), op->mutable_input_right()}) {
+    if (input) fuse_pipeline_operators(input, consumer_counts);
+  }
+}
+
+}  // namespace
+
 OperatorTask::OperatorTask(std::shared_ptr<AbstractOperator> op) : _op(std::move(op)) {}
 
 std::string OperatorTask::description() const {
@@ -21,7 +52,13 @@ std::string OperatorTask::description() const {
 }
 
 const std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_operator(
-    std::shared_ptr<AbstractOperator> op) {
+    std::shared_ptr<AbstractOperator> op, bool fuse_pipelines) {
+  if (fuse_pipelines) {
+    auto consumer_counts = ConsumerCounts{};
+    count_consumers(op, consumer_counts);
+    fuse_pipeline_operators(op, consumer_counts);
+  }
+
   std::vector<std::shared_ptr<OperatorTask>> tasks;
   OperatorTask::_add_tasks_from_operator(op, tasks);
   return tasks;
@@ -39,12 +76,20 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
     add_task = true;
   }
 
-  if (auto left = op->mutable_input_left()) {
+  // The operators fused into the pipeline of op are executed by its task, so that the input of the pipeline's first
+  // operator is the one that has to be executed before
+  auto first_pipeline_operator = op;
+  while (const auto pipeline_operator = std::dynamic_pointer_cast<AbstractPipelineOperator>(first_pipeline_operator)) {
+    if (!pipeline_operator->input_is_fused()) break;
+    first_pipeline_operator = first_pipeline_operator->mutable_input_left();
+  }
+
+  if (auto left = first_pipeline_operator->mutable_input_left()) {
     auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks);
     subtree_root->set_as_predecessor_of(task);
   }
 
-  if (auto right = op->mutable_input_right()) {
+  if (auto right = first_pipeline_operator->mutable_input_right()) {
     auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks);
     subtree_root->set_as_predecessor_of(task);
   }
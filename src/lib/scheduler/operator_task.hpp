@@ -18,9 +18,13 @@ class OperatorTask : public AbstractTask {
 
   /**
    * Create tasks recursively from result operator and set task dependencies automatically.
+   *
+   * If fuse_pipelines is set, chains of AbstractPipelineOperators are fused into pipelines, which are executed by the
+   * task of their last operator. Operators that are consumed by more than one operator are never fused into a
+   * pipeline, because their output is needed twice.
    */
   static const std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
-      std::shared_ptr<AbstractOperator> op);
+      std::shared_ptr<AbstractOperator> op, bool fuse_pipelines = true);
 
   const std::shared_ptr<AbstractOperator>& get_operator() const;
 
@@ -0,0 +1,74 @@
+#include "query_group.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+thread_local std::shared_ptr<opossum::QueryGroup> current_query_group;
+
+// Sum of the weights of all groups with at least one active Worker. Signed, because a group that becomes idle might
+// subtract its weight before another thread added it.
+std::atomic<int64_t> active_weight_sum{0};
+
+}  // namespace
+
+namespace opossum {
+
+QueryGroup::QueryGroup(const SchedulePriority priority, const uint32_t weight, const size_t max_worker_count)
+    : _priority(priority), _weight(weight), _max_worker_count(max_worker_count) {
+  Assert(weight > 0u, "A QueryGroup needs a positive weight.");
+  Assert(priority != SchedulePriority::Unstealable, "Unstealable is not a priority of a QueryGroup.");
+}
+
+std::shared_ptr<QueryGroup> QueryGroup::current() { return ::current_query_group; }
+
+std::shared_ptr<QueryGroup> QueryGroup::set_current(std::shared_ptr<QueryGroup> query_group) {
+  return std::exchange(::current_query_group, std::move(query_group));
+}
+
+SchedulePriority QueryGroup::priority() const { return _priority; }
+
+uint32_t QueryGroup::weight() const { return _weight; }
+
+size_t QueryGroup::max_worker_count() const { return _max_worker_count; }
+
+size_t QueryGroup::active_worker_count() const { return _active_worker_count; }
+
+bool QueryGroup::try_acquire_worker(const size_t worker_count, const bool enforce_fair_share) {
+  auto active_worker_count = _active_worker_count.load();
+
+  while (true) {
+    auto limit = _max_worker_count == UNLIMITED_WORKER_COUNT ? worker_count : _max_worker_count;
+
+    if (enforce_fair_share) {
+      // If this group is not active yet, it competes with the active groups as soon as it gets a Worker
+      const auto weight_sum = std::max(::active_weight_sum.load() + (active_worker_count == 0u ? _weight : 0),
+                                       static_cast<int64_t>(_weight));
+      const auto fair_share = (worker_count * _weight + weight_sum - 1u) / weight_sum;
+      limit = std::min(limit, std::max(fair_share, size_t{1u}));
+    }
+
+    if (active_worker_count >= limit) return false;
+    if (_active_worker_count.compare_exchange_weak(active_worker_count, active_worker_count + 1u)) break;
+  }
+
+  if (active_worker_count == 0u) ::active_weight_sum += _weight;
+  return true;
+}
+
+void QueryGroup::acquire_worker() {
+  if (_active_worker_count++ == 0u) ::active_weight_sum += _weight;
+}
+
+void QueryGroup::release_worker() {
+  const auto previous_worker_count = _active_worker_count--;
+  DebugAssert(previous_worker_count > 0u, "QueryGroup released more Workers than it acquired.");
+
+  if (previous_worker_count == 1u) ::active_weight_sum -= _weight;
+}
+
+}  // namespace opossum
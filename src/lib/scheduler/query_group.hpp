@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Tags all tasks of one query (or of any other unit of work, e.g., a transaction), so that the NodeQueueScheduler can
+ * keep one query from occupying all Workers while others wait.
+ *
+ * Tasks inherit the QueryGroup that is current on the thread that creates them (see QueryGroup::current()). A Worker
+ * makes the group of a task current while executing it, so that all jobs spawned by an operator belong to the query
+ * of that operator. Clients set the group of a query before creating its tasks.
+ *
+ * Each group
+ *  - schedules its tasks with its priority (e.g., High for OLTP transactions, Low for reports),
+ *  - gets a share of the Workers proportional to its weight among the groups that are currently running tasks. Tasks
+ *    of groups that exceed their share are only executed if a Worker does not find any other task.
+ *  - can be limited to max_worker_count Workers, beyond which its tasks wait even if Workers are idle.
+ */
+class QueryGroup : private Noncopyable {
+ public:
+  static constexpr size_t UNLIMITED_WORKER_COUNT = 0u;
+
+  explicit QueryGroup(SchedulePriority priority = SchedulePriority::Normal, uint32_t weight = 1u,
+                      size_t max_worker_count = UNLIMITED_WORKER_COUNT);
+
+  /**
+   * The group of the task that is executed on this thread, or the one set by set_current() on other threads.
+   * nullptr if there is none.
+   */
+  static std::shared_ptr<QueryGroup> current();
+
+  // Returns the previously current group, so that it can be restored
+  static std::shared_ptr<QueryGroup> set_current(std::shared_ptr<QueryGroup> query_group);
+
+  SchedulePriority priority() const;
+  uint32_t weight() const;
+  size_t max_worker_count() const;
+  size_t active_worker_count() const;
+
+  /**
+   * To be called by a Worker before it executes a task of this group. Fails if the group already occupies
+   * max_worker_count Workers or, if enforce_fair_share is set, its share of the given number of Workers.
+   */
+  bool try_acquire_worker(size_t worker_count, bool enforce_fair_share);
+
+  // Acquires a Worker regardless of the limits, e.g., for a task that resumes after waiting for other tasks
+  void acquire_worker();
+
+  // To be called once the task is done, or while the Worker waits for other tasks
+  void release_worker();
+
+ private:
+  const SchedulePriority _priority;
+  const uint32_t _weight;
+  const size_t _max_worker_count;
+
+  std::atomic<size_t> _active_worker_count{0u};
+};
+
+}  // namespace opossum
@@ -1,16 +1,62 @@
 #include "task_queue.hpp"
 
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <ctime>
 #include <memory>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "abstract_task.hpp"
 #include "utils/assert.hpp"
+#include "work_stealing_deque.hpp"
+#include "worker.hpp"
 
 namespace opossum {
 
-TaskQueue::TaskQueue(NodeID node_id) : _node_id(node_id) {}
+namespace {
+
+// Blocks until *address no longer contains expected_value and someone calls futex_wake(), or until the timeout expires
+void futex_wait(std::atomic<uint32_t>& address, const uint32_t expected_value, const std::chrono::nanoseconds timeout) {
+#if defined(__linux__)
+  static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futexes need a plain 32-bit word");
+
+  auto timeout_spec = timespec{};
+  timeout_spec.tv_sec = static_cast<time_t>(timeout.count() / 1'000'000'000);
+  timeout_spec.tv_nsec = static_cast<long>(timeout.count() % 1'000'000'000);  // NOLINT
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(&address), FUTEX_WAIT_PRIVATE, expected_value, &timeout_spec,
+          nullptr, 0);
+#else
+  if (address.load() == expected_value) std::this_thread::sleep_for(timeout);
+#endif
+}
+
+void futex_wake_one(std::atomic<uint32_t>& address) {
+#if defined(__linux__)
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(&address), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#endif
+}
+
+}  // namespace
 
-bool TaskQueue::empty() const { return _num_tasks == 0; }
+TaskQueue::TaskQueue(NodeID node_id)
+    : _node_id(node_id), _worker_deques(std::make_shared<std::vector<std::shared_ptr<WorkStealingDeque>>>()) {}
+
+bool TaskQueue::empty() const {
+  if (_num_tasks != 0) return false;
+
+  const auto worker_deques = std::atomic_load(&_worker_deques);
+  for (const auto& deque : *worker_deques) {
+    if (!deque->empty()) return false;
+  }
+  return true;
+}
 
 NodeID TaskQueue::node_id() const { return _node_id; }
 
@@ -21,9 +67,19 @@ void TaskQueue::push(std::shared_ptr<AbstractTask> task, uint32_t priority) {
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
 
-  _num_tasks++;
+  // Workers of this node keep their tasks in their own deque, unless the task must not be stolen by other nodes or
+  // must not be preferred over the tasks in the queues
+  const auto worker = Worker::get_this_thread_worker();
+  if (worker && worker->queue().get() == this && priority != static_cast<uint32_t>(SchedulePriority::Unstealable) &&
+      priority != static_cast<uint32_t>(SchedulePriority::Low)) {
+    worker->deque().push(std::move(task));
+  } else {
+    _queues[priority].push(std::move(task));
+    _num_tasks++;
+  }
+
+  _notify_parked_worker();
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull() {
@@ -39,9 +95,31 @@ std::shared_ptr<AbstractTask> TaskQueue::pull() {
   return nullptr;
 }
 
+std::shared_ptr<AbstractTask> TaskQueue::pull_more_urgent_than(SchedulePriority priority) {
+  if (_num_tasks == 0) return nullptr;
+
+  std::shared_ptr<AbstractTask> task;
+  for (auto queue_index = uint32_t{0}; queue_index < static_cast<uint32_t>(priority); ++queue_index) {
+    _queues[queue_index].try_pop(task);
+
+    if (task) {
+      _num_tasks--;
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+void TaskQueue::defer(std::shared_ptr<AbstractTask> task, uint32_t priority) {
+  DebugAssert((priority < NUM_PRIORITY_LEVELS), "Illegal priority level");
+
+  _queues[priority].push(std::move(task));
+  _num_tasks++;
+}
+
 std::shared_ptr<AbstractTask> TaskQueue::steal() {
   std::shared_ptr<AbstractTask> task;
-  for (auto i : {SchedulePriority::High, SchedulePriority::Normal}) {
+  for (auto i : {SchedulePriority::High, SchedulePriority::Normal, SchedulePriority::Low}) {
     auto& queue = _queues[static_cast<uint32_t>(i)];
     queue.try_pop(task);
 
@@ -53,4 +131,72 @@ std::shared_ptr<AbstractTask> TaskQueue::steal() {
   return nullptr;
 }
 
+std::shared_ptr<AbstractTask> TaskQueue::steal_from_workers(std::minstd_rand& random_engine,
+                                                            const WorkStealingDeque* own_deque) {
+  const auto worker_deques = std::atomic_load(&_worker_deques);
+  if (worker_deques->empty()) return nullptr;
+
+  const auto first_victim = random_engine() % worker_deques->size();
+  for (auto offset = size_t{0}; offset < worker_deques->size(); ++offset) {
+    auto& deque = (*worker_deques)[(first_victim + offset) % worker_deques->size()];
+    if (deque.get() == own_deque) continue;
+
+    auto task = deque->steal();
+    if (task) return task;
+  }
+  return nullptr;
+}
+
+void TaskQueue::register_worker_deque(std::shared_ptr<WorkStealingDeque> deque) {
+  std::lock_guard<std::mutex> lock(_worker_deques_mutex);
+
+  auto worker_deques = std::make_shared<std::vector<std::shared_ptr<WorkStealingDeque>>>(*_worker_deques);
+  worker_deques->emplace_back(std::move(deque));
+  std::atomic_store(&_worker_deques, std::shared_ptr<const std::vector<std::shared_ptr<WorkStealingDeque>>>{
+                                         std::move(worker_deques)});
+}
+
+void TaskQueue::unregister_worker_deque(const std::shared_ptr<WorkStealingDeque>& deque) {
+  {
+    std::lock_guard<std::mutex> lock(_worker_deques_mutex);
+
+    auto worker_deques = std::make_shared<std::vector<std::shared_ptr<WorkStealingDeque>>>(*_worker_deques);
+    const auto deque_it = std::find(worker_deques->begin(), worker_deques->end(), deque);
+    DebugAssert(deque_it != worker_deques->end(), "Deque was not registered");
+    worker_deques->erase(deque_it);
+    std::atomic_store(&_worker_deques, std::shared_ptr<const std::vector<std::shared_ptr<WorkStealingDeque>>>{
+                                           std::move(worker_deques)});
+  }
+
+  // The tasks are already marked as enqueued, so push() would drop them. Thieves that still hold the old list of deques
+  // might take some of them concurrently, which is fine.
+  while (auto task = deque->steal()) {
+    defer(task, static_cast<uint32_t>(task->priority()));
+    _notify_parked_worker();
+  }
+}
+
+uint32_t TaskQueue::begin_parking() {
+  _num_parked_workers++;
+  // Pairs with the fence in _notify_parked_worker(): either the pusher sees this worker as parked, or the worker sees
+  // the pushed task when it looks for tasks once more
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  return _parking_epoch.load();
+}
+
+void TaskQueue::cancel_parking() { _num_parked_workers--; }
+
+void TaskQueue::park(uint32_t parking_epoch) {
+  futex_wait(_parking_epoch, parking_epoch, PARKING_TIMEOUT);
+  _num_parked_workers--;
+}
+
+void TaskQueue::_notify_parked_worker() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_num_parked_workers.load(std::memory_order_relaxed) == 0) return;
+
+  _parking_epoch++;
+  futex_wake_one(_parking_epoch);
+}
+
 }  // namespace opossum
@@ -4,20 +4,34 @@
 #include <tbb/concurrent_queue.h>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
 
 #include "types.hpp"
 
 namespace opossum {
 
 class AbstractTask;
+class WorkStealingDeque;
 
 /**
  * Holds a queue of AbstractTasks, usually one of these exists per node
+ *
+ * Tasks that are pushed by one of the node's Workers (with a priority other than Unstealable or Low) go to the
+ * WorkStealingDeque of that Worker. All other tasks go to the queue of their priority, from which all Workers of the
+ * node pull. Low tasks are kept out of the deques, because Workers pop from their deque before they look at the
+ * queues, so that the tasks of a long-running query would be preferred over more urgent ones.
+ *
+ * Workers that do not find any task park on the queue of their node until a task is pushed to it or the
+ * PARKING_TIMEOUT expires, after which they try to steal from the other nodes again.
  */
 class TaskQueue {
  public:
-  static constexpr uint32_t NUM_PRIORITY_LEVELS = 3;
+  static constexpr uint32_t NUM_PRIORITY_LEVELS = 4;
+  static constexpr auto PARKING_TIMEOUT = std::chrono::milliseconds(1);
 
   explicit TaskQueue(NodeID node_id);
 
@@ -32,15 +46,60 @@ class TaskQueue {
    */
   std::shared_ptr<AbstractTask> pull();
 
+  /**
+   * Returns a Task of a priority that is pulled before the given one (see SchedulePriority), if there is any
+   */
+  std::shared_ptr<AbstractTask> pull_more_urgent_than(SchedulePriority priority);
+
+  /**
+   * Puts back a pulled task that a Worker could not execute yet because its QueryGroup already occupies enough
+   * Workers. The task goes to the end of the queue of its priority and no Worker is woken up for it.
+   */
+  void defer(std::shared_ptr<AbstractTask> task, uint32_t priority);
+
   /**
    * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues
    */
   std::shared_ptr<AbstractTask> steal();
 
+  /**
+   * Tries to steal a task from the deques of the node's Workers, starting with a random one
+   */
+  std::shared_ptr<AbstractTask> steal_from_workers(std::minstd_rand& random_engine,
+                                                   const WorkStealingDeque* own_deque = nullptr);
+
+  // Called once by each Worker of the node
+  void register_worker_deque(std::shared_ptr<WorkStealingDeque> deque);
+
+  /**
+   * Called by a Worker when it shuts down, so that other Workers no longer try to steal from its deque. Tasks that are
+   * still in the deque are moved to the queues.
+   */
+  void unregister_worker_deque(const std::shared_ptr<WorkStealingDeque>& deque);
+
+  /**
+   * Parking protocol for idle Workers: begin_parking() announces that the calling Worker is about to park, after which
+   * it has to look for tasks once more. If it finds one, it calls cancel_parking(), otherwise park(). This way, a task
+   * that is pushed concurrently is either found or wakes up the Worker.
+   */
+  uint32_t begin_parking();
+  void cancel_parking();
+  void park(uint32_t parking_epoch);
+
  private:
+  void _notify_parked_worker();
+
   NodeID _node_id;
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
   std::atomic_uint _num_tasks{0};
+
+  // Replaced as a whole when a Worker registers, so that it can be read without locking (see std::atomic_load)
+  std::shared_ptr<const std::vector<std::shared_ptr<WorkStealingDeque>>> _worker_deques;
+  std::mutex _worker_deques_mutex;
+
+  // Incremented to wake up parked Workers. Parked Workers wait on it with a futex.
+  std::atomic<uint32_t> _parking_epoch{0};
+  std::atomic_uint _num_parked_workers{0};
 };
 
 }  // namespace opossum
@@ -0,0 +1,111 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Takes over the ownership of the task from its slot
+std::shared_ptr<AbstractTask> unbox(std::shared_ptr<AbstractTask>* boxed_task) {
+  auto task = std::move(*boxed_task);
+  delete boxed_task;
+  return task;
+}
+
+}  // namespace
+
+WorkStealingDeque::Buffer::Buffer(size_t capacity) : capacity(capacity), slots(std::make_unique<Slot[]>(capacity)) {
+  DebugAssert(capacity > 0u && (capacity & (capacity - 1u)) == 0u, "Capacity has to be a power of two");
+}
+
+WorkStealingDeque::WorkStealingDeque(size_t initial_capacity) {
+  _buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+  _buffer = _buffers.back().get();
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  auto& buffer = *_buffer.load();
+  for (auto index = _top.load(); index < _bottom.load(); ++index) {
+    delete buffer[index].load();
+  }
+}
+
+void WorkStealingDeque::push(std::shared_ptr<AbstractTask> task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+    buffer = _grow(*buffer, top, bottom);
+  }
+
+  (*buffer)[bottom].store(new std::shared_ptr<AbstractTask>(std::move(task)), std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  _bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  auto buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque was empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto boxed_task = (*buffer)[bottom].load(std::memory_order_relaxed);
+  if (top == bottom) {
+    // This is the last task, thieves might try to take it as well
+    const auto won_race =
+        _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    if (!won_race) return nullptr;
+  }
+
+  return unbox(boxed_task);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  // The paper uses memory_order_consume, which compilers treat as memory_order_acquire anyway
+  auto buffer = _buffer.load(std::memory_order_acquire);
+  auto boxed_task = (*buffer)[top].load(std::memory_order_relaxed);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // The owner or another thief was faster
+    return nullptr;
+  }
+
+  return unbox(boxed_task);
+}
+
+bool WorkStealingDeque::empty() const {
+  return _top.load(std::memory_order_relaxed) >= _bottom.load(std::memory_order_relaxed);
+}
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(Buffer& buffer, int64_t top, int64_t bottom) {
+  _buffers.emplace_back(std::make_unique<Buffer>(buffer.capacity * 2u));
+  auto& new_buffer = *_buffers.back();
+
+  for (auto index = top; index < bottom; ++index) {
+    new_buffer[index].store(buffer[index].load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+
+  _buffer.store(&new_buffer, std::memory_order_release);
+  return &new_buffer;
+}
+
+}  // namespace opossum
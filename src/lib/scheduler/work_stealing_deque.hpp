@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * A lock-free double-ended queue of tasks as described by Chase and Lev [1], with the memory orderings of Lê et al. [2]
+ *
+ * Each Worker owns one deque. Only the owner pushes and pops tasks at the bottom (LIFO), so that it continues with the
+ * tasks it has just created while their data is still in its caches. Other Workers steal from the top (FIFO), i.e.,
+ * they take the oldest tasks. Neither side ever takes a lock.
+ *
+ * The ring buffer grows when it is full. Thieves might still read from the old buffer, so it is only freed when the
+ * deque is destroyed.
+ *
+ * [1] Chase, Lev: Dynamic Circular Work-Stealing Deque, SPAA 2005
+ * [2] Lê, Pop, Cohen, Zappa Nardelli: Correct and Efficient Work-Stealing for Weak Memory Models, PPoPP 2013
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(size_t initial_capacity = 64u);
+  ~WorkStealingDeque();
+
+  /**
+   * To be called by the owning Worker only
+   */
+  void push(std::shared_ptr<AbstractTask> task);
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * May be called by any thread. Returns nullptr if the deque is empty or if another thread took the task first.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  // Only a snapshot, the deque might be modified concurrently
+  bool empty() const;
+
+ private:
+  // The slots hold heap-allocated shared_ptrs, so that they can be read and written atomically. Whoever takes a task
+  // out of the deque takes over the ownership of its shared_ptr.
+  using Slot = std::atomic<std::shared_ptr<AbstractTask>*>;
+
+  struct Buffer {
+    explicit Buffer(size_t capacity);
+
+    Slot& operator[](int64_t index) { return slots[static_cast<size_t>(index) & (capacity - 1u)]; }
+
+    const size_t capacity;  // always a power of two
+    std::unique_ptr<Slot[]> slots;
+  };
+
+  Buffer* _grow(Buffer& buffer, int64_t top, int64_t bottom);
+
+  // top and bottom are written by different threads, keep them on separate cache lines
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer;
+
+  // All buffers that were ever allocated, only accessed by the owner
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
@@ -4,16 +4,17 @@
 #include <sched.h>
 #include <unistd.h>
 
-#include <chrono>
 #include <iostream>
 #include <memory>
-#include <thread>
+#include <utility>
 #include <vector>
 
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
 #include "task_queue.hpp"
+#include "topology.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace {
 
@@ -30,12 +31,21 @@ std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_
 
 Worker::Worker(std::weak_ptr<ProcessingUnit> processing_unit, std::shared_ptr<TaskQueue> queue, WorkerID id,
                CpuID cpu_id)
-    : _processing_unit(processing_unit), _queue(queue), _id(id), _cpu_id(cpu_id) {}
+    : _processing_unit(processing_unit),
+      _queue(queue),
+      _deque(std::make_shared<WorkStealingDeque>()),
+      _random_engine(id + 1u),
+      _id(id),
+      _cpu_id(cpu_id) {
+  _queue->register_worker_deque(_deque);
+}
 
 WorkerID Worker::id() const { return _id; }
 
 std::shared_ptr<TaskQueue> Worker::queue() const { return _queue; }
 
+WorkStealingDeque& Worker::deque() const { return *_deque; }
+
 CpuID Worker::cpu_id() const { return _cpu_id; }
 
 std::weak_ptr<ProcessingUnit> Worker::processing_unit() const { return _processing_unit; }
@@ -65,34 +75,23 @@ void Worker::operator()() {
       }
     }
 
-    auto task = _queue->pull();
+    auto task = _find_admitted_task(*scheduler);
 
     // TODO(all): this might shutdown the worker and leave non-ready tasks in the queue.
     // Figure out how we want to deal with that later.
     if (!task) {
-      // Simple work stealing without explicitly transferring data between nodes.
-      auto work_stealing_successful = false;
-      for (auto& queue : scheduler->queues()) {
-        if (queue == _queue) {
-          continue;
-        }
-
-        task = queue->steal();
-        if (task) {
-          task->set_node_id(_queue->node_id());
-          work_stealing_successful = true;
-          break;
-        }
-      }
+      // Look once more after announcing that we are about to park, so that no concurrently pushed task is missed
+      const auto parking_epoch = _queue->begin_parking();
+      task = _find_admitted_task(*scheduler);
 
-      // Sleep iff there is no ready task in our queue and work stealing was not successful.
-      if (!work_stealing_successful) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      if (!task) {
+        _queue->park(parking_epoch);
         continue;
       }
+      _queue->cancel_parking();
     }
 
-    task->execute();
+    _execute_admitted_task(task);
 
     // This is part of the Scheduler shutdown system. Count the number of tasks a ProcessingUnit executed to allow the
     // Scheduler to determine whether all tasks finished
@@ -100,6 +99,110 @@ void Worker::operator()() {
   }
 
   processing_unit->yield_active_worker_token(_id);
+
+  // A Worker that is shut down is not restarted, a new one with its own deque takes its place
+  _queue->unregister_worker_deque(_deque);
+}
+
+void Worker::yield_to_more_urgent_tasks() {
+  // Only tasks of a QueryGroup can be preempted
+  const auto query_group = QueryGroup::current();
+  if (!query_group) return;
+
+  const auto worker_count = CurrentScheduler::get()->topology()->num_cpus();
+  auto processing_unit = _processing_unit.lock();
+  DebugAssert(static_cast<bool>(processing_unit), "No processing unit");
+
+  while (auto task = _queue->pull_more_urgent_than(query_group->priority())) {
+    const auto& task_query_group = task->query_group();
+    if (task_query_group && !task_query_group->try_acquire_worker(worker_count, true)) {
+      _queue->defer(task, static_cast<uint32_t>(task->priority()));
+      return;
+    }
+
+    _execute_admitted_task(task);
+    processing_unit->on_worker_finished_task();
+  }
+}
+
+std::shared_ptr<AbstractTask> Worker::_find_admitted_task(const AbstractScheduler& scheduler) {
+  const auto worker_count = scheduler.topology()->num_cpus();
+
+  // The first task whose group exceeds its fair share is only executed if no other task is found
+  auto over_share_task = std::shared_ptr<AbstractTask>{};
+  auto admitted_task = std::shared_ptr<AbstractTask>{};
+
+  for (auto attempt = size_t{0}; attempt < MAX_ADMISSION_ATTEMPTS; ++attempt) {
+    auto task = _find_task(scheduler);
+    if (!task) break;
+
+    const auto& query_group = task->query_group();
+    if (!query_group || query_group->try_acquire_worker(worker_count, true)) {
+      admitted_task = std::move(task);
+      break;
+    }
+
+    if (!over_share_task) {
+      over_share_task = std::move(task);
+    } else {
+      _queue->defer(task, static_cast<uint32_t>(task->priority()));
+    }
+  }
+
+  if (over_share_task) {
+    const auto& query_group = over_share_task->query_group();
+    if (!admitted_task && query_group->try_acquire_worker(worker_count, false)) {
+      admitted_task = std::move(over_share_task);
+    } else {
+      _queue->defer(over_share_task, static_cast<uint32_t>(over_share_task->priority()));
+    }
+  }
+
+  return admitted_task;
+}
+
+void Worker::_execute_admitted_task(const std::shared_ptr<AbstractTask>& task) {
+  // Tasks can be executed while another one waits (see yield_to_more_urgent_tasks())
+  const auto previous_query_group = std::exchange(_admitted_query_group, task->query_group());
+
+  task->execute();
+
+  if (_admitted_query_group) _release_query_group();
+  _admitted_query_group = previous_query_group;
+}
+
+void Worker::_release_query_group() {
+  _admitted_query_group->release_worker();
+  _admitted_query_group = nullptr;
+}
+
+std::shared_ptr<AbstractTask> Worker::_find_task(const AbstractScheduler& scheduler) {
+  auto task = _deque->pop();
+  if (task) return task;
+
+  task = _queue->pull();
+  if (task) return task;
+
+  task = _queue->steal_from_workers(_random_engine, _deque.get());
+  if (task) return task;
+
+  // Work stealing from other nodes without explicitly transferring data between nodes
+  const auto& queues = scheduler.queues();
+  const auto first_queue = _random_engine() % queues.size();
+  for (auto offset = size_t{0}; offset < queues.size(); ++offset) {
+    const auto& queue = queues[(first_queue + offset) % queues.size()];
+    if (queue == _queue) continue;
+
+    task = queue->steal();
+    if (!task) task = queue->steal_from_workers(_random_engine);
+
+    if (task) {
+      task->set_node_id(_queue->node_id());
+      return task;
+    }
+  }
+
+  return nullptr;
 }
 
 void Worker::_set_affinity() {
@@ -1,19 +1,35 @@
 #pragma once
 
 #include <memory>
+#include <random>
 #include <vector>
 
 #include "processing_unit.hpp"
+#include "query_group.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+class AbstractScheduler;
+class AbstractTask;
 class TaskQueue;
+class WorkStealingDeque;
 
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
  * Ideally there should be one Worker actively doing work per CPU, but multiple might be active occasionally
+ *
+ * A Worker looks for tasks in this order:
+ *  1) its own WorkStealingDeque (LIFO)
+ *  2) the TaskQueue of its node
+ *  3) the deques of the other Workers of its node, starting with a random victim
+ *  4) the TaskQueues and Worker deques of the other nodes, starting with a random node
+ * If it does not find any, it parks on the TaskQueue of its node.
+ *
+ * Tasks of a QueryGroup that already occupies its fair share of the Workers are deferred, i.e., put back to the
+ * TaskQueue, as long as the Worker finds tasks of other groups. Tasks of a group that occupies its max_worker_count
+ * are always deferred.
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class AbstractTask;
@@ -21,6 +37,9 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   friend class NodeQueueScheduler;
 
  public:
+  // Number of tasks a Worker looks at before it executes a task of a group that exceeds its fair share
+  static constexpr size_t MAX_ADMISSION_ATTEMPTS = 4u;
+
   static std::shared_ptr<Worker> get_this_thread_worker();
 
   Worker(std::weak_ptr<ProcessingUnit> processing_unit, std::shared_ptr<TaskQueue> queue, WorkerID id, CpuID cpu_id);
@@ -30,11 +49,18 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   WorkerID id() const;
   std::shared_ptr<TaskQueue> queue() const;
+  WorkStealingDeque& deque() const;
   std::weak_ptr<ProcessingUnit> processing_unit() const;
   CpuID cpu_id() const;
 
   void operator()();
 
+  /**
+   * Preemption point for long-running tasks: executes tasks of the Worker's node with a higher priority than the
+   * QueryGroup of the task that is currently executed, if there are any.
+   */
+  void yield_to_more_urgent_tasks();
+
   void operator=(const Worker&) = delete;
   void operator=(Worker&&) = delete;
 
@@ -51,9 +77,18 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
     processing_unit->yield_active_worker_token(_id);
     processing_unit->wake_or_create_worker();
 
+    // The tasks might belong to the same QueryGroup, so free its Worker while waiting
+    const auto query_group = _admitted_query_group;
+    if (query_group) _release_query_group();
+
     for (auto& task : tasks) {
       task->_join_without_replacement_worker();
     }
+
+    if (query_group) {
+      query_group->acquire_worker();
+      _admitted_query_group = query_group;
+    }
   }
 
  private:
@@ -63,10 +98,28 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  std::shared_ptr<AbstractTask> _find_task(const AbstractScheduler& scheduler);
+
+  /**
+   * Finds a task whose QueryGroup admits another Worker and acquires the Worker for that group. Returns nullptr if
+   * there is no such task.
+   */
+  std::shared_ptr<AbstractTask> _find_admitted_task(const AbstractScheduler& scheduler);
+
+  // Executes an admitted task and releases the Worker of its QueryGroup afterwards
+  void _execute_admitted_task(const std::shared_ptr<AbstractTask>& task);
+
+  void _release_query_group();
+
   std::weak_ptr<ProcessingUnit> _processing_unit;
   std::shared_ptr<TaskQueue> _queue;
+  std::shared_ptr<WorkStealingDeque> _deque;
+  std::minstd_rand _random_engine;
   WorkerID _id;
   CpuID _cpu_id;
+
+  // The QueryGroup of the currently executed task, if the Worker was acquired for it
+  std::shared_ptr<QueryGroup> _admitted_query_group;
 };
 
 }  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "base_column.hpp"
+
+namespace opossum {
+
+class BitPackedAttributeVector;
+
+// Frame-of-reference encoding is only supported for integer columns
+template <typename T>
+constexpr bool supports_frame_of_reference_encoding_v = std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>;
+
+/**
+ * @brief Super class of frame-of-reference encoded columns
+ *
+ * Exposes all methods of frame-of-reference encoded columns that do not rely on its specific data type.
+ * The column is split into frames of frame_size rows. Each value is stored as its offset to the minimum of its frame.
+ */
+class BaseFrameOfReferenceColumn : public BaseColumn {
+ public:
+  // multiple of BitPackedAttributeVector::block_size so that frames are decoded in whole blocks
+  static constexpr auto frame_size = 2048u;
+
+  // returns the offset of each value to the minimum of its frame, NULL_VALUE_ID if the value is null
+  virtual std::shared_ptr<const BitPackedAttributeVector> offsets() const = 0;
+
+  // returns the number of frames
+  size_t frame_count() const { return (size() + frame_size - 1u) / frame_size; }
+};
+}  // namespace opossum
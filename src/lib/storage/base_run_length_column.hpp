@@ -0,0 +1,33 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+
+#include "base_column.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Super class of run-length encoded columns
+ *
+ * Exposes all methods of run-length encoded columns that do not rely on its specific data type.
+ * A run i covers the chunk offsets (end_positions[i - 1], end_positions[i]], i.e., end positions are inclusive.
+ */
+class BaseRunLengthColumn : public BaseColumn {
+ public:
+  // returns for each run whether its value is null
+  virtual const std::shared_ptr<const pmr_vector<bool>>& null_values() const = 0;
+
+  // returns the last chunk offset of each run
+  virtual const std::shared_ptr<const pmr_vector<ChunkOffset>>& end_positions() const = 0;
+
+  // returns the number of runs
+  size_t run_count() const { return end_positions()->size(); }
+
+  // returns the index of the run that contains the chunk offset, given the end positions of the column
+  static size_t run_index(const pmr_vector<ChunkOffset>& end_positions, const ChunkOffset chunk_offset) {
+    const auto it = std::lower_bound(end_positions.cbegin(), end_positions.cend(), chunk_offset);
+    return static_cast<size_t>(std::distance(end_positions.cbegin(), it));
+  }
+};
+}  // namespace opossum
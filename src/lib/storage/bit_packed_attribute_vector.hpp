@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <utility>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * BitPackedAttributeVector stores ValueIDs using the minimum number of bits (1 to 32)
+ * instead of rounding up to the next byte-aligned width like FittedAttributeVector does.
+ *
+ * The layout follows SIMD-BP128: values are grouped into blocks of 128. Within a block,
+ * value i is stored in lane (i % 4), i.e., the four lanes are interleaved word by word.
+ * This way, a whole block can be decoded with the same shift and mask for four consecutive
+ * words, which the compiler turns into SIMD instructions. Use decode_block() when scanning
+ * sequentially and get() only for random access.
+ *
+ * Note: NULL_VALUE_ID is represented by the largest value that fits into bit_width bits.
+ */
+class BitPackedAttributeVector : public BaseAttributeVector {
+ public:
+  static constexpr auto block_size = 128u;
+  static constexpr auto lane_count = 4u;
+  static constexpr auto values_per_lane = block_size / lane_count;
+
+  using Block = std::array<ValueID::base_type, block_size>;
+
+ public:
+  explicit BitPackedAttributeVector(size_t size, uint8_t bit_width, const PolymorphicAllocator<uint32_t>& alloc = {})
+      : BitPackedAttributeVector(pmr_vector<uint32_t>(_word_count(size, bit_width), 0u, alloc), size, bit_width) {}
+
+  // Creates a BitPackedAttributeVector from already packed data
+  explicit BitPackedAttributeVector(pmr_vector<uint32_t>&& data, size_t size, uint8_t bit_width)
+      : _data(std::move(data)),
+        _size(size),
+        _bit_width(bit_width),
+        _mask(bit_width == 32u ? ~uint32_t{0u} : (uint32_t{1u} << bit_width) - 1u) {
+    DebugAssert(bit_width >= 1u && bit_width <= 32u, "Bit width must be between 1 and 32.");
+    DebugAssert(_data.size() == _word_count(size, bit_width), "Packed data does not match size and bit width.");
+  }
+
+  /**
+   * Returns the ValueID for a given record
+   * Note: max(bit_width) is converted to NULL_VALUE_ID
+   */
+  ValueID get(const ChunkOffset chunk_offset) const final {
+    const auto offset_in_block = chunk_offset % block_size;
+    const auto* block = _data.data() + (chunk_offset / block_size) * lane_count * _bit_width;
+    const auto value = _unpack(block, offset_in_block % lane_count, offset_in_block / lane_count);
+    return (value == _mask) ? NULL_VALUE_ID : ValueID{value};
+  }
+
+  /**
+   * Sets the value_id at a given position
+   * Note: NULL_VALUE_ID is converted to max(bit_width)
+   */
+  void set(const ChunkOffset chunk_offset, const ValueID value_id) final {
+    DebugAssert(value_id < _mask || value_id == NULL_VALUE_ID, "value_id too large to fit into bit_width");
+
+    const auto offset_in_block = chunk_offset % block_size;
+    auto* block = _data.data() + (chunk_offset / block_size) * lane_count * _bit_width;
+    const auto lane = offset_in_block % lane_count;
+    const auto bit_offset = (offset_in_block / lane_count) * _bit_width;
+    const auto word = bit_offset / 32u;
+    const auto shift = bit_offset % 32u;
+    const auto value = static_cast<uint32_t>(value_id) & _mask;
+
+    auto& low = block[word * lane_count + lane];
+    low = (low & ~(_mask << shift)) | (value << shift);
+
+    if (shift + _bit_width > 32u) {
+      auto& high = block[(word + 1u) * lane_count + lane];
+      high = (high & ~(_mask >> (32u - shift))) | (value >> (32u - shift));
+    }
+  }
+
+  /**
+   * Decodes all 128 values of the given block into out. Values beyond size() are undefined.
+   * Note: max(bit_width) is converted to NULL_VALUE_ID
+   */
+  void decode_block(size_t block_index, Block& out) const {
+    const auto* block = _data.data() + block_index * lane_count * _bit_width;
+
+    for (auto index_in_lane = 0u; index_in_lane < values_per_lane; ++index_in_lane) {
+      for (auto lane = 0u; lane < lane_count; ++lane) {
+        const auto value = _unpack(block, lane, index_in_lane);
+        out[index_in_lane * lane_count + lane] = (value == _mask) ? NULL_VALUE_ID : value;
+      }
+    }
+  }
+
+  // returns the packed words
+  const pmr_vector<uint32_t>& data() const { return _data; }
+
+  // returns the number of values
+  size_t size() const final { return _size; }
+
+  // returns the width of the decoded values in bytes
+  AttributeVectorWidth width() const final { return static_cast<AttributeVectorWidth>((_bit_width + 7u) / 8u); }
+
+  // returns the number of bits used per value
+  uint8_t bit_width() const { return _bit_width; }
+
+  std::shared_ptr<BaseAttributeVector> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final {
+    pmr_vector<uint32_t> new_data(_data, alloc);
+    return std::allocate_shared<BitPackedAttributeVector>(alloc, std::move(new_data), _size, _bit_width);
+  }
+
+ private:
+  static size_t _word_count(size_t size, uint8_t bit_width) {
+    return ((size + block_size - 1u) / block_size) * lane_count * bit_width;
+  }
+
+  uint32_t _unpack(const uint32_t* block, uint32_t lane, uint32_t index_in_lane) const {
+    const auto bit_offset = index_in_lane * _bit_width;
+    const auto word = bit_offset / 32u;
+    const auto shift = bit_offset % 32u;
+
+    auto value = block[word * lane_count + lane] >> shift;
+    if (shift + _bit_width > 32u) {
+      value |= block[(word + 1u) * lane_count + lane] << (32u - shift);
+    }
+    return value & _mask;
+  }
+
+ private:
+  pmr_vector<uint32_t> _data;
+  size_t _size;
+  uint8_t _bit_width;
+  uint32_t _mask;
+};
+
+}  // namespace opossum
@@ -92,6 +92,13 @@ void Chunk::use_mvcc_columns_from(const Chunk& chunk) {
   _mvcc_columns = chunk._mvcc_columns;
 }
 
+std::shared_ptr<const Chunk::ZoneMaps> Chunk::zone_maps() const { return std::atomic_load(&_zone_maps); }
+
+void Chunk::set_zone_maps(std::shared_ptr<const ZoneMaps> zone_maps) {
+  DebugAssert(!zone_maps || zone_maps->columns.size() == column_count(), "Need exactly one zone map per column.");
+  std::atomic_store(&_zone_maps, std::move(zone_maps));
+}
+
 bool Chunk::has_mvcc_columns() const { return _mvcc_columns != nullptr; }
 bool Chunk::has_access_counter() const { return _access_counter != nullptr; }
 
@@ -23,6 +23,7 @@ namespace opossum {
 
 class BaseIndex;
 class BaseColumn;
+class BaseZoneMap;
 
 enum class ChunkUseMvcc { Yes, No };
 enum class ChunkUseAccessCounter { Yes, No };
@@ -51,6 +52,12 @@ class Chunk : private Noncopyable {
     pmr_concurrent_vector<CommitID> begin_cids;                  ///< commit id when record was added
     pmr_concurrent_vector<CommitID> end_cids;                    ///< commit id when record was deleted
 
+    /**
+     * Set before the first row is locked for deletion and never reset, not even if the deletion is rolled back.
+     * Together with ZoneMaps::visible_from_cid, this allows Validate to skip the visibility checks of whole chunks.
+     */
+    std::atomic<bool> has_deletions{false};
+
    private:
     /**
      * @brief Mutex used to manage access to MVCC columns
@@ -62,6 +69,21 @@ class Chunk : private Noncopyable {
     std::shared_mutex _mutex;
   };
 
+  /**
+   * Statistics that allow operators to skip the chunk without looking at its data
+   *
+   * Zone maps are built by DictionaryCompression::compress_chunk. Since compressed chunks are immutable
+   * (apart from their end_cids), they never become outdated.
+   */
+  struct ZoneMaps {
+    std::vector<std::shared_ptr<const BaseZoneMap>> columns;  ///< one zone map per column
+    CommitID min_begin_cid{0};  ///< lower bound of the begin_cids of all rows, 0 if unknown
+
+    // All rows are visible to snapshots at or after this commit id, as long as MvccColumns::has_deletions is not set.
+    // MAX_COMMIT_ID if not all rows were committed and undeleted when the chunk was compressed.
+    CommitID visible_from_cid{MAX_COMMIT_ID};
+  };
+
   /**
    * Data structure for storing chunk access times
    *
@@ -176,6 +198,10 @@ class Chunk : private Noncopyable {
    */
   void use_mvcc_columns_from(const Chunk& chunk);
 
+  // Atomically accesses the zone maps, nullptr if the chunk has not been compressed yet
+  std::shared_ptr<const ZoneMaps> zone_maps() const;
+  void set_zone_maps(std::shared_ptr<const ZoneMaps> zone_maps);
+
   std::vector<std::shared_ptr<BaseIndex>> get_indices(
       const std::vector<std::shared_ptr<const BaseColumn>>& columns) const;
   std::vector<std::shared_ptr<BaseIndex>> get_indices(const std::vector<ColumnID> column_ids) const;
@@ -225,6 +251,7 @@ class Chunk : private Noncopyable {
   std::shared_ptr<MvccColumns> _mvcc_columns;
   std::shared_ptr<AccessCounter> _access_counter;
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
+  std::shared_ptr<const ZoneMaps> _zone_maps;
 };
 
 }  // namespace opossum
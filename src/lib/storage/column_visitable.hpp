@@ -3,6 +3,8 @@
 #include <memory>
 
 #include "storage/base_dictionary_column.hpp"
+#include "storage/base_frame_of_reference_column.hpp"
+#include "storage/base_run_length_column.hpp"
 #include "storage/base_value_column.hpp"
 
 namespace opossum {
@@ -22,6 +24,10 @@ class ColumnVisitable {
                                         std::shared_ptr<ColumnVisitableContext> context) = 0;
   virtual void handle_reference_column(const ReferenceColumn& column,
                                        std::shared_ptr<ColumnVisitableContext> context) = 0;
+  virtual void handle_run_length_column(const BaseRunLengthColumn& column,
+                                        std::shared_ptr<ColumnVisitableContext> context) = 0;
+  virtual void handle_frame_of_reference_column(const BaseFrameOfReferenceColumn& column,
+                                                std::shared_ptr<ColumnVisitableContext> context) = 0;
 };
 
 }  // namespace opossum
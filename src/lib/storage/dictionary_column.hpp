@@ -3,11 +3,13 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
 #include "base_dictionary_column.hpp"
+#include "string_dictionary.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -15,17 +17,22 @@ namespace opossum {
 class BaseAttributeVector;
 class BaseColumn;
 
+// Strings are stored in a StringDictionary to avoid one allocation per distinct value
+template <typename T>
+using dictionary_t = std::conditional_t<std::is_same_v<T, std::string>, StringDictionary, pmr_vector<T>>;
+
 // Dictionary is a specific column type that stores all its values in a vector
 template <typename T>
 class DictionaryColumn : public BaseDictionaryColumn {
  public:
   /**
    * Creates a Dictionary column from a given dictionary and attribute vector.
+   * The dictionary must be sorted and unique. Strings are copied into a StringDictionary.
    * See dictionary_compression.cpp for more.
    */
   explicit DictionaryColumn(pmr_vector<T>&& dictionary, const std::shared_ptr<BaseAttributeVector>& attribute_vector);
 
-  explicit DictionaryColumn(const std::shared_ptr<pmr_vector<T>>& dictionary,
+  explicit DictionaryColumn(const std::shared_ptr<dictionary_t<T>>& dictionary,
                             const std::shared_ptr<BaseAttributeVector>& attribute_vector);
 
   // return the value at a certain position. If you want to write efficient operators, back off!
@@ -42,7 +49,7 @@ class DictionaryColumn : public BaseDictionaryColumn {
   void append(const AllTypeVariant&) override;
 
   // returns an underlying dictionary
-  std::shared_ptr<const pmr_vector<T>> dictionary() const;
+  std::shared_ptr<const dictionary_t<T>> dictionary() const;
 
   // returns an underlying data structure
   std::shared_ptr<const BaseAttributeVector> attribute_vector() const final;
@@ -51,7 +58,7 @@ class DictionaryColumn : public BaseDictionaryColumn {
   const pmr_concurrent_vector<std::optional<T>> materialize_values() const;
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const;
+  const T value_by_value_id(ValueID value_id) const;
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
@@ -87,7 +94,7 @@ class DictionaryColumn : public BaseDictionaryColumn {
   std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const override;
 
  protected:
-  std::shared_ptr<pmr_vector<T>> _dictionary;
+  std::shared_ptr<dictionary_t<T>> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
 };
 
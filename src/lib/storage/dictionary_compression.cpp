@@ -4,40 +4,63 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "bit_packed_attribute_vector.hpp"
 #include "chunk.hpp"
 #include "dictionary_column.hpp"
 #include "fitted_attribute_vector.hpp"
+#include "frame_of_reference_column.hpp"
 #include "resolve_type.hpp"
 #include "table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_column.hpp"
+#include "zone_map.hpp"
 
 namespace opossum {
 
 class ColumnCompressorBase {
  public:
-  virtual std::shared_ptr<BaseColumn> compress_column(const std::shared_ptr<BaseColumn>& column) = 0;
+  virtual std::shared_ptr<BaseColumn> compress_column(const std::shared_ptr<BaseColumn>& column,
+                                                      EncodingSelection encoding_selection) = 0;
 
  protected:
+  /**
+   * Byte-aligned widths are stored in a FittedAttributeVector because it offers faster random access.
+   * All other widths are bit-packed so that, e.g., 300 distinct values only use 9 instead of 16 bits per row.
+   */
   static std::shared_ptr<BaseAttributeVector> _create_fitted_attribute_vector(size_t unique_values_count, size_t size) {
-    if (unique_values_count <= std::numeric_limits<uint8_t>::max()) {
+    const auto bit_width = _bit_width(unique_values_count - 1u);
+
+    if (bit_width == 8u) {
       return std::make_shared<FittedAttributeVector<uint8_t>>(size);
-    } else if (unique_values_count <= std::numeric_limits<uint16_t>::max()) {
+    } else if (bit_width == 16u) {
       return std::make_shared<FittedAttributeVector<uint16_t>>(size);
-    } else {
+    } else if (bit_width == 32u) {
       return std::make_shared<FittedAttributeVector<uint32_t>>(size);
+    } else {
+      return std::make_shared<BitPackedAttributeVector>(size, bit_width);
     }
   }
+
+  // Returns the number of bits needed to represent max_value (at least one)
+  static uint8_t _bit_width(size_t max_value) {
+    auto bit_width = uint8_t{1u};
+    while (bit_width < 32u && (max_value >> bit_width) != 0u) {
+      ++bit_width;
+    }
+    return bit_width;
+  }
 };
 
 template <typename T>
 class ColumnCompressor : public ColumnCompressorBase {
  public:
-  std::shared_ptr<BaseColumn> compress_column(const std::shared_ptr<BaseColumn>& column) override {
+  std::shared_ptr<BaseColumn> compress_column(const std::shared_ptr<BaseColumn>& column,
+                                              EncodingSelection encoding_selection) override {
     auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column);
 
     Assert(value_column != nullptr, "Column is either already compressed or type mismatches.");
@@ -64,10 +87,19 @@ class ColumnCompressor : public ColumnCompressorBase {
       dictionary.erase(erase_from_here_it, dictionary.end());
     }
 
+    const auto non_null_count = dictionary.size();
+
     std::sort(dictionary.begin(), dictionary.end());
     dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
     dictionary.shrink_to_fit();
 
+    if constexpr (supports_frame_of_reference_encoding_v<T>) {
+      if (encoding_selection == EncodingSelection::Automatic) {
+        auto frame_of_reference_column = _encode_frame_of_reference(*value_column, non_null_count, dictionary.size());
+        if (frame_of_reference_column) return frame_of_reference_column;
+      }
+    }
+
     // We need to increment the dictionary size here because of possible null values.
     auto attribute_vector = _create_fitted_attribute_vector(dictionary.size() + 1u, values.size());
 
@@ -106,42 +138,163 @@ class ColumnCompressor : public ColumnCompressorBase {
     return static_cast<ValueID>(
         std::distance(dictionary.cbegin(), std::lower_bound(dictionary.cbegin(), dictionary.cend(), value)));
   }
+
+ private:
+  /**
+   * Returns a FrameOfReferenceColumn if the column has (almost) one dictionary entry per row and the
+   * frame-of-reference encoding is smaller than the dictionary encoding. Returns nullptr otherwise.
+   */
+  std::shared_ptr<BaseColumn> _encode_frame_of_reference(const ValueColumn<T>& value_column,
+                                                         const size_t non_null_count, const size_t distinct_count) {
+    constexpr auto frame_size = FrameOfReferenceColumn<T>::frame_size;
+    const auto& values = value_column.values();
+
+    // Short columns and columns with repeated values are left to the dictionary, which also supports indices
+    if (values.size() < frame_size || distinct_count * 10u < non_null_count * 9u) return nullptr;
+
+    const auto frame_count = (values.size() + frame_size - 1u) / frame_size;
+    auto minima = pmr_vector<T>(frame_count, std::numeric_limits<T>::max());
+    auto maxima = pmr_vector<T>(frame_count, std::numeric_limits<T>::min());
+
+    _for_each_non_null_value(value_column, [&](const size_t index, const T value) {
+      auto& minimum = minima[index / frame_size];
+      auto& maximum = maxima[index / frame_size];
+      minimum = std::min(minimum, value);
+      maximum = std::max(maximum, value);
+    });
+
+    auto max_offset = uint64_t{0u};
+    for (auto frame_id = size_t{0u}; frame_id < frame_count; ++frame_id) {
+      // Frames that only contain nulls
+      if (minima[frame_id] > maxima[frame_id]) {
+        minima[frame_id] = T{};
+        maxima[frame_id] = T{};
+        continue;
+      }
+
+      const auto range = static_cast<uint64_t>(static_cast<std::make_unsigned_t<T>>(maxima[frame_id]) -
+                                                static_cast<std::make_unsigned_t<T>>(minima[frame_id]));
+
+      // NULL_VALUE_ID is reserved for null values
+      if (range >= std::numeric_limits<uint32_t>::max()) return nullptr;
+
+      max_offset = std::max(max_offset, range);
+    }
+
+    // The largest representable offset marks null values
+    const auto bit_width = _bit_width(max_offset + 1u);
+
+    const auto dictionary_bits = distinct_count * sizeof(T) * 8u + values.size() * _bit_width(distinct_count);
+    const auto frame_of_reference_bits = frame_count * 2u * sizeof(T) * 8u + values.size() * bit_width;
+    if (frame_of_reference_bits >= dictionary_bits) return nullptr;
+
+    auto offsets = std::make_shared<BitPackedAttributeVector>(values.size(), bit_width);
+
+    if (value_column.is_nullable()) {
+      const auto& null_values = value_column.null_values();
+      auto index = 0u;
+      for (auto null_value_it = null_values.cbegin(); null_value_it != null_values.cend(); ++null_value_it, ++index) {
+        if (*null_value_it) offsets->set(index, NULL_VALUE_ID);
+      }
+    }
+
+    _for_each_non_null_value(value_column, [&](const size_t index, const T value) {
+      offsets->set(index, ValueID{FrameOfReferenceColumn<T>::encode(minima[index / frame_size], value)});
+    });
+
+    return std::make_shared<FrameOfReferenceColumn<T>>(std::make_shared<pmr_vector<T>>(std::move(minima)),
+                                                       std::make_shared<pmr_vector<T>>(std::move(maxima)), offsets);
+  }
+
+  template <typename Functor>
+  static void _for_each_non_null_value(const ValueColumn<T>& value_column, const Functor& functor) {
+    const auto& values = value_column.values();
+
+    if (value_column.is_nullable()) {
+      const auto& null_values = value_column.null_values();
+
+      auto value_it = values.cbegin();
+      auto null_value_it = null_values.cbegin();
+      auto index = size_t{0u};
+      for (; value_it != values.cend(); ++value_it, ++null_value_it, ++index) {
+        if (*null_value_it) continue;
+        functor(index, *value_it);
+      }
+    } else {
+      auto index = size_t{0u};
+      for (auto value_it = values.cbegin(); value_it != values.cend(); ++value_it, ++index) {
+        functor(index, *value_it);
+      }
+    }
+  }
 };
 
 std::shared_ptr<BaseColumn> DictionaryCompression::compress_column(DataType data_type,
                                                                    const std::shared_ptr<BaseColumn>& column) {
   auto compressor = make_shared_by_data_type<ColumnCompressorBase, ColumnCompressor>(data_type);
-  return compressor->compress_column(column);
+  return compressor->compress_column(column, EncodingSelection::DictionaryOnly);
+}
+
+std::shared_ptr<BaseColumn> DictionaryCompression::compress_column_adaptively(
+    DataType data_type, const std::shared_ptr<BaseColumn>& column) {
+  auto compressor = make_shared_by_data_type<ColumnCompressorBase, ColumnCompressor>(data_type);
+  return compressor->compress_column(column, EncodingSelection::Automatic);
 }
 
-void DictionaryCompression::compress_chunk(const std::vector<DataType>& column_types, Chunk& chunk) {
+void DictionaryCompression::compress_chunk(const std::vector<DataType>& column_types, Chunk& chunk,
+                                           EncodingSelection encoding_selection) {
   DebugAssert((column_types.size() == chunk.column_count()),
               "Number of column types does not match the chunk’s column count.");
 
+  auto zone_maps = std::make_shared<Chunk::ZoneMaps>();
+
   for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
     auto value_column = chunk.get_mutable_column(column_id);
-    auto dict_column = compress_column(column_types[column_id], value_column);
-    chunk.replace_column(column_id, dict_column);
+    auto compressed_column = encoding_selection == EncodingSelection::Automatic
+                                 ? compress_column_adaptively(column_types[column_id], value_column)
+                                 : compress_column(column_types[column_id], value_column);
+    chunk.replace_column(column_id, compressed_column);
+    zone_maps->columns.push_back(create_zone_map(column_types[column_id], *compressed_column));
   }
 
   if (chunk.has_mvcc_columns()) {
     chunk.shrink_mvcc_columns();
+
+    // Rows that are not yet committed have MAX_COMMIT_ID as begin_cid. They might still be committed with a lower
+    // commit id than the committed rows, so no bound can be given in this case.
+    const auto mvcc_columns = chunk.mvcc_columns();
+    const auto& begin_cids = mvcc_columns->begin_cids;
+    const auto min_max_begin_cid = std::minmax_element(begin_cids.cbegin(), begin_cids.cend());
+    if (!begin_cids.empty() && *min_max_begin_cid.second != Chunk::MAX_COMMIT_ID) {
+      zone_maps->min_begin_cid = *min_max_begin_cid.first;
+
+      // Rows that are deleted (or whose insert was rolled back) have an end_cid other than MAX_COMMIT_ID
+      const auto& end_cids = mvcc_columns->end_cids;
+      const auto all_rows_valid = std::all_of(end_cids.cbegin(), end_cids.cend(),
+                                              [](const auto end_cid) { return end_cid == Chunk::MAX_COMMIT_ID; });
+      if (all_rows_valid && !mvcc_columns->has_deletions) {
+        zone_maps->visible_from_cid = *min_max_begin_cid.second;
+      }
+    }
   }
+
+  chunk.set_zone_maps(zone_maps);
 }
 
-void DictionaryCompression::compress_chunks(Table& table, const std::vector<ChunkID>& chunk_ids) {
+void DictionaryCompression::compress_chunks(Table& table, const std::vector<ChunkID>& chunk_ids,
+                                            EncodingSelection encoding_selection) {
   for (auto chunk_id : chunk_ids) {
     Assert(chunk_id < table.chunk_count(), "Chunk with given ID does not exist.");
 
-    compress_chunk(table.column_types(), table.get_chunk(chunk_id));
+    compress_chunk(table.column_types(), table.get_chunk(chunk_id), encoding_selection);
   }
 }
 
-void DictionaryCompression::compress_table(Table& table) {
+void DictionaryCompression::compress_table(Table& table, EncodingSelection encoding_selection) {
   for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
     auto& chunk = table.get_chunk(chunk_id);
 
-    compress_chunk(table.column_types(), chunk);
+    compress_chunk(table.column_types(), chunk, encoding_selection);
   }
 }
 
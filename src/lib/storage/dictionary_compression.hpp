@@ -12,6 +12,13 @@ class BaseColumn;
 class Chunk;
 class Table;
 
+/**
+ * How compress_chunk chooses the encoding of each column. Automatic picks frame-of-reference encoding for suitable
+ * integer columns (see compress_column_adaptively). Chunks that are going to be indexed need DictionaryOnly, because
+ * GroupKeyIndex, CompositeGroupKeyIndex and AdaptiveRadixTreeIndex only work with DictionaryColumns.
+ */
+enum class EncodingSelection { Automatic, DictionaryOnly };
+
 class DictionaryCompression {
  public:
   /**
@@ -26,20 +33,38 @@ class DictionaryCompression {
    */
   static std::shared_ptr<BaseColumn> compress_column(DataType data_type, const std::shared_ptr<BaseColumn>& column);
 
+  /**
+   * @brief Compresses a column, choosing frame-of-reference encoding where it is smaller than a dictionary
+   *
+   * Integer columns of at least one frame in which (almost) every value is distinct are stored as
+   * FrameOfReferenceColumn<T>, because their dictionary would be as large as the column itself.
+   * All other columns are compressed as by compress_column.
+   *
+   * @param data_type enum value of the column’s type
+   * @param column needs to be of type ValueColumn<T>
+   * @return a compressed column of type DictionaryColumn<T> or FrameOfReferenceColumn<T>
+   */
+  static std::shared_ptr<BaseColumn> compress_column_adaptively(DataType data_type,
+                                                                const std::shared_ptr<BaseColumn>& column);
+
   /**
    * @brief Compresses a chunk
    *
-   * Compresses the passed chunk by compressing each column
+   * Compresses the passed chunk by compressing each column (see compress_column)
    * and reducing the fragmentation of its mvcc columns
    * All columns of the chunk need to be of type ValueColumn<T>
    *
+   * Unless encoding_selection is DictionaryOnly, each column is compressed by compress_column_adaptively.
+   *
    * This is potentially unsafe if another operation modifies the table at the same time. In most cases, this should
    * only be called by the ChunkCompressionTask.
    *
    * @param column_types from the chunk’s table
    * @param chunk to be compressed
+   * @param encoding_selection whether columns may be compressed as FrameOfReferenceColumn<T>
    */
-  static void compress_chunk(const std::vector<DataType>& column_types, Chunk& chunk);
+  static void compress_chunk(const std::vector<DataType>& column_types, Chunk& chunk,
+                             EncodingSelection encoding_selection = EncodingSelection::Automatic);
 
   /**
    * @brief Compresses specified chunks of a table
@@ -47,15 +72,20 @@ class DictionaryCompression {
    * This is potentially unsafe if another operation modifies the table at the same time. In most cases, this should
    * only be called by the ChunkCompressionTask.
    */
-  static void compress_chunks(Table& table, const std::vector<ChunkID>& chunk_ids);
+  static void compress_chunks(Table& table, const std::vector<ChunkID>& chunk_ids,
+                              EncodingSelection encoding_selection = EncodingSelection::Automatic);
 
   /**
    * @brief Compresses a table by calling compress_chunk for each chunk
    *
+   * With the default EncodingSelection::Automatic, integer columns may become FrameOfReferenceColumns, on which
+   * GroupKeyIndex, CompositeGroupKeyIndex and AdaptiveRadixTreeIndex fail an Assert. Pass DictionaryOnly if the
+   * table is going to be indexed.
+   *
    * This is potentially unsafe if another operation modifies the table at the same time. In most cases, this should
    * only be called by the ChunkCompressionTask.
    */
-  static void compress_table(Table& table);
+  static void compress_table(Table& table, EncodingSelection encoding_selection = EncodingSelection::Automatic);
 };
 
 }  // namespace opossum
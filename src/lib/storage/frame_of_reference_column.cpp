@@ -0,0 +1,159 @@
+#include "frame_of_reference_column.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "column_visitable.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+FrameOfReferenceColumn<T>::FrameOfReferenceColumn(const std::shared_ptr<const pmr_vector<T>>& minima,
+                                                  const std::shared_ptr<const pmr_vector<T>>& maxima,
+                                                  const std::shared_ptr<const BitPackedAttributeVector>& offsets)
+    : _minima(minima), _maxima(maxima), _offsets(offsets) {
+  DebugAssert(_minima->size() == _maxima->size(), "Number of minima and maxima must match.");
+  DebugAssert(_minima->size() == frame_count(), "There must be exactly one minimum per frame.");
+}
+
+template <typename T>
+const AllTypeVariant FrameOfReferenceColumn<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
+
+  const auto offset = _offsets->get(chunk_offset);
+
+  if (offset == NULL_VALUE_ID) {
+    return NULL_VALUE;
+  }
+
+  return decode((*_minima)[chunk_offset / frame_size], offset);
+}
+
+template <typename T>
+bool FrameOfReferenceColumn<T>::is_null(const ChunkOffset chunk_offset) const {
+  return _offsets->get(chunk_offset) == NULL_VALUE_ID;
+}
+
+template <typename T>
+const T FrameOfReferenceColumn<T>::get(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
+
+  const auto offset = _offsets->get(chunk_offset);
+
+  DebugAssert(offset != NULL_VALUE_ID, "Value at index " + std::to_string(chunk_offset) + " is null.");
+
+  return decode((*_minima)[chunk_offset / frame_size], offset);
+}
+
+template <typename T>
+void FrameOfReferenceColumn<T>::append(const AllTypeVariant&) {
+  Fail("FrameOfReferenceColumn is immutable");
+}
+
+template <typename T>
+std::shared_ptr<const pmr_vector<T>> FrameOfReferenceColumn<T>::minima() const {
+  return _minima;
+}
+
+template <typename T>
+std::shared_ptr<const pmr_vector<T>> FrameOfReferenceColumn<T>::maxima() const {
+  return _maxima;
+}
+
+template <typename T>
+std::shared_ptr<const BitPackedAttributeVector> FrameOfReferenceColumn<T>::offsets() const {
+  return _offsets;
+}
+
+template <typename T>
+const pmr_concurrent_vector<std::optional<T>> FrameOfReferenceColumn<T>::materialize_values() const {
+  pmr_concurrent_vector<std::optional<T>> values(size(), std::nullopt, _minima->get_allocator());
+
+  auto block = BitPackedAttributeVector::Block{};
+  for (auto block_begin = ChunkOffset{0u}; block_begin < size(); block_begin += BitPackedAttributeVector::block_size) {
+    _offsets->decode_block(block_begin / BitPackedAttributeVector::block_size, block);
+
+    const auto minimum = (*_minima)[block_begin / frame_size];
+    const auto block_end = std::min(block_begin + BitPackedAttributeVector::block_size, static_cast<uint32_t>(size()));
+
+    for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+      const auto offset = block[chunk_offset - block_begin];
+      if (offset == NULL_VALUE_ID) continue;
+
+      values[chunk_offset] = decode(minimum, offset);
+    }
+  }
+
+  return values;
+}
+
+template <typename T>
+size_t FrameOfReferenceColumn<T>::size() const {
+  return _offsets->size();
+}
+
+template <typename T>
+void FrameOfReferenceColumn<T>::visit(ColumnVisitable& visitable,
+                                      std::shared_ptr<ColumnVisitableContext> context) const {
+  visitable.handle_frame_of_reference_column(*this, std::move(context));
+}
+
+template <typename T>
+void FrameOfReferenceColumn<T>::write_string_representation(std::string& row_string,
+                                                            const ChunkOffset chunk_offset) const {
+  std::stringstream buffer;
+  // buffering value at chunk_offset
+  Assert(!is_null(chunk_offset), "This operation does not support NULL values.");
+
+  buffer << get(chunk_offset);
+  uint32_t length = buffer.str().length();
+  // writing byte representation of length
+  buffer.write(reinterpret_cast<const char*>(&length), sizeof(length));
+
+  // appending the new string to the already present string
+  row_string += buffer.str();
+}
+
+template <typename T>
+void FrameOfReferenceColumn<T>::copy_value_to_value_column(BaseColumn& value_column, ChunkOffset chunk_offset) const {
+  auto& output_column = static_cast<ValueColumn<T>&>(value_column);
+  auto& values_out = output_column.values();
+
+  const auto offset = _offsets->get(chunk_offset);
+  const auto is_null = (offset == NULL_VALUE_ID);
+
+  if (output_column.is_nullable()) {
+    output_column.null_values().push_back(is_null);
+    values_out.push_back(is_null ? T{} : decode((*_minima)[chunk_offset / frame_size], offset));
+  } else {
+    DebugAssert(!is_null, "Target column needs to be nullable");
+
+    values_out.push_back(decode((*_minima)[chunk_offset / frame_size], offset));
+  }
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> FrameOfReferenceColumn<T>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  pmr_vector<T> new_minima(*_minima, alloc);
+  pmr_vector<T> new_maxima(*_maxima, alloc);
+  auto new_offsets = std::static_pointer_cast<const BitPackedAttributeVector>(_offsets->copy_using_allocator(alloc));
+
+  return std::allocate_shared<FrameOfReferenceColumn<T>>(
+      alloc, std::allocate_shared<pmr_vector<T>>(alloc, std::move(new_minima)),
+      std::allocate_shared<pmr_vector<T>>(alloc, std::move(new_maxima)), new_offsets);
+}
+
+template class FrameOfReferenceColumn<int32_t>;
+template class FrameOfReferenceColumn<int64_t>;
+
+}  // namespace opossum
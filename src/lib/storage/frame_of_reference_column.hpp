@@ -0,0 +1,87 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "all_type_variant.hpp"
+#include "base_frame_of_reference_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Column that stores each integer as its offset to the minimum of its frame
+ *
+ * Dictionaries of columns with (almost) only distinct values, e.g., monotone keys, are as large as the column
+ * itself. Storing the per-frame minimum and bit-packed offsets avoids the dictionary altogether. The per-frame
+ * minimum and maximum also allow scans to skip whole frames.
+ * DictionaryCompression picks this encoding automatically for suitable columns (see compress_column_adaptively),
+ * unless a chunk is compressed with EncodingSelection::DictionaryOnly because it is going to be indexed.
+ *
+ * Only instantiated for int32_t and int64_t (see supports_frame_of_reference_encoding_v).
+ */
+template <typename T>
+class FrameOfReferenceColumn : public BaseFrameOfReferenceColumn {
+ public:
+  explicit FrameOfReferenceColumn(const std::shared_ptr<const pmr_vector<T>>& minima,
+                                  const std::shared_ptr<const pmr_vector<T>>& maxima,
+                                  const std::shared_ptr<const BitPackedAttributeVector>& offsets);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns whether a value is NULL
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // return the value at a certain position.
+  // Only use if you are certain that no null values are present, otherwise an Assert fails.
+  const T get(const ChunkOffset chunk_offset) const;
+
+  // frame-of-reference encoded columns are immutable
+  void append(const AllTypeVariant&) override;
+
+  // returns the smallest non-null value of each frame
+  std::shared_ptr<const pmr_vector<T>> minima() const;
+
+  // returns the largest non-null value of each frame
+  std::shared_ptr<const pmr_vector<T>> maxima() const;
+
+  std::shared_ptr<const BitPackedAttributeVector> offsets() const final;
+
+  // return a generated vector of all values (or nulls)
+  const pmr_concurrent_vector<std::optional<T>> materialize_values() const;
+
+  // return the number of entries
+  size_t size() const override;
+
+  // visitor pattern, see base_column.hpp
+  void visit(ColumnVisitable& visitable, std::shared_ptr<ColumnVisitableContext> context = nullptr) const override;
+
+  // writes the length and value at the chunk_offset to the end off row_string
+  void write_string_representation(std::string& row_string, const ChunkOffset chunk_offset) const override;
+
+  // copies one of its own values to a different ValueColumn - mainly used for materialization
+  void copy_value_to_value_column(BaseColumn& value_column, ChunkOffset chunk_offset) const override;
+
+  // Copies a FrameOfReferenceColumn using a new allocator. This is useful for placing it on a new NUMA node.
+  std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const override;
+
+  // Computes the difference in unsigned arithmetic so that frames may span the whole range of T
+  static uint32_t encode(const T minimum, const T value) {
+    return static_cast<uint32_t>(static_cast<std::make_unsigned_t<T>>(value) -
+                                 static_cast<std::make_unsigned_t<T>>(minimum));
+  }
+
+  static T decode(const T minimum, const uint32_t offset) {
+    return static_cast<T>(static_cast<std::make_unsigned_t<T>>(minimum) + offset);
+  }
+
+ protected:
+  const std::shared_ptr<const pmr_vector<T>> _minima;
+  const std::shared_ptr<const pmr_vector<T>> _maxima;
+  const std::shared_ptr<const BitPackedAttributeVector> _offsets;
+};
+
+}  // namespace opossum
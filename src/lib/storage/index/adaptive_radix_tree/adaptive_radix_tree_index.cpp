@@ -20,7 +20,9 @@ namespace opossum {
 AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
     : BaseIndex{get_index_type_of<AdaptiveRadixTreeIndex>()},
       _index_column(std::dynamic_pointer_cast<const BaseDictionaryColumn>(index_columns.front())) {
-  DebugAssert(static_cast<bool>(_index_column), "AdaptiveRadixTree only works with DictionaryColumns for now");
+  Assert(static_cast<bool>(_index_column),
+         "AdaptiveRadixTree only works with DictionaryColumns for now, compress the chunk with "
+         "EncodingSelection::DictionaryOnly");
   DebugAssert((index_columns.size() == 1), "AdaptiveRadixTree only works with a single column");
 
   // for each valueID in the attribute vector, create a pair consisting of a BinaryComparable of this valueID and its
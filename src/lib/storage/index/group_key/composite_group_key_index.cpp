@@ -35,7 +35,9 @@ CompositeGroupKeyIndex::CompositeGroupKeyIndex(const std::vector<std::shared_ptr
   _indexed_columns.reserve(indexed_columns.size());
   for (const auto& column : indexed_columns) {
     auto dict_column = std::dynamic_pointer_cast<const BaseDictionaryColumn>(column);
-    DebugAssert(static_cast<bool>(dict_column), "CompositeGroupKeyIndex only works with DictionaryColumns");
+    Assert(static_cast<bool>(dict_column),
+           "CompositeGroupKeyIndex only works with DictionaryColumns, compress the chunk with "
+           "EncodingSelection::DictionaryOnly");
     _indexed_columns.emplace_back(dict_column);
   }
 
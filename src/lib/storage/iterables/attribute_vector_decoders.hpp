@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storage/base_attribute_vector.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * @defgroup Sequential decoders for attribute vectors
+ *
+ * Calling the virtual BaseAttributeVector::get() for each row prevents the compiler
+ * from inlining and vectorizing the hot loops of iterables. The decoders are
+ * created for the concrete attribute vector type (see resolve_attribute_vector_type)
+ * and return the ValueID at the current position without any virtual calls.
+ * Bit-packed attribute vectors are decoded one block at a time.
+ *
+ * All decoders implement the following interface:
+ *
+ *   ValueID value_id() const;        // NULL_VALUE_ID if the value is null
+ *   ChunkOffset chunk_offset() const;
+ *   void increment();
+ *   bool equal(const Decoder& other) const;
+ *
+ * @{
+ */
+
+template <typename uintX_t>
+class FittedAttributeVectorDecoder {
+ public:
+  FittedAttributeVectorDecoder(const FittedAttributeVector<uintX_t>& attribute_vector, ChunkOffset chunk_offset)
+      : _attributes{attribute_vector.attributes().data()}, _chunk_offset{chunk_offset} {}
+
+  ValueID value_id() const {
+    const auto value_id = _attributes[_chunk_offset];
+    return (value_id == FittedAttributeVector<uintX_t>::CLAMPED_NULL_VALUE_ID) ? NULL_VALUE_ID
+                                                                               : static_cast<ValueID>(value_id);
+  }
+
+  ChunkOffset chunk_offset() const { return _chunk_offset; }
+  void increment() { ++_chunk_offset; }
+  bool equal(const FittedAttributeVectorDecoder& other) const { return _chunk_offset == other._chunk_offset; }
+
+ private:
+  const uintX_t* _attributes;
+  ChunkOffset _chunk_offset;
+};
+
+class BitPackedAttributeVectorDecoder {
+ public:
+  static constexpr auto block_size = BitPackedAttributeVector::block_size;
+
+ public:
+  BitPackedAttributeVectorDecoder(const BitPackedAttributeVector& attribute_vector, ChunkOffset chunk_offset)
+      : _attribute_vector{&attribute_vector}, _chunk_offset{chunk_offset} {
+    if (_chunk_offset < _attribute_vector->size()) _attribute_vector->decode_block(_chunk_offset / block_size, _block);
+  }
+
+  ValueID value_id() const { return ValueID{_block[_chunk_offset % block_size]}; }
+
+  ChunkOffset chunk_offset() const { return _chunk_offset; }
+
+  void increment() {
+    ++_chunk_offset;
+    if (_chunk_offset % block_size == 0u && _chunk_offset < _attribute_vector->size()) {
+      _attribute_vector->decode_block(_chunk_offset / block_size, _block);
+    }
+  }
+
+  bool equal(const BitPackedAttributeVectorDecoder& other) const { return _chunk_offset == other._chunk_offset; }
+
+ private:
+  const BitPackedAttributeVector* _attribute_vector;
+  ChunkOffset _chunk_offset;
+  BitPackedAttributeVector::Block _block;
+};
+
+template <typename uintX_t>
+auto create_attribute_vector_decoder(const FittedAttributeVector<uintX_t>& attribute_vector,
+                                     ChunkOffset chunk_offset) {
+  return FittedAttributeVectorDecoder<uintX_t>{attribute_vector, chunk_offset};
+}
+
+inline auto create_attribute_vector_decoder(const BitPackedAttributeVector& attribute_vector,
+                                            ChunkOffset chunk_offset) {
+  return BitPackedAttributeVectorDecoder{attribute_vector, chunk_offset};
+}
+
+/**@}*/
+
+/**
+ * Resolves the concrete type of an attribute vector and calls the functor with it.
+ * Calls to get() on the resolved attribute vector are not virtual because all implementations are final.
+ *
+ * Example:
+ *
+ *   resolve_attribute_vector_type(base_attribute_vector, [&](const auto& attribute_vector) {
+ *     auto decoder = create_attribute_vector_decoder(attribute_vector, 0u);
+ *     ...
+ *   });
+ */
+template <typename Functor>
+void resolve_attribute_vector_type(const BaseAttributeVector& attribute_vector, const Functor& func) {
+  if (auto fitted_uint8 = dynamic_cast<const FittedAttributeVector<uint8_t>*>(&attribute_vector)) {
+    func(*fitted_uint8);
+  } else if (auto fitted_uint16 = dynamic_cast<const FittedAttributeVector<uint16_t>*>(&attribute_vector)) {
+    func(*fitted_uint16);
+  } else if (auto fitted_uint32 = dynamic_cast<const FittedAttributeVector<uint32_t>*>(&attribute_vector)) {
+    func(*fitted_uint32);
+  } else if (auto bit_packed = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    func(*bit_packed);
+  } else {
+    Fail("Unrecognized attribute vector type encountered.");
+  }
+}
+
+}  // namespace opossum
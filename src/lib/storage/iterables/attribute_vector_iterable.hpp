@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "attribute_vector_decoders.hpp"
 #include "iterables.hpp"
 #include "storage/base_attribute_vector.hpp"
 
@@ -15,49 +16,59 @@ class AttributeVectorIterable : public IndexableIterable<AttributeVectorIterable
 
   template <typename Functor>
   void _on_with_iterators(const Functor& f) const {
-    auto begin = Iterator{_attribute_vector, 0u};
-    auto end = Iterator{_attribute_vector, static_cast<ChunkOffset>(_attribute_vector.size())};
-    f(begin, end);
+    resolve_attribute_vector_type(_attribute_vector, [&](const auto& attribute_vector) {
+      using Decoder = decltype(create_attribute_vector_decoder(attribute_vector, 0u));
+
+      auto begin = Iterator<Decoder>{create_attribute_vector_decoder(attribute_vector, 0u)};
+      auto end = Iterator<Decoder>{
+          create_attribute_vector_decoder(attribute_vector, static_cast<ChunkOffset>(attribute_vector.size()))};
+      f(begin, end);
+    });
   }
 
   template <typename Functor>
   void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& f) const {
-    auto begin = IndexedIterator{_attribute_vector, mapped_chunk_offsets.cbegin()};
-    auto end = IndexedIterator{_attribute_vector, mapped_chunk_offsets.cend()};
-    f(begin, end);
+    resolve_attribute_vector_type(_attribute_vector, [&](const auto& attribute_vector) {
+      using AttributeVectorType = std::decay_t<decltype(attribute_vector)>;
+
+      auto begin = IndexedIterator<AttributeVectorType>{attribute_vector, mapped_chunk_offsets.cbegin()};
+      auto end = IndexedIterator<AttributeVectorType>{attribute_vector, mapped_chunk_offsets.cend()};
+      f(begin, end);
+    });
   }
 
  private:
   const BaseAttributeVector& _attribute_vector;
 
  private:
-  class Iterator : public BaseIterator<Iterator, NullableColumnValue<ValueID>> {
+  template <typename Decoder>
+  class Iterator : public BaseIterator<Iterator<Decoder>, NullableColumnValue<ValueID>> {
    public:
-    explicit Iterator(const BaseAttributeVector& attribute_vector, ChunkOffset chunk_offset)
-        : _attribute_vector{attribute_vector}, _chunk_offset{chunk_offset} {}
+    explicit Iterator(const Decoder& decoder) : _decoder{decoder} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
-    void increment() { ++_chunk_offset; }
-    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+    void increment() { _decoder.increment(); }
+    bool equal(const Iterator& other) const { return _decoder.equal(other._decoder); }
 
     NullableColumnValue<ValueID> dereference() const {
-      const auto value_id = _attribute_vector.get(_chunk_offset);
+      const auto value_id = _decoder.value_id();
       const auto is_null = (value_id == NULL_VALUE_ID);
 
-      return NullableColumnValue<ValueID>{value_id, is_null, _chunk_offset};
+      return NullableColumnValue<ValueID>{value_id, is_null, _decoder.chunk_offset()};
     }
 
    private:
-    const BaseAttributeVector& _attribute_vector;
-    ChunkOffset _chunk_offset;
+    Decoder _decoder;
   };
 
-  class IndexedIterator : public BaseIndexedIterator<IndexedIterator, NullableColumnValue<ValueID>> {
+  template <typename AttributeVectorType>
+  class IndexedIterator
+      : public BaseIndexedIterator<IndexedIterator<AttributeVectorType>, NullableColumnValue<ValueID>> {
    public:
-    explicit IndexedIterator(const BaseAttributeVector& attribute_vector, const ChunkOffsetsIterator& chunk_offsets_it)
-        : BaseIndexedIterator<IndexedIterator, NullableColumnValue<ValueID>>{chunk_offsets_it},
+    explicit IndexedIterator(const AttributeVectorType& attribute_vector, const ChunkOffsetsIterator& chunk_offsets_it)
+        : BaseIndexedIterator<IndexedIterator<AttributeVectorType>, NullableColumnValue<ValueID>>{chunk_offsets_it},
           _attribute_vector{attribute_vector} {}
 
    private:
@@ -76,7 +87,7 @@ class AttributeVectorIterable : public IndexableIterable<AttributeVectorIterable
     }
 
    private:
-    const BaseAttributeVector& _attribute_vector;
+    const AttributeVectorType& _attribute_vector;
   };
 };
 
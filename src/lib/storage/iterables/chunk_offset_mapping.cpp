@@ -19,4 +19,22 @@ ChunkOffsetsByChunkID split_pos_list_by_chunk_id(const PosList& pos_list, bool s
   return chunk_offsets_by_chunk_id;
 }
 
+ChunkOffsetsByChunkID split_pos_list_by_chunk_id(const PosList& pos_list, const PosList& selection,
+                                                 bool skip_null_row_ids) {
+  auto chunk_offsets_by_chunk_id = ChunkOffsetsByChunkID{};
+
+  for (const auto& selected_row_id : selection) {
+    const auto chunk_offset = selected_row_id.chunk_offset;
+    const auto row_id = pos_list[chunk_offset];
+
+    if (skip_null_row_ids && row_id == NULL_ROW_ID) continue;
+
+    auto& mapped_chunk_offsets = chunk_offsets_by_chunk_id[row_id.chunk_id];
+
+    mapped_chunk_offsets.push_back({chunk_offset, row_id.chunk_offset});
+  }
+
+  return chunk_offsets_by_chunk_id;
+}
+
 }  // namespace opossum
@@ -10,7 +10,7 @@ namespace opossum {
 /**
  * Mapping between chunk offset into a reference column and
  * its dereferenced counter part, i.e., a reference into the
- * referenced value or dictionary column.
+ * referenced value, dictionary, or run-length column.
  */
 struct ChunkOffsetMapping {
   const ChunkOffset into_referencing;  // chunk offset into reference column
@@ -33,4 +33,11 @@ using ChunkOffsetsByChunkID = std::unordered_map<ChunkID, ChunkOffsetsList>;
  */
 ChunkOffsetsByChunkID split_pos_list_by_chunk_id(const PosList& pos_list, bool skip_null_row_ids = true);
 
+/**
+ * Like above, but only for the chunk offsets of pos_list that are in selection, a list of RowIDs into the chunk of the
+ * reference column.
+ */
+ChunkOffsetsByChunkID split_pos_list_by_chunk_id(const PosList& pos_list, const PosList& selection,
+                                                 bool skip_null_row_ids = true);
+
 }  // namespace opossum
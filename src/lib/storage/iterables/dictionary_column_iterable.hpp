@@ -3,6 +3,7 @@
 #include <utility>
 #include <vector>
 
+#include "attribute_vector_decoders.hpp"
 #include "iterables.hpp"
 #include "storage/base_attribute_vector.hpp"
 #include "storage/dictionary_column.hpp"
@@ -16,60 +17,72 @@ class DictionaryColumnIterable : public IndexableIterable<DictionaryColumnIterab
 
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
-    auto begin = Iterator{*_column.dictionary(), *_column.attribute_vector(), 0u};
-    auto end = Iterator{*_column.dictionary(), *_column.attribute_vector(), static_cast<ChunkOffset>(_column.size())};
-    functor(begin, end);
+    resolve_attribute_vector_type(*_column.attribute_vector(), [&](const auto& attribute_vector) {
+      using Decoder = decltype(create_attribute_vector_decoder(attribute_vector, 0u));
+
+      auto begin = Iterator<Decoder>{*_column.dictionary(), create_attribute_vector_decoder(attribute_vector, 0u)};
+      auto end = Iterator<Decoder>{
+          *_column.dictionary(),
+          create_attribute_vector_decoder(attribute_vector, static_cast<ChunkOffset>(_column.size()))};
+      functor(begin, end);
+    });
   }
 
   template <typename Functor>
   void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
-    auto begin = IndexedIterator{*_column.dictionary(), *_column.attribute_vector(), mapped_chunk_offsets.cbegin()};
-    auto end = IndexedIterator{*_column.dictionary(), *_column.attribute_vector(), mapped_chunk_offsets.cend()};
-    functor(begin, end);
+    resolve_attribute_vector_type(*_column.attribute_vector(), [&](const auto& attribute_vector) {
+      using AttributeVectorType = std::decay_t<decltype(attribute_vector)>;
+
+      auto begin = IndexedIterator<AttributeVectorType>{*_column.dictionary(), attribute_vector,
+                                                        mapped_chunk_offsets.cbegin()};
+      auto end = IndexedIterator<AttributeVectorType>{*_column.dictionary(), attribute_vector,
+                                                      mapped_chunk_offsets.cend()};
+      functor(begin, end);
+    });
   }
 
  private:
   const DictionaryColumn<T>& _column;
 
  private:
-  class Iterator : public BaseIterator<Iterator, NullableColumnValue<T>> {
+  template <typename Decoder>
+  class Iterator : public BaseIterator<Iterator<Decoder>, NullableColumnValue<T>> {
    public:
-    using Dictionary = pmr_vector<T>;
+    using Dictionary = dictionary_t<T>;
 
    public:
-    explicit Iterator(const Dictionary& dictionary, const BaseAttributeVector& attribute_vector,
-                      ChunkOffset chunk_offset)
-        : _dictionary{dictionary}, _attribute_vector{attribute_vector}, _chunk_offset{chunk_offset} {}
+    explicit Iterator(const Dictionary& dictionary, const Decoder& decoder)
+        : _dictionary{dictionary}, _decoder{decoder} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
-    void increment() { ++_chunk_offset; }
-    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+    void increment() { _decoder.increment(); }
+    bool equal(const Iterator& other) const { return _decoder.equal(other._decoder); }
 
     NullableColumnValue<T> dereference() const {
-      const auto value_id = _attribute_vector.get(_chunk_offset);
+      const auto value_id = _decoder.value_id();
       const auto is_null = (value_id == NULL_VALUE_ID);
 
-      if (is_null) return NullableColumnValue<T>{T{}, true, _chunk_offset};
+      if (is_null) return NullableColumnValue<T>{T{}, true, _decoder.chunk_offset()};
 
-      return NullableColumnValue<T>{_dictionary[value_id], false, _chunk_offset};
+      return NullableColumnValue<T>{_dictionary[value_id], false, _decoder.chunk_offset()};
     }
 
    private:
     const Dictionary& _dictionary;
-    const BaseAttributeVector& _attribute_vector;
-    ChunkOffset _chunk_offset;
+    Decoder _decoder;
   };
 
-  class IndexedIterator : public BaseIndexedIterator<IndexedIterator, NullableColumnValue<T>> {
+  template <typename AttributeVectorType>
+  class IndexedIterator : public BaseIndexedIterator<IndexedIterator<AttributeVectorType>, NullableColumnValue<T>> {
    public:
-    using Dictionary = pmr_vector<T>;
+    using Dictionary = dictionary_t<T>;
 
    public:
-    explicit IndexedIterator(const Dictionary& dictionary, const BaseAttributeVector& attribute_vector,
+    explicit IndexedIterator(const Dictionary& dictionary, const AttributeVectorType& attribute_vector,
                              const ChunkOffsetsIterator& chunk_offsets_it)
-        : BaseIndexedIterator<IndexedIterator, NullableColumnValue<T>>{chunk_offsets_it},
+        : BaseIndexedIterator<IndexedIterator<AttributeVectorType>, NullableColumnValue<T>>{chunk_offsets_it},
           _dictionary{dictionary},
           _attribute_vector{attribute_vector} {}
 
@@ -92,7 +105,7 @@ class DictionaryColumnIterable : public IndexableIterable<DictionaryColumnIterab
 
    private:
     const Dictionary& _dictionary;
-    const BaseAttributeVector& _attribute_vector;
+    const AttributeVectorType& _attribute_vector;
   };
 };
 
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "attribute_vector_decoders.hpp"
+#include "iterables.hpp"
+#include "storage/frame_of_reference_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+class FrameOfReferenceColumnIterable : public IndexableIterable<FrameOfReferenceColumnIterable<T>> {
+ public:
+  explicit FrameOfReferenceColumnIterable(const FrameOfReferenceColumn<T>& column) : _column{column} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    const auto& minima = *_column.minima();
+    const auto& offsets = *_column.offsets();
+
+    auto begin = Iterator{minima, BitPackedAttributeVectorDecoder{offsets, 0u}};
+    auto end = Iterator{minima, BitPackedAttributeVectorDecoder{offsets, static_cast<ChunkOffset>(_column.size())}};
+    functor(begin, end);
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
+    const auto& minima = *_column.minima();
+    const auto& offsets = *_column.offsets();
+
+    auto begin = IndexedIterator{minima, offsets, mapped_chunk_offsets.cbegin()};
+    auto end = IndexedIterator{minima, offsets, mapped_chunk_offsets.cend()};
+    functor(begin, end);
+  }
+
+ private:
+  const FrameOfReferenceColumn<T>& _column;
+
+ private:
+  class Iterator : public BaseIterator<Iterator, NullableColumnValue<T>> {
+   public:
+    using Minima = pmr_vector<T>;
+
+   public:
+    explicit Iterator(const Minima& minima, const BitPackedAttributeVectorDecoder& decoder)
+        : _minima{minima}, _decoder{decoder} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { _decoder.increment(); }
+    bool equal(const Iterator& other) const { return _decoder.equal(other._decoder); }
+
+    NullableColumnValue<T> dereference() const {
+      const auto offset = _decoder.value_id();
+      const auto chunk_offset = _decoder.chunk_offset();
+
+      if (offset == NULL_VALUE_ID) return NullableColumnValue<T>{T{}, true, chunk_offset};
+
+      const auto minimum = _minima[chunk_offset / FrameOfReferenceColumn<T>::frame_size];
+      return NullableColumnValue<T>{FrameOfReferenceColumn<T>::decode(minimum, offset), false, chunk_offset};
+    }
+
+   private:
+    const Minima& _minima;
+    BitPackedAttributeVectorDecoder _decoder;
+  };
+
+  class IndexedIterator : public BaseIndexedIterator<IndexedIterator, NullableColumnValue<T>> {
+   public:
+    using Minima = pmr_vector<T>;
+
+   public:
+    explicit IndexedIterator(const Minima& minima, const BitPackedAttributeVector& offsets,
+                             const ChunkOffsetsIterator& chunk_offsets_it)
+        : BaseIndexedIterator<IndexedIterator, NullableColumnValue<T>>{chunk_offsets_it},
+          _minima{minima},
+          _offsets{offsets} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    NullableColumnValue<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+
+      if (chunk_offsets.into_referenced == INVALID_CHUNK_OFFSET)
+        return NullableColumnValue<T>{T{}, true, chunk_offsets.into_referencing};
+
+      const auto offset = _offsets.get(chunk_offsets.into_referenced);
+
+      if (offset == NULL_VALUE_ID) return NullableColumnValue<T>{T{}, true, chunk_offsets.into_referencing};
+
+      const auto minimum = _minima[chunk_offsets.into_referenced / FrameOfReferenceColumn<T>::frame_size];
+      return NullableColumnValue<T>{FrameOfReferenceColumn<T>::decode(minimum, offset), false,
+                                    chunk_offsets.into_referencing};
+    }
+
+   private:
+    const Minima& _minima;
+    const BitPackedAttributeVector& _offsets;
+  };
+};
+
+}  // namespace opossum
@@ -6,12 +6,14 @@
 #include <vector>
 
 #include "iterables.hpp"
+#include "storage/frame_of_reference_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/run_length_column.hpp"
 
 namespace opossum {
 
 template <typename T>
-class ReferenceColumnIterable : public Iterable<ReferenceColumnIterable<T>> {
+class ReferenceColumnIterable : public IndexableIterable<ReferenceColumnIterable<T>> {
  public:
   explicit ReferenceColumnIterable(const ReferenceColumn& column) : _column{column} {}
 
@@ -28,41 +30,62 @@ class ReferenceColumnIterable : public Iterable<ReferenceColumnIterable<T>> {
     functor(begin, end);
   }
 
+  /**
+   * into_referenced of the mapped chunk offsets is an index into the position list,
+   * i.e., a chunk offset into the reference column itself.
+   */
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
+    const auto table = _column.referenced_table();
+    const auto column_id = _column.referenced_column_id();
+    const auto& pos_list = *_column.pos_list();
+
+    auto begin = IndexedIterator{table, column_id, pos_list, mapped_chunk_offsets.cbegin()};
+    auto end = IndexedIterator{table, column_id, pos_list, mapped_chunk_offsets.cend()};
+    functor(begin, end);
+  }
+
  private:
   const ReferenceColumn& _column;
 
  private:
-  class Iterator : public BaseIterator<Iterator, NullableColumnValue<T>> {
-   public:
-    using PosListIterator = PosList::const_iterator;
-
+  /**
+   * Looks up the values of the referenced columns. The referenced columns are cast once per chunk and then cached.
+   */
+  class ReferencedValueAccessor {
    public:
-    explicit Iterator(const std::shared_ptr<const Table> table, const ColumnID column_id,
-                      const PosListIterator& begin_pos_list_it, const PosListIterator& pos_list_it)
-        : _table{table}, _column_id{column_id}, _begin_pos_list_it{begin_pos_list_it}, _pos_list_it{pos_list_it} {}
-
-   private:
-    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
-
-    void increment() { ++_pos_list_it; }
-
-    bool equal(const Iterator& other) const { return _pos_list_it == other._pos_list_it; }
+    explicit ReferencedValueAccessor(const std::shared_ptr<const Table> table, const ColumnID column_id)
+        : _table{table}, _column_id{column_id} {}
 
     // TODO(anyone): benchmark if using two maps instead doing the dynamic cast every time really is faster.
-    NullableColumnValue<T> dereference() const {
-      if (*_pos_list_it == NULL_ROW_ID) return NullableColumnValue<T>{T{}, true, 0u};
+    NullableColumnValue<T> get(const RowID& row_id, const ChunkOffset chunk_offset_into_ref_column) const {
+      if (row_id == NULL_ROW_ID) return NullableColumnValue<T>{T{}, true, chunk_offset_into_ref_column};
 
-      const auto chunk_id = _pos_list_it->chunk_id;
-      const auto& chunk_offset = _pos_list_it->chunk_offset;
+      const auto chunk_id = row_id.chunk_id;
+      const auto& chunk_offset = row_id.chunk_offset;
 
       auto value_column_it = _value_columns.find(chunk_id);
       if (value_column_it != _value_columns.end()) {
-        return _value_from_value_column(*(value_column_it->second), chunk_offset);
+        return _value_from_value_column(*(value_column_it->second), chunk_offset, chunk_offset_into_ref_column);
       }
 
       auto dict_column_it = _dictionary_columns.find(chunk_id);
       if (dict_column_it != _dictionary_columns.end()) {
-        return _value_from_dictionary_column(*(dict_column_it->second), chunk_offset);
+        return _value_from_dictionary_column(*(dict_column_it->second), chunk_offset, chunk_offset_into_ref_column);
+      }
+
+      auto run_length_column_it = _run_length_columns.find(chunk_id);
+      if (run_length_column_it != _run_length_columns.end()) {
+        return _value_from_run_length_column(*(run_length_column_it->second), chunk_offset,
+                                             chunk_offset_into_ref_column);
+      }
+
+      if constexpr (supports_frame_of_reference_encoding_v<T>) {
+        auto frame_of_reference_column_it = _frame_of_reference_columns.find(chunk_id);
+        if (frame_of_reference_column_it != _frame_of_reference_columns.end()) {
+          return _value_from_frame_of_reference_column(*(frame_of_reference_column_it->second), chunk_offset,
+                                                       chunk_offset_into_ref_column);
+        }
       }
 
       const auto& chunk = _table->get_chunk(chunk_id);
@@ -70,23 +93,34 @@ class ReferenceColumnIterable : public Iterable<ReferenceColumnIterable<T>> {
 
       if (auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column)) {
         _value_columns[chunk_id] = value_column;
-        return _value_from_value_column(*value_column, chunk_offset);
+        return _value_from_value_column(*value_column, chunk_offset, chunk_offset_into_ref_column);
       }
 
       if (auto dict_column = std::dynamic_pointer_cast<const DictionaryColumn<T>>(column)) {
         _dictionary_columns[chunk_id] = dict_column;
-        return _value_from_dictionary_column(*dict_column, chunk_offset);
+        return _value_from_dictionary_column(*dict_column, chunk_offset, chunk_offset_into_ref_column);
       }
 
-      Fail("Referenced column is neither value nor dictionary column.");
+      if (auto run_length_column = std::dynamic_pointer_cast<const RunLengthColumn<T>>(column)) {
+        _run_length_columns[chunk_id] = run_length_column;
+        return _value_from_run_length_column(*run_length_column, chunk_offset, chunk_offset_into_ref_column);
+      }
+
+      if constexpr (supports_frame_of_reference_encoding_v<T>) {
+        if (auto frame_of_reference_column = std::dynamic_pointer_cast<const FrameOfReferenceColumn<T>>(column)) {
+          _frame_of_reference_columns[chunk_id] = frame_of_reference_column;
+          return _value_from_frame_of_reference_column(*frame_of_reference_column, chunk_offset,
+                                                       chunk_offset_into_ref_column);
+        }
+      }
+
+      Fail("Referenced column is neither value, dictionary, run-length, nor frame-of-reference column.");
       return NullableColumnValue<T>{T{}, false, 0u};
     }
 
    private:
-    auto _value_from_value_column(const ValueColumn<T>& column, const ChunkOffset& chunk_offset) const {
-      const auto chunk_offset_into_ref_column =
-          static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
-
+    auto _value_from_value_column(const ValueColumn<T>& column, const ChunkOffset& chunk_offset,
+                                  const ChunkOffset chunk_offset_into_ref_column) const {
       if (column.is_nullable()) {
         auto is_null = column.null_values()[chunk_offset];
         const auto& value = is_null ? T{} : column.values()[chunk_offset];
@@ -97,9 +131,8 @@ class ReferenceColumnIterable : public Iterable<ReferenceColumnIterable<T>> {
       return NullableColumnValue<T>{value, false, chunk_offset_into_ref_column};
     }
 
-    auto _value_from_dictionary_column(const DictionaryColumn<T>& column, const ChunkOffset& chunk_offset) const {
-      const auto chunk_offset_into_ref_column =
-          static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
+    auto _value_from_dictionary_column(const DictionaryColumn<T>& column, const ChunkOffset& chunk_offset,
+                                       const ChunkOffset chunk_offset_into_ref_column) const {
       auto attribute_vector = column.attribute_vector();
       auto value_id = attribute_vector->get(chunk_offset);
 
@@ -113,15 +146,91 @@ class ReferenceColumnIterable : public Iterable<ReferenceColumnIterable<T>> {
       return NullableColumnValue<T>{value, false, chunk_offset_into_ref_column};
     }
 
+    auto _value_from_run_length_column(const RunLengthColumn<T>& column, const ChunkOffset& chunk_offset,
+                                       const ChunkOffset chunk_offset_into_ref_column) const {
+      const auto run_index = column.run_index(chunk_offset);
+
+      if ((*column.null_values())[run_index]) {
+        return NullableColumnValue<T>{T{}, true, chunk_offset_into_ref_column};
+      }
+
+      const auto& value = (*column.values())[run_index];
+
+      return NullableColumnValue<T>{value, false, chunk_offset_into_ref_column};
+    }
+
+    auto _value_from_frame_of_reference_column(const FrameOfReferenceColumn<T>& column,
+                                               const ChunkOffset& chunk_offset,
+                                               const ChunkOffset chunk_offset_into_ref_column) const {
+      if (column.is_null(chunk_offset)) {
+        return NullableColumnValue<T>{T{}, true, chunk_offset_into_ref_column};
+      }
+
+      return NullableColumnValue<T>{column.get(chunk_offset), false, chunk_offset_into_ref_column};
+    }
+
    private:
     const std::shared_ptr<const Table> _table;
     const ColumnID _column_id;
 
+    mutable std::map<ChunkID, std::shared_ptr<const ValueColumn<T>>> _value_columns;
+    mutable std::map<ChunkID, std::shared_ptr<const DictionaryColumn<T>>> _dictionary_columns;
+    mutable std::map<ChunkID, std::shared_ptr<const RunLengthColumn<T>>> _run_length_columns;
+    mutable std::map<ChunkID, std::shared_ptr<const FrameOfReferenceColumn<T>>> _frame_of_reference_columns;
+  };
+
+  class Iterator : public BaseIterator<Iterator, NullableColumnValue<T>> {
+   public:
+    using PosListIterator = PosList::const_iterator;
+
+   public:
+    explicit Iterator(const std::shared_ptr<const Table> table, const ColumnID column_id,
+                      const PosListIterator& begin_pos_list_it, const PosListIterator& pos_list_it)
+        : _accessor{table, column_id}, _begin_pos_list_it{begin_pos_list_it}, _pos_list_it{pos_list_it} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { ++_pos_list_it; }
+
+    bool equal(const Iterator& other) const { return _pos_list_it == other._pos_list_it; }
+
+    NullableColumnValue<T> dereference() const {
+      const auto chunk_offset_into_ref_column =
+          static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
+      return _accessor.get(*_pos_list_it, chunk_offset_into_ref_column);
+    }
+
+   private:
+    ReferencedValueAccessor _accessor;
+
     const PosListIterator _begin_pos_list_it;
     PosListIterator _pos_list_it;
+  };
 
-    mutable std::map<ChunkID, std::shared_ptr<const ValueColumn<T>>> _value_columns;
-    mutable std::map<ChunkID, std::shared_ptr<const DictionaryColumn<T>>> _dictionary_columns;
+  class IndexedIterator : public BaseIndexedIterator<IndexedIterator, NullableColumnValue<T>> {
+   public:
+    explicit IndexedIterator(const std::shared_ptr<const Table> table, const ColumnID column_id,
+                             const PosList& pos_list, const ChunkOffsetsIterator& chunk_offsets_it)
+        : BaseIndexedIterator<IndexedIterator, NullableColumnValue<T>>{chunk_offsets_it},
+          _accessor{table, column_id},
+          _pos_list{pos_list} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    NullableColumnValue<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+
+      if (chunk_offsets.into_referenced == INVALID_CHUNK_OFFSET)
+        return NullableColumnValue<T>{T{}, true, chunk_offsets.into_referencing};
+
+      return _accessor.get(_pos_list[chunk_offsets.into_referenced], chunk_offsets.into_referencing);
+    }
+
+   private:
+    ReferencedValueAccessor _accessor;
+    const PosList& _pos_list;
   };
 };
 
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "iterables.hpp"
+#include "storage/run_length_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+class RunLengthColumnIterable : public IndexableIterable<RunLengthColumnIterable<T>> {
+ public:
+  explicit RunLengthColumnIterable(const RunLengthColumn<T>& column) : _column{column} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    const auto& values = *_column.values();
+    const auto& null_values = *_column.null_values();
+    const auto& end_positions = *_column.end_positions();
+
+    auto begin = Iterator{values.cbegin(), null_values.cbegin(), end_positions.cbegin(), 0u};
+    auto end = Iterator{values.cend(), null_values.cend(), end_positions.cend(),
+                        static_cast<ChunkOffset>(_column.size())};
+    functor(begin, end);
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
+    const auto& values = *_column.values();
+    const auto& null_values = *_column.null_values();
+    const auto& end_positions = *_column.end_positions();
+
+    auto begin = IndexedIterator{values, null_values, end_positions, mapped_chunk_offsets.cbegin()};
+    auto end = IndexedIterator{values, null_values, end_positions, mapped_chunk_offsets.cend()};
+    functor(begin, end);
+  }
+
+ private:
+  const RunLengthColumn<T>& _column;
+
+ private:
+  class Iterator : public BaseIterator<Iterator, NullableColumnValue<T>> {
+   public:
+    using ValueIterator = typename pmr_vector<T>::const_iterator;
+    using NullValueIterator = pmr_vector<bool>::const_iterator;
+    using EndPositionIterator = pmr_vector<ChunkOffset>::const_iterator;
+
+   public:
+    explicit Iterator(const ValueIterator& value_it, const NullValueIterator& null_value_it,
+                      const EndPositionIterator& end_position_it, const ChunkOffset chunk_offset)
+        : _value_it{value_it},
+          _null_value_it{null_value_it},
+          _end_position_it{end_position_it},
+          _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_chunk_offset;
+
+      // Move to the next run once the last row of the current one has been passed
+      if (_chunk_offset > *_end_position_it) {
+        ++_value_it;
+        ++_null_value_it;
+        ++_end_position_it;
+      }
+    }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    NullableColumnValue<T> dereference() const {
+      return NullableColumnValue<T>{*_value_it, *_null_value_it, _chunk_offset};
+    }
+
+   private:
+    ValueIterator _value_it;
+    NullValueIterator _null_value_it;
+    EndPositionIterator _end_position_it;
+    ChunkOffset _chunk_offset;
+  };
+
+  class IndexedIterator : public BaseIndexedIterator<IndexedIterator, NullableColumnValue<T>> {
+   public:
+    using ValueVector = pmr_vector<T>;
+    using NullValueVector = pmr_vector<bool>;
+    using EndPositionVector = pmr_vector<ChunkOffset>;
+
+   public:
+    explicit IndexedIterator(const ValueVector& values, const NullValueVector& null_values,
+                             const EndPositionVector& end_positions, const ChunkOffsetsIterator& chunk_offsets_it)
+        : BaseIndexedIterator<IndexedIterator, NullableColumnValue<T>>{chunk_offsets_it},
+          _values{values},
+          _null_values{null_values},
+          _end_positions{end_positions} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    NullableColumnValue<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+
+      if (chunk_offsets.into_referenced == INVALID_CHUNK_OFFSET)
+        return NullableColumnValue<T>{T{}, true, chunk_offsets.into_referencing};
+
+      const auto end_position_it =
+          std::lower_bound(_end_positions.cbegin(), _end_positions.cend(), chunk_offsets.into_referenced);
+      const auto run_index = static_cast<size_t>(std::distance(_end_positions.cbegin(), end_position_it));
+
+      return NullableColumnValue<T>{_values[run_index], _null_values[run_index], chunk_offsets.into_referencing};
+    }
+
+   private:
+    const ValueVector& _values;
+    const NullValueVector& _null_values;
+    const EndPositionVector& _end_positions;
+  };
+};
+
+}  // namespace opossum
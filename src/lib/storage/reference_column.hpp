@@ -9,6 +9,8 @@
 
 #include "base_column.hpp"
 #include "dictionary_column.hpp"
+#include "frame_of_reference_column.hpp"
+#include "run_length_column.hpp"
 #include "table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -63,7 +65,27 @@ class ReferenceColumn : public BaseColumn {
         continue;
       }
 
-      Fail("column is no dictionary or value column");
+      if (auto run_length_column = std::dynamic_pointer_cast<const RunLengthColumn<T>>(column)) {
+        if (run_length_column->is_null(row.chunk_offset)) {
+          values.push_back(std::nullopt);
+        } else {
+          values.push_back(run_length_column->get(row.chunk_offset));
+        }
+        continue;
+      }
+
+      if constexpr (supports_frame_of_reference_encoding_v<T>) {
+        if (auto frame_of_reference_column = std::dynamic_pointer_cast<const FrameOfReferenceColumn<T>>(column)) {
+          if (frame_of_reference_column->is_null(row.chunk_offset)) {
+            values.push_back(std::nullopt);
+          } else {
+            values.push_back(frame_of_reference_column->get(row.chunk_offset));
+          }
+          continue;
+        }
+      }
+
+      Fail("column is no dictionary, run-length, frame-of-reference, or value column");
     }
 
     return values;
@@ -0,0 +1,157 @@
+#include "run_length_column.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "column_visitable.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthColumn<T>::RunLengthColumn(const std::shared_ptr<const pmr_vector<T>>& values,
+                                    const std::shared_ptr<const pmr_vector<bool>>& null_values,
+                                    const std::shared_ptr<const pmr_vector<ChunkOffset>>& end_positions)
+    : _values(values), _null_values(null_values), _end_positions(end_positions) {
+  DebugAssert(_values->size() == _null_values->size() && _values->size() == _end_positions->size(),
+              "Number of values, null values, and end positions must match.");
+}
+
+template <typename T>
+const AllTypeVariant RunLengthColumn<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
+
+  const auto run_index = this->run_index(chunk_offset);
+
+  if ((*_null_values)[run_index]) {
+    return NULL_VALUE;
+  }
+
+  return (*_values)[run_index];
+}
+
+template <typename T>
+bool RunLengthColumn<T>::is_null(const ChunkOffset chunk_offset) const {
+  return (*_null_values)[run_index(chunk_offset)];
+}
+
+template <typename T>
+const T RunLengthColumn<T>::get(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
+
+  const auto run_index = this->run_index(chunk_offset);
+
+  DebugAssert(!(*_null_values)[run_index], "Value at index " + std::to_string(chunk_offset) + " is null.");
+
+  return (*_values)[run_index];
+}
+
+template <typename T>
+void RunLengthColumn<T>::append(const AllTypeVariant&) {
+  Fail("RunLengthColumn is immutable");
+}
+
+template <typename T>
+const std::shared_ptr<const pmr_vector<T>>& RunLengthColumn<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+const std::shared_ptr<const pmr_vector<bool>>& RunLengthColumn<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+const std::shared_ptr<const pmr_vector<ChunkOffset>>& RunLengthColumn<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+const pmr_concurrent_vector<std::optional<T>> RunLengthColumn<T>::materialize_values() const {
+  pmr_concurrent_vector<std::optional<T>> values(size(), std::nullopt, _values->get_allocator());
+
+  auto chunk_offset = ChunkOffset{0u};
+  for (auto run_index = size_t{0u}; run_index < _end_positions->size(); ++run_index) {
+    const auto end_position = (*_end_positions)[run_index];
+
+    if ((*_null_values)[run_index]) {
+      chunk_offset = end_position + 1u;
+      continue;
+    }
+
+    const auto& value = (*_values)[run_index];
+    for (; chunk_offset <= end_position; ++chunk_offset) {
+      values[chunk_offset] = value;
+    }
+  }
+
+  return values;
+}
+
+template <typename T>
+size_t RunLengthColumn<T>::size() const {
+  if (_end_positions->empty()) return 0u;
+  return _end_positions->back() + 1u;
+}
+
+template <typename T>
+void RunLengthColumn<T>::visit(ColumnVisitable& visitable, std::shared_ptr<ColumnVisitableContext> context) const {
+  visitable.handle_run_length_column(*this, std::move(context));
+}
+
+template <typename T>
+void RunLengthColumn<T>::write_string_representation(std::string& row_string, const ChunkOffset chunk_offset) const {
+  std::stringstream buffer;
+  // buffering value at chunk_offset
+  const auto run_index = this->run_index(chunk_offset);
+  Assert(!(*_null_values)[run_index], "This operation does not support NULL values.");
+
+  buffer << (*_values)[run_index];
+  uint32_t length = buffer.str().length();
+  // writing byte representation of length
+  buffer.write(reinterpret_cast<const char*>(&length), sizeof(length));
+
+  // appending the new string to the already present string
+  row_string += buffer.str();
+}
+
+template <typename T>
+void RunLengthColumn<T>::copy_value_to_value_column(BaseColumn& value_column, ChunkOffset chunk_offset) const {
+  auto& output_column = static_cast<ValueColumn<T>&>(value_column);
+  auto& values_out = output_column.values();
+
+  const auto run_index = this->run_index(chunk_offset);
+  const auto is_null = (*_null_values)[run_index];
+
+  if (output_column.is_nullable()) {
+    output_column.null_values().push_back(is_null);
+    values_out.push_back(is_null ? T{} : (*_values)[run_index]);
+  } else {
+    DebugAssert(!is_null, "Target column needs to be nullable");
+
+    values_out.push_back((*_values)[run_index]);
+  }
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> RunLengthColumn<T>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  pmr_vector<T> new_values(*_values, alloc);
+  pmr_vector<bool> new_null_values(*_null_values, alloc);
+  pmr_vector<ChunkOffset> new_end_positions(*_end_positions, alloc);
+
+  return std::allocate_shared<RunLengthColumn<T>>(
+      alloc, std::allocate_shared<pmr_vector<T>>(alloc, std::move(new_values)),
+      std::allocate_shared<pmr_vector<bool>>(alloc, std::move(new_null_values)),
+      std::allocate_shared<pmr_vector<ChunkOffset>>(alloc, std::move(new_end_positions)));
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthColumn);
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_run_length_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Column that stores consecutive equal values only once
+ *
+ * Each run is represented by its value, whether it is null, and the chunk offset of its last row.
+ * Sorted or low-cardinality data (e.g., dates or status flags) compresses well this way, and
+ * operators can evaluate predicates once per run instead of once per row.
+ * See run_length_encoding.cpp for how the column is built from a ValueColumn.
+ */
+template <typename T>
+class RunLengthColumn : public BaseRunLengthColumn {
+ public:
+  explicit RunLengthColumn(const std::shared_ptr<const pmr_vector<T>>& values,
+                           const std::shared_ptr<const pmr_vector<bool>>& null_values,
+                           const std::shared_ptr<const pmr_vector<ChunkOffset>>& end_positions);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns whether a value is NULL
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // return the value at a certain position.
+  // Only use if you are certain that no null values are present, otherwise an Assert fails.
+  const T get(const ChunkOffset chunk_offset) const;
+
+  // run-length encoded columns are immutable
+  void append(const AllTypeVariant&) override;
+
+  // returns the value of each run
+  const std::shared_ptr<const pmr_vector<T>>& values() const;
+
+  const std::shared_ptr<const pmr_vector<bool>>& null_values() const final;
+
+  const std::shared_ptr<const pmr_vector<ChunkOffset>>& end_positions() const final;
+
+  using BaseRunLengthColumn::run_index;
+
+  // returns the index of the run that contains the chunk offset
+  size_t run_index(const ChunkOffset chunk_offset) const { return run_index(*_end_positions, chunk_offset); }
+
+  // return a generated vector of all values (or nulls)
+  const pmr_concurrent_vector<std::optional<T>> materialize_values() const;
+
+  // return the number of entries
+  size_t size() const override;
+
+  // visitor pattern, see base_column.hpp
+  void visit(ColumnVisitable& visitable, std::shared_ptr<ColumnVisitableContext> context = nullptr) const override;
+
+  // writes the length and value at the chunk_offset to the end off row_string
+  void write_string_representation(std::string& row_string, const ChunkOffset chunk_offset) const override;
+
+  // copies one of its own values to a different ValueColumn - mainly used for materialization
+  void copy_value_to_value_column(BaseColumn& value_column, ChunkOffset chunk_offset) const override;
+
+  // Copies a RunLengthColumn using a new allocator. This is useful for placing it on a new NUMA node.
+  std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const override;
+
+ protected:
+  const std::shared_ptr<const pmr_vector<T>> _values;
+  const std::shared_ptr<const pmr_vector<bool>> _null_values;
+  const std::shared_ptr<const pmr_vector<ChunkOffset>> _end_positions;
+};
+
+}  // namespace opossum
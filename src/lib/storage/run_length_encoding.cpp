@@ -0,0 +1,88 @@
+#include "run_length_encoding.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "chunk.hpp"
+#include "resolve_type.hpp"
+#include "run_length_column.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+class RunLengthEncoderBase {
+ public:
+  virtual ~RunLengthEncoderBase() = default;
+  virtual std::shared_ptr<BaseColumn> encode_column(const std::shared_ptr<BaseColumn>& column) = 0;
+};
+
+template <typename T>
+class RunLengthEncoder : public RunLengthEncoderBase {
+ public:
+  std::shared_ptr<BaseColumn> encode_column(const std::shared_ptr<BaseColumn>& column) override {
+    auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column);
+
+    Assert(value_column != nullptr, "Column is either already encoded or type mismatches.");
+
+    const auto& values = value_column->values();
+
+    auto run_values = std::make_shared<pmr_vector<T>>();
+    auto run_null_values = std::make_shared<pmr_vector<bool>>();
+    auto run_end_positions = std::make_shared<pmr_vector<ChunkOffset>>();
+
+    /**
+     * Iterators are used because values and null_values are of
+     * type tbb::concurrent_vector and thus index-based access isn’t in O(1)
+     */
+    auto value_it = values.cbegin();
+    auto null_value_it = value_column->is_nullable() ? value_column->null_values().cbegin()
+                                                     : pmr_concurrent_vector<bool>::const_iterator{};
+    auto chunk_offset = ChunkOffset{0u};
+
+    for (; value_it != values.cend(); ++value_it, ++chunk_offset) {
+      const auto is_null = value_column->is_nullable() && *null_value_it++;
+
+      // Nulls only need to match the previous run’s null flag, their values are meaningless
+      const auto continues_run =
+          !run_values->empty() && run_null_values->back() == is_null && (is_null || run_values->back() == *value_it);
+
+      if (continues_run) {
+        run_end_positions->back() = chunk_offset;
+        continue;
+      }
+
+      run_values->push_back(is_null ? T{} : *value_it);
+      run_null_values->push_back(is_null);
+      run_end_positions->push_back(chunk_offset);
+    }
+
+    run_values->shrink_to_fit();
+    run_null_values->shrink_to_fit();
+    run_end_positions->shrink_to_fit();
+
+    return std::make_shared<RunLengthColumn<T>>(run_values, run_null_values, run_end_positions);
+  }
+};
+
+std::shared_ptr<BaseColumn> RunLengthEncoding::encode_column(DataType data_type,
+                                                             const std::shared_ptr<BaseColumn>& column) {
+  auto encoder = make_shared_by_data_type<RunLengthEncoderBase, RunLengthEncoder>(data_type);
+  return encoder->encode_column(column);
+}
+
+void RunLengthEncoding::encode_chunk(const std::vector<DataType>& column_types, Chunk& chunk,
+                                     const std::vector<ColumnID>& column_ids) {
+  DebugAssert((column_types.size() == chunk.column_count()),
+              "Number of column types does not match the chunk’s column count.");
+
+  for (const auto column_id : column_ids) {
+    auto value_column = chunk.get_mutable_column(column_id);
+    auto run_length_column = encode_column(column_types[column_id], value_column);
+    chunk.replace_column(column_id, run_length_column);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Chunk;
+
+class RunLengthEncoding {
+ public:
+  /**
+   * @brief Encodes a column
+   *
+   * Consecutive equal values (and consecutive nulls) are combined into runs.
+   * Unlike DictionaryColumns, RunLengthColumns cannot be indexed, so this encoding is opt-in
+   * and should be used for sorted or low-cardinality columns only.
+   *
+   * @param data_type enum value of the column’s type
+   * @param column needs to be of type ValueColumn<T>
+   * @return an encoded column of type RunLengthColumn<T>
+   */
+  static std::shared_ptr<BaseColumn> encode_column(DataType data_type, const std::shared_ptr<BaseColumn>& column);
+
+  /**
+   * @brief Encodes the given columns of a chunk
+   *
+   * This is potentially unsafe if another operation modifies the table at the same time.
+   * All columns in column_ids need to be of type ValueColumn<T>. The chunk’s mvcc columns are not touched.
+   *
+   * @param column_types from the chunk’s table
+   * @param chunk to be encoded
+   * @param column_ids of the columns to be encoded
+   */
+  static void encode_chunk(const std::vector<DataType>& column_types, Chunk& chunk,
+                           const std::vector<ColumnID>& column_ids);
+};
+
+}  // namespace opossum
@@ -0,0 +1,80 @@
+#include "string_dictionary.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+StringDictionary::StringDictionary(const PolymorphicAllocator<char>& alloc) : _characters(alloc), _offsets(1u, alloc) {}
+
+StringDictionary::StringDictionary(const pmr_vector<std::string>& values)
+    : _characters(values.get_allocator()), _offsets(values.get_allocator()) {
+  auto total_length = size_t{0u};
+  for (const auto& value : values) {
+    total_length += value.size();
+  }
+
+  Assert(total_length <= std::numeric_limits<uint32_t>::max(), "Dictionary strings exceed 4 GB.");
+
+  _characters.reserve(total_length);
+  _offsets.reserve(values.size() + 1u);
+
+  for (const auto& value : values) {
+    _offsets.push_back(static_cast<uint32_t>(_characters.size()));
+    _characters.insert(_characters.end(), value.cbegin(), value.cend());
+  }
+  _offsets.push_back(static_cast<uint32_t>(_characters.size()));
+}
+
+StringDictionary::StringDictionary(pmr_vector<char>&& characters, pmr_vector<uint32_t>&& offsets)
+    : _characters(std::move(characters)), _offsets(std::move(offsets)) {
+  DebugAssert(!_offsets.empty() && _offsets.back() == _characters.size(), "Offsets do not match the characters.");
+}
+
+StringDictionary::StringDictionary(const StringDictionary& other, const PolymorphicAllocator<char>& alloc)
+    : _characters(other._characters, alloc), _offsets(other._offsets, alloc) {}
+
+std::string StringDictionary::at(const size_t index) const {
+  Assert(index < size(), "Index " + std::to_string(index) + " is out of range.");
+  return (*this)[index];
+}
+
+size_t StringDictionary::lower_bound(const std::string_view value) const {
+  auto first = size_t{0u};
+  auto count = size();
+
+  while (count > 0u) {
+    const auto step = count / 2u;
+    if (view(first + step) < value) {
+      first += step + 1u;
+      count -= step + 1u;
+    } else {
+      count = step;
+    }
+  }
+
+  return first;
+}
+
+size_t StringDictionary::upper_bound(const std::string_view value) const {
+  auto first = size_t{0u};
+  auto count = size();
+
+  while (count > 0u) {
+    const auto step = count / 2u;
+    if (!(value < view(first + step))) {
+      first += step + 1u;
+      count -= step + 1u;
+    } else {
+      count = step;
+    }
+  }
+
+  return first;
+}
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Sorted set of strings stored in one contiguous character buffer
+ *
+ * Used as the dictionary of DictionaryColumn<std::string>. Compared to a pmr_vector<std::string>, it avoids one
+ * allocation and the std::string overhead (32 bytes) per distinct value. The i-th string is stored in
+ * characters()[offsets()[i], offsets()[i + 1]), so offsets() has size() + 1 entries.
+ *
+ * The interface resembles a const pmr_vector<std::string>. Since the strings are not stored as std::string,
+ * operator[] returns them by value. Use view() to access them without copying.
+ */
+class StringDictionary {
+ public:
+  using value_type = std::string;
+
+  explicit StringDictionary(const PolymorphicAllocator<char>& alloc = {});
+
+  // Creates a StringDictionary from sorted and unique values
+  explicit StringDictionary(const pmr_vector<std::string>& values);
+
+  // Creates a StringDictionary from a character buffer and size() + 1 offsets into it
+  StringDictionary(pmr_vector<char>&& characters, pmr_vector<uint32_t>&& offsets);
+
+  // Copies a StringDictionary using a new allocator
+  StringDictionary(const StringDictionary& other, const PolymorphicAllocator<char>& alloc);
+
+  std::string operator[](const size_t index) const { return std::string{view(index)}; }
+
+  // same as operator[], but checks the index
+  std::string at(const size_t index) const;
+
+  std::string_view view(const size_t index) const {
+    return std::string_view{_characters.data() + _offsets[index], _offsets[index + 1] - _offsets[index]};
+  }
+
+  // returns the index of the first string >= value, size() if there is none
+  size_t lower_bound(const std::string_view value) const;
+
+  // returns the index of the first string > value, size() if there is none
+  size_t upper_bound(const std::string_view value) const;
+
+  size_t size() const { return _offsets.size() - 1u; }
+  bool empty() const { return size() == 0u; }
+
+  // returns the concatenation of all strings
+  const pmr_vector<char>& characters() const { return _characters; }
+
+  // returns the begin of each string in characters(), followed by the end of the last string
+  const pmr_vector<uint32_t>& offsets() const { return _offsets; }
+
+  PolymorphicAllocator<char> get_allocator() const { return _characters.get_allocator(); }
+
+ protected:
+  pmr_vector<char> _characters;
+  pmr_vector<uint32_t> _offsets;
+};
+
+}  // namespace opossum
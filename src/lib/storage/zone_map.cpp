@@ -0,0 +1,141 @@
+#include "zone_map.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "resolve_type.hpp"
+#include "storage/base_attribute_vector.hpp"
+#include "storage/iterables/create_iterable_from_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+ZoneMap<T>::ZoneMap(const std::optional<T>& minimum, const std::optional<T>& maximum, const bool has_nulls,
+                    std::shared_ptr<const BloomFilter<T>> bloom_filter)
+    : _minimum(minimum), _maximum(maximum), _has_nulls(has_nulls), _bloom_filter(std::move(bloom_filter)) {
+  DebugAssert(_minimum.has_value() == _maximum.has_value(), "Either both or none of minimum and maximum must be set.");
+}
+
+template <typename T>
+bool ZoneMap<T>::can_prune(const ScanType scan_type, const AllTypeVariant& value,
+                           const std::optional<AllTypeVariant>& value2) const {
+  if (variant_is_null(value)) {
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        return !_has_nulls;
+      case ScanType::OpNotEquals:
+        return !_minimum;
+      default:
+        return false;
+    }
+  }
+
+  // Null values never satisfy a comparison
+  if (!_minimum) return true;
+
+  const auto& minimum = *_minimum;
+  const auto& maximum = *_maximum;
+  const auto typed_value = type_cast<T>(value);
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return typed_value < minimum || typed_value > maximum ||
+             (_bloom_filter && !_bloom_filter->contains(typed_value));
+    case ScanType::OpNotEquals:
+      return minimum == typed_value && maximum == typed_value;
+    case ScanType::OpLessThan:
+      return !(minimum < typed_value);
+    case ScanType::OpLessThanEquals:
+      return minimum > typed_value;
+    case ScanType::OpGreaterThan:
+      return !(maximum > typed_value);
+    case ScanType::OpGreaterThanEquals:
+      return maximum < typed_value;
+    case ScanType::OpBetween:
+      DebugAssert(value2.has_value(), "OpBetween requires an upper bound.");
+      return maximum < typed_value || minimum > type_cast<T>(*value2);
+    default:
+      return false;
+  }
+}
+
+template <typename T>
+const std::optional<T>& ZoneMap<T>::minimum() const {
+  return _minimum;
+}
+
+template <typename T>
+const std::optional<T>& ZoneMap<T>::maximum() const {
+  return _maximum;
+}
+
+template <typename T>
+bool ZoneMap<T>::has_nulls() const {
+  return _has_nulls;
+}
+
+template <typename T>
+std::shared_ptr<const BloomFilter<T>> ZoneMap<T>::bloom_filter() const {
+  return _bloom_filter;
+}
+
+std::shared_ptr<BaseZoneMap> create_zone_map(DataType data_type, const BaseColumn& column) {
+  auto zone_map = std::shared_ptr<BaseZoneMap>{};
+
+  resolve_data_and_column_type(data_type, column, [&](auto type, auto& typed_column) {
+    using ColumnDataType = typename decltype(type)::type;
+    using ColumnType = std::decay_t<decltype(typed_column)>;
+
+    auto minimum = std::optional<ColumnDataType>{};
+    auto maximum = std::optional<ColumnDataType>{};
+    auto has_nulls = false;
+
+    if constexpr (std::is_same_v<ColumnType, DictionaryColumn<ColumnDataType>>) {
+      // The dictionary is sorted, so only the attribute vector has to be scanned for nulls
+      const auto& dictionary = *typed_column.dictionary();
+      const auto& attribute_vector = *typed_column.attribute_vector();
+
+      for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < attribute_vector.size() && !has_nulls; ++chunk_offset) {
+        has_nulls = attribute_vector.get(chunk_offset) == NULL_VALUE_ID;
+      }
+
+      if (dictionary.empty()) {
+        zone_map = std::make_shared<ZoneMap<ColumnDataType>>(minimum, maximum, has_nulls);
+        return;
+      }
+
+      auto bloom_filter = std::make_shared<BloomFilter<ColumnDataType>>(dictionary.size());
+      for (auto value_id = size_t{0u}; value_id < dictionary.size(); ++value_id) {
+        bloom_filter->insert(dictionary[value_id]);
+      }
+
+      zone_map = std::make_shared<ZoneMap<ColumnDataType>>(dictionary[0u], dictionary[dictionary.size() - 1u],
+                                                           has_nulls, bloom_filter);
+    } else {
+      auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+      iterable.for_each([&](const auto& column_value) {
+        if (column_value.is_null()) {
+          has_nulls = true;
+          return;
+        }
+
+        const auto& value = column_value.value();
+        if (!minimum || value < *minimum) minimum = value;
+        if (!maximum || value > *maximum) maximum = value;
+      });
+
+      zone_map = std::make_shared<ZoneMap<ColumnDataType>>(minimum, maximum, has_nulls);
+    }
+  });
+
+  return zone_map;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ZoneMap);
+
+}  // namespace opossum
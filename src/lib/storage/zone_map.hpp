@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+#include "utils/bloom_filter.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+/**
+ * @brief Lightweight statistics of a column that allow operators to skip whole chunks
+ *
+ * A zone map stores the minimum and the maximum of a column and whether it contains nulls. Zone maps of
+ * dictionary columns also contain a bloom filter over the dictionary, so that equality predicates on values
+ * between the minimum and the maximum can be pruned as well.
+ *
+ * Zone maps are built by DictionaryCompression::compress_chunk (see Chunk::zone_maps()).
+ */
+class BaseZoneMap {
+ public:
+  virtual ~BaseZoneMap() = default;
+
+  /**
+   * Returns true if no row of the column satisfies `column scan_type value`. If true is returned, scanning
+   * the column would yield no results, otherwise it may or may not yield results.
+   * As in TableScan, a null value stands for IS NULL (OpEquals) and IS NOT NULL (OpNotEquals).
+   * OpBetween expects the upper bound in value2.
+   */
+  virtual bool can_prune(const ScanType scan_type, const AllTypeVariant& value,
+                         const std::optional<AllTypeVariant>& value2 = std::nullopt) const = 0;
+};
+
+template <typename T>
+class ZoneMap : public BaseZoneMap {
+ public:
+  // minimum and maximum are std::nullopt if the column only contains nulls
+  ZoneMap(const std::optional<T>& minimum, const std::optional<T>& maximum, const bool has_nulls,
+          std::shared_ptr<const BloomFilter<T>> bloom_filter = nullptr);
+
+  bool can_prune(const ScanType scan_type, const AllTypeVariant& value,
+                 const std::optional<AllTypeVariant>& value2 = std::nullopt) const final;
+
+  const std::optional<T>& minimum() const;
+  const std::optional<T>& maximum() const;
+  bool has_nulls() const;
+
+  // nullptr if the column was not dictionary-encoded
+  std::shared_ptr<const BloomFilter<T>> bloom_filter() const;
+
+ protected:
+  const std::optional<T> _minimum;
+  const std::optional<T> _maximum;
+  const bool _has_nulls;
+  const std::shared_ptr<const BloomFilter<T>> _bloom_filter;
+};
+
+// Builds a zone map over all values of a column of any type
+std::shared_ptr<BaseZoneMap> create_zone_map(DataType data_type, const BaseColumn& column);
+
+}  // namespace opossum
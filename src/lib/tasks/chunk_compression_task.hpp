@@ -13,12 +13,13 @@ class Chunk;
  * @brief Compresses a chunk of a table
  *
  * The task compresses a chunk by sequentially compressing columns.
- * From each value column, a dictionary column is created that replaces the
- * uncompressed column. The exchange is done atomically. Since this can
- * happen during simultaneous access by transactions, operators need to be
- * designed such that they are aware that column types might change from
- * ValueColumn<T> to DictionaryColumn<T> during execution. Shared pointers
- * ensure that existing value columns remain valid.
+ * From each value column, a dictionary column (or, for suitable integer columns,
+ * a frame-of-reference column) is created that replaces the uncompressed column.
+ * The exchange is done atomically. Since this can happen during simultaneous
+ * access by transactions, operators need to be designed such that they are aware
+ * that column types might change from ValueColumn<T> to DictionaryColumn<T> or
+ * FrameOfReferenceColumn<T> during execution. Shared pointers ensure that
+ * existing value columns remain valid.
  *
  * Exchanging columns does not interfere with the Delete operator because
  * it does not touch the columns. However, inserting records while simultaneously
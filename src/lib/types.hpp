@@ -133,8 +133,9 @@ const RowID NULL_ROW_ID = RowID{ChunkID{0u}, INVALID_CHUNK_OFFSET};  // TODO(any
 // ... in DictionaryColumns
 constexpr ValueID NULL_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
-// The Scheduler currently supports just these 2 priorities, subject to change.
+// Tasks are pulled in the order of these values. Low is meant for long-running queries (see QueryGroup).
 enum class SchedulePriority {
+  Low = 3,          // Schedule task behind all others
   Unstealable = 2,  // Schedule task at the end of the queue with disabled workstealing
   Normal = 1,       // Schedule task at the end of the queue
   High = 0          // Schedule task at the beginning of the queue
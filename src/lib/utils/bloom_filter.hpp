@@ -0,0 +1,65 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "murmur_hash.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/*
+Insert-only bloom filter. contains() never returns false for an inserted value, but may return true for values that
+were never inserted. With the default of 8 bits per value and three hash functions, about 3% of the lookups of
+absent values are false positives.
+
+The bit positions are derived from a single 32 bit hash by double hashing. Callers that already hashed a value (e.g.,
+for radix partitioning) can pass that hash to insert_hash() and contains_hash() instead of hashing it again.
+*/
+template <typename T>
+class BloomFilter {
+  static const unsigned int NUMBER_OF_HASH_FUNCTIONS = 3;
+
+ public:
+  explicit BloomFilter(size_t value_count, size_t bits_per_value = 8u)
+      : _bits(std::max(value_count * bits_per_value, size_t{64u}), false) {}
+
+  void insert(const T& value) { insert_hash(_hash(value)); }
+
+  bool contains(const T& value) const { return contains_hash(_hash(value)); }
+
+  void insert_hash(const uint32_t hash) {
+    for (auto i = 0u; i < NUMBER_OF_HASH_FUNCTIONS; ++i) {
+      _bits[_position(hash, i)] = true;
+    }
+  }
+
+  bool contains_hash(const uint32_t hash) const {
+    for (auto i = 0u; i < NUMBER_OF_HASH_FUNCTIONS; ++i) {
+      if (!_bits[_position(hash, i)]) return false;
+    }
+    return true;
+  }
+
+ private:
+  static uint32_t _hash(const T& value) {
+    if constexpr (std::is_floating_point_v<T>) {
+      // -0.0 and 0.0 are equal, but differ in their bits
+      return murmur2<T>(value == T{0} ? T{0} : value, 0u);
+    } else {
+      return murmur2<T>(value, 0u);
+    }
+  }
+
+  size_t _position(const uint32_t hash, const unsigned int i) const {
+    // The second hash is the first one rotated by 16 bits, so that both depend on all bits of the value
+    const auto second_hash = (hash >> 16u) | (hash << 16u);
+    return (size_t{hash} + size_t{i} * second_hash) % _bits.size();
+  }
+
+  std::vector<bool> _bits;
+};
+
+}  // namespace opossum
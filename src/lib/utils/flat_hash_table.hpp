@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "type_comparison.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/*
+Insert-only hash table with open addressing and linear probing. It is currently only used for HashJoins, where one
+table is built per radix partition and probed afterwards. There is no need to delete elements in that use case.
+
+All slots are stored in one contiguous vector. Each slot holds its value, its hash and the first RowID inline, so that
+a lookup of a unique value (e.g., a primary key) touches a single cache line. Values are only compared if the hashes
+match, so that probing the slots of other values does not compare, e.g., the characters of strings. Further RowIDs of the same value are collected
+during the build and grouped by value in one contiguous overflow vector by finalize().
+
+The caller passes the hash of each value, so that the hashes computed for the radix partitioning can be reused. Equal
+values need to have equal hashes. The slot is chosen by the low bits of the hash, because the high bits already
+determined the radix partition and are therefore the same for all values in the table.
+*/
+template <typename T>
+class FlatHashTable : private Noncopyable {
+ public:
+  // The table does not grow, so value_count needs to be an upper bound for the number of put() calls
+  explicit FlatHashTable(const size_t value_count) {
+    const auto capacity = _capacity(value_count);
+    _slots.resize(capacity);
+    _mask = capacity - 1u;
+  }
+
+  // Returns the size of the slots of a table for value_count values, i.e., without the overflow of duplicate values
+  static size_t estimate_memory_usage(const size_t value_count) { return _capacity(value_count) * sizeof(Slot); }
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  FlatHashTable(FlatHashTable&&) = default;
+  FlatHashTable& operator=(FlatHashTable&&) = default;
+
+  /*
+  Insert a new element into the hash table. Must not be called after finalize().
+  */
+  void put(const T& value, const uint32_t hash, const RowID row_id) {
+    DebugAssert(!_finalized, "Cannot insert into a finalized hash table.");
+
+    for (auto slot_id = hash & _mask;; slot_id = (slot_id + 1u) & _mask) {
+      auto& slot = _slots[slot_id];
+
+      if (slot.row_count == 0u) {
+        slot.value = value;
+        slot.hash = hash;
+        slot.first_row_id = row_id;
+        slot.row_count = 1u;
+        return;
+      }
+
+      if (slot.hash == hash && slot.value == value) {
+        _unsorted_overflow.emplace_back(static_cast<uint32_t>(slot_id), row_id);
+        ++slot.row_count;
+        return;
+      }
+    }
+  }
+
+  /*
+  Groups the RowIDs of values that were inserted more than once. Has to be called after the last put() and before
+  the first lookup.
+  */
+  void finalize() {
+    // Let each slot point behind its range in the overflow vector...
+    auto overflow_end = uint32_t{0u};
+    for (auto& slot : _slots) {
+      if (slot.row_count < 2u) continue;
+      overflow_end += slot.row_count - 1u;
+      slot.overflow_begin = overflow_end;
+    }
+
+    // ...and fill the ranges back to front, so that the RowIDs keep their insertion order
+    _overflow.resize(_unsorted_overflow.size());
+    for (auto it = _unsorted_overflow.crbegin(); it != _unsorted_overflow.crend(); ++it) {
+      _overflow[--_slots[it->first].overflow_begin] = it->second;
+    }
+
+    _unsorted_overflow = {};
+    _finalized = true;
+  }
+
+  /*
+  Calls functor(row_id) for all RowIDs that were inserted with a value equal to `value` and returns their number.
+  */
+  template <typename S, typename Functor>
+  size_t for_each_row_id(const S& value, const uint32_t hash, const Functor& functor) const {
+    const auto* slot = _find(value, hash);
+    if (!slot) return 0u;
+
+    functor(slot->first_row_id);
+
+    const auto overflow_begin = _overflow.cbegin() + slot->overflow_begin;
+    for (auto it = overflow_begin; it != overflow_begin + (slot->row_count - 1u); ++it) {
+      functor(*it);
+    }
+
+    return slot->row_count;
+  }
+
+  template <typename S>
+  bool contains(const S& value, const uint32_t hash) const {
+    return _find(value, hash) != nullptr;
+  }
+
+ protected:
+  /*
+  We use this struct internally for storing data. It should not be exposed to other classes.
+  A slot is empty if its row_count is 0.
+  */
+  struct Slot {
+    T value{};
+    RowID first_row_id{NULL_ROW_ID};
+    uint32_t hash{0u};
+    uint32_t row_count{0u};
+    uint32_t overflow_begin{0u};
+  };
+
+  static size_t _capacity(const size_t value_count) {
+    // Keep the load factor at or below 50% to keep the probe sequences short
+    auto capacity = size_t{8u};
+    while (capacity < value_count * 2u) capacity *= 2u;
+    return capacity;
+  }
+
+  template <typename S>
+  const Slot* _find(const S& value, const uint32_t hash) const {
+    DebugAssert(_finalized, "Hash table needs to be finalized before it is probed.");
+
+    for (auto slot_id = hash & _mask;; slot_id = (slot_id + 1u) & _mask) {
+      const auto& slot = _slots[slot_id];
+
+      if (slot.row_count == 0u) return nullptr;
+      if (slot.hash == hash && value_equal(slot.value, value)) return &slot;
+    }
+  }
+
+  std::vector<Slot> _slots;
+  size_t _mask;
+
+  std::vector<RowID> _overflow;
+  std::vector<std::pair<uint32_t, RowID>> _unsorted_overflow;
+  bool _finalized = false;
+};
+
+}  // namespace opossum
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/*
+Assigns dense ids to keys that consist of a fixed number of 64 bit words. It is used by the Aggregate, which packs the
+values of all group-by columns of a row into such a key, so that groups can be found without comparing variants.
+
+The table uses open addressing with linear probing and grows when it is half full. Each distinct key is stored once,
+in the order of the ids, so that the keys of the groups can be enumerated afterwards.
+*/
+class GroupKeyTable : private Noncopyable {
+ public:
+  explicit GroupKeyTable(const size_t key_width, const size_t expected_group_count = 0u) : _key_width(key_width) {
+    auto capacity = size_t{8u};
+    while (capacity < expected_group_count * 2u) capacity *= 2u;
+    _slots.resize(capacity, EMPTY_SLOT);
+  }
+
+  GroupKeyTable(GroupKeyTable&&) = default;
+  GroupKeyTable& operator=(GroupKeyTable&&) = default;
+
+  /*
+  Returns the id of the group with the given key, which has to be key_width() words long. A key that was not inserted
+  before gets the next free id, i.e., group_count() - 1 after the call.
+  */
+  uint32_t get_or_insert(const uint64_t* key) {
+    const auto hash = _hash(key);
+
+    for (auto slot_id = hash & (_slots.size() - 1u);; slot_id = (slot_id + 1u) & (_slots.size() - 1u)) {
+      const auto group_id = _slots[slot_id];
+
+      if (group_id == EMPTY_SLOT) {
+        const auto new_group_id = static_cast<uint32_t>(_hashes.size());
+        DebugAssert(new_group_id != EMPTY_SLOT, "Too many groups.");
+
+        _slots[slot_id] = new_group_id;
+        _hashes.push_back(hash);
+        _keys.insert(_keys.end(), key, key + _key_width);
+
+        if (_hashes.size() * 2u > _slots.size()) _grow();
+        return new_group_id;
+      }
+
+      if (_hashes[group_id] == hash && std::equal(key, key + _key_width, this->key(group_id))) return group_id;
+    }
+  }
+
+  size_t group_count() const { return _hashes.size(); }
+
+  size_t key_width() const { return _key_width; }
+
+  const uint64_t* key(const uint32_t group_id) const { return _keys.data() + size_t{group_id} * _key_width; }
+
+  // Adds a word to a hash of a key. The hash of a key is the combination of all its words, starting with 0.
+  static uint64_t combine_hash(const uint64_t hash, const uint64_t word) {
+    const auto combined_hash = (hash ^ word) * 0x9E3779B97F4A7C15ull;
+    return combined_hash ^ (combined_hash >> 32u);
+  }
+
+ protected:
+  static constexpr uint32_t EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+
+  uint64_t _hash(const uint64_t* key) const {
+    auto hash = uint64_t{0u};
+    for (auto word = key; word != key + _key_width; ++word) {
+      hash = combine_hash(hash, *word);
+    }
+    return hash;
+  }
+
+  void _grow() {
+    _slots.assign(_slots.size() * 2u, EMPTY_SLOT);
+
+    const auto mask = _slots.size() - 1u;
+    for (auto group_id = uint32_t{0u}; group_id < _hashes.size(); ++group_id) {
+      auto slot_id = _hashes[group_id] & mask;
+      while (_slots[slot_id] != EMPTY_SLOT) slot_id = (slot_id + 1u) & mask;
+      _slots[slot_id] = group_id;
+    }
+  }
+
+  size_t _key_width;
+
+  // Group ids, or EMPTY_SLOT
+  std::vector<uint32_t> _slots;
+
+  // Hash and key of each group, indexed by group id
+  std::vector<uint64_t> _hashes;
+  std::vector<uint64_t> _keys;
+};
+
+}  // namespace opossum
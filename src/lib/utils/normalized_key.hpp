@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace opossum {
+
+/*
+Helpers to encode values into normalized keys, i.e., byte strings that compare like the values when compared byte by
+byte with memcmp. Sort and TopK use them to compare rows by several columns at once.
+*/
+
+// Maps a value to an unsigned integer of the same width, so that the integers are in the same order as the values
+template <typename T>
+auto order_preserving_bits(const T value) {
+  if constexpr (std::is_integral_v<T>) {
+    using Bits = std::make_unsigned_t<T>;
+    return static_cast<Bits>(static_cast<Bits>(value) ^ (Bits{1u} << (sizeof(T) * 8u - 1u)));
+  } else {
+    static_assert(std::is_floating_point_v<T>, "Only numbers can be mapped to bits");
+    using Bits = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    constexpr auto sign_bit = Bits{1u} << (sizeof(T) * 8u - 1u);
+
+    // -0.0 and 0.0 are equal, so they need the same bits. Negative numbers are flipped completely, so that larger
+    // magnitudes become smaller.
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    auto bits = Bits{};
+    std::memcpy(&bits, &normalized_value, sizeof(T));
+    return static_cast<Bits>(bits & sign_bit ? ~bits : bits | sign_bit);
+  }
+}
+
+// Writes the bits big-endian, so that memcmp compares them like the integer. Inverting them reverses the order.
+template <typename Bits>
+void write_big_endian(uint8_t* target, Bits bits, const bool invert) {
+  if (invert) bits = static_cast<Bits>(~bits);
+
+  for (auto byte_index = sizeof(Bits); byte_index > 0u; --byte_index) {
+    target[byte_index - 1u] = static_cast<uint8_t>(bits);
+    bits = static_cast<Bits>(bits >> 8u);
+  }
+}
+
+/*
+Appends a value to a key of variable length. Numbers are appended as by write_big_endian. The zero bytes of strings are
+escaped as 0x00 0xFF and strings are terminated by 0x00 0x00, so that no encoded string is a prefix of another one.
+*/
+template <typename T>
+void append_normalized_value(std::string& key, const T& value, const bool invert) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto append_byte = [&](const uint8_t byte) {
+      key.push_back(static_cast<char>(invert ? static_cast<uint8_t>(~byte) : byte));
+    };
+
+    for (const auto character : value) {
+      append_byte(static_cast<uint8_t>(character));
+      if (character == '\0') append_byte(0xFFu);
+    }
+    append_byte(0u);
+    append_byte(0u);
+  } else {
+    const auto bits = order_preserving_bits(value);
+    const auto offset = key.size();
+    key.resize(offset + sizeof(bits));
+    write_big_endian(reinterpret_cast<uint8_t*>(&key[offset]), bits, invert);
+  }
+}
+
+}  // namespace opossum
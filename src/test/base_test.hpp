@@ -9,6 +9,7 @@
 #include "gtest/gtest.h"
 #include "operators/abstract_operator.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "storage/dictionary_column.hpp"
 #include "storage/dictionary_compression.hpp"
 #include "storage/numa_placement_manager.hpp"
@@ -69,6 +70,7 @@ class BaseTestWithParam : public std::conditional<std::is_same<ParamType, void>:
 
     StorageManager::reset();
     TransactionManager::reset();
+    MorselDispatcher::reset_default_morsel_size();
   }
 };
 
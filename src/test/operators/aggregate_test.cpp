@@ -17,7 +17,11 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/dictionary_compression.hpp"
+#include "storage/run_length_encoding.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -469,6 +473,20 @@ TEST_F(OperatorsAggregateTest, DictionarySingleAggregateCountWithNull) {
                     "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/count_null.tbl", 1, false);
 }
 
+TEST_F(OperatorsAggregateTest, SmallMorsels) {
+  // Morsels of three rows combine and split the chunks of two rows, so that parts of dictionary-encoded chunks are
+  // read through ReferenceColumns
+  MorselDispatcher::set_default_morsel_size(3u);
+
+  this->test_output(_table_wrapper_1_1_null_dict, {{ColumnID{1}, AggregateFunction::Avg}}, {ColumnID{0}},
+                    "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/avg_null.tbl", 1, false);
+  this->test_output(_table_wrapper_1_1_string_null, {{ColumnID{1}, AggregateFunction::Count}}, {ColumnID{0}},
+                    "src/test/tables/aggregateoperator/groupby_string_1gb_1agg/count_str_null.tbl", 1, false);
+  this->test_output(_table_wrapper_2_2, {{ColumnID{2}, AggregateFunction::Max}, {ColumnID{3}, AggregateFunction::Avg}},
+                    {ColumnID{0}, ColumnID{1}}, "src/test/tables/aggregateoperator/groupby_int_2gb_2agg/max_avg.tbl",
+                    1);
+}
+
 /**
  * Tests for ReferenceColumns
  */
@@ -533,4 +551,167 @@ TEST_F(OperatorsAggregateTest, OuterJoinThenAggregate) {
                     "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/outer_join.tbl", 1, false);
 }
 
+TEST_F(OperatorsAggregateTest, ManyGroupsInParallel) {
+  // Enough groups for the merge to be partitioned
+  auto table = std::make_shared<Table>(1000);
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::String);
+  table->add_column("c", DataType::Int);
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a", DataType::Int, true);
+  expected_result->add_column("b", DataType::String, true);
+  expected_result->add_column("SUM(c)", DataType::Long, true);
+  expected_result->add_column("COUNT(*)", DataType::Long);
+
+  for (auto i = 0; i < 30000; ++i) {
+    table->append({i % 5000, "s" + std::to_string(i / 5000 % 2), i});
+  }
+  for (auto i = 0; i < 10000; ++i) {
+    // Each group consists of the rows i, i + 10000, and i + 20000
+    expected_result->append({i % 5000, "s" + std::to_string(i / 5000 % 2), int64_t{3 * i + 30000}, int64_t{3}});
+  }
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper,
+      std::vector<AggregateDefinition>{{ColumnID{2}, AggregateFunction::Sum}, {CountStarID, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{0}, ColumnID{1}});
+  aggregate->execute();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_GT(aggregate->get_output()->chunk_count(), 1u);
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_result);
+}
+
+TEST_F(OperatorsAggregateTest, DictionaryGroupByAndCountDistinct) {
+  // The results on dictionary-encoded chunks are compared to those on uncompressed ones
+  const auto create_table = [] {
+    auto table = std::make_shared<Table>(3000);
+    table->add_column("a", DataType::Int, true);
+    table->add_column("b", DataType::String, true);
+    table->add_column("c", DataType::Int);
+    table->add_column("d", DataType::Int);
+
+    for (auto i = 0; i < 6000; ++i) {
+      const auto a = i % 7 == 0 ? NULL_VALUE : AllTypeVariant{i % 3};
+      const auto b = i % 11 == 0 ? NULL_VALUE : AllTypeVariant{"s" + std::to_string(i % 2)};
+      table->append({a, b, i % 40, i % 4000});
+    }
+    return table;
+  };
+
+  // d would otherwise be frame-of-reference encoded in the first chunk
+  auto compressed_table = create_table();
+  DictionaryCompression::compress_table(*compressed_table, EncodingSelection::DictionaryOnly);
+
+  const auto aggregate = [](const std::shared_ptr<Table>& table, const std::vector<AggregateDefinition>& aggregates,
+                            const std::vector<ColumnID>& groupby_column_ids) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    auto aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+    return aggregate->get_output();
+  };
+
+  // Few groups are numbered through a dense array, few distinct values are counted in bitmaps
+  const auto few_aggregates = std::vector<AggregateDefinition>{{ColumnID{2}, AggregateFunction::CountDistinct},
+                                                               {ColumnID{2}, AggregateFunction::Sum},
+                                                               {CountStarID, AggregateFunction::Count}};
+  const auto few_groupby_column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+  EXPECT_TABLE_EQ_UNORDERED(aggregate(compressed_table, few_aggregates, few_groupby_column_ids),
+                            aggregate(create_table(), few_aggregates, few_groupby_column_ids));
+
+  // Many groups with many distinct values are too large for a bitmap
+  const auto many_aggregates = std::vector<AggregateDefinition>{{ColumnID{3}, AggregateFunction::CountDistinct},
+                                                                {ColumnID{1}, AggregateFunction::CountDistinct}};
+  const auto many_groupby_column_ids = std::vector<ColumnID>{ColumnID{3}};
+  EXPECT_TABLE_EQ_UNORDERED(aggregate(compressed_table, many_aggregates, many_groupby_column_ids),
+                            aggregate(create_table(), many_aggregates, many_groupby_column_ids));
+}
+
+TEST_F(OperatorsAggregateTest, RunLengthEncodedColumns) {
+  // The results on run-length encoded chunks, which are aggregated run by run, are compared to those on uncompressed
+  // ones. Runs span several groups, and groups span several runs.
+  const auto create_table = [] {
+    auto table = std::make_shared<Table>(1000);
+    table->add_column("a", DataType::Int);
+    table->add_column("b", DataType::Int, true);
+    table->add_column("c", DataType::Double);
+
+    for (auto i = 0; i < 3000; ++i) {
+      const auto b = i / 70 % 5 == 0 ? NULL_VALUE : AllTypeVariant{i / 70};
+      table->append({i / 30 % 4, b, static_cast<double>(i / 45 % 3)});
+    }
+    return table;
+  };
+
+  auto encoded_table = create_table();
+  for (ChunkID chunk_id{0}; chunk_id < encoded_table->chunk_count(); ++chunk_id) {
+    RunLengthEncoding::encode_chunk(encoded_table->column_types(), encoded_table->get_chunk(chunk_id),
+                                    {ColumnID{1}, ColumnID{2}});
+  }
+
+  const auto aggregates = std::vector<AggregateDefinition>{
+      {ColumnID{1}, AggregateFunction::Sum},   {ColumnID{1}, AggregateFunction::Avg},
+      {ColumnID{1}, AggregateFunction::Count}, {ColumnID{1}, AggregateFunction::CountDistinct},
+      {ColumnID{2}, AggregateFunction::Min},   {ColumnID{2}, AggregateFunction::Max},
+      {ColumnID{2}, AggregateFunction::Sum}};
+
+  const auto aggregate = [&](const std::shared_ptr<Table>& table, const std::vector<ColumnID>& groupby_column_ids) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    auto aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+    return aggregate->get_output();
+  };
+
+  EXPECT_TABLE_EQ_UNORDERED(aggregate(encoded_table, {ColumnID{0}}), aggregate(create_table(), {ColumnID{0}}));
+  EXPECT_TABLE_EQ_UNORDERED(aggregate(encoded_table, {}), aggregate(create_table(), {}));
+
+  // Morsels that cover only parts of the chunks
+  MorselDispatcher::set_default_morsel_size(700u);
+  EXPECT_TABLE_EQ_UNORDERED(aggregate(encoded_table, {ColumnID{0}}), aggregate(create_table(), {ColumnID{0}}));
+}
+
+TEST_F(OperatorsAggregateTest, CountDistinctAcrossMorsels) {
+  // Each group has values in every morsel, some of which occur in several morsels and chunks. Half of the chunks are
+  // dictionary-encoded.
+  auto table = std::make_shared<Table>(500);
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::String);
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a", DataType::Int, true);
+  expected_result->add_column("COUNT(DISTINCT b)", DataType::Long);
+
+  for (auto i = 0; i < 4000; ++i) {
+    table->append({i % 3, "s" + std::to_string(i % 1500)});
+  }
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id += 2u) {
+    DictionaryCompression::compress_chunk(table->column_types(), table->get_chunk(chunk_id));
+  }
+
+  // As 3 divides 1500, group a contains the 500 numbers below 1500 that are congruent to a modulo 3
+  for (auto a = 0; a < 3; ++a) expected_result->append({a, int64_t{500}});
+
+  MorselDispatcher::set_default_morsel_size(300u);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper, std::vector<AggregateDefinition>{{ColumnID{1}, AggregateFunction::CountDistinct}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_result);
+}
+
 }  // namespace opossum
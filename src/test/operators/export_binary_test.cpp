@@ -10,9 +10,15 @@
 
 #include "import_export/binary.hpp"
 #include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/base_attribute_vector.hpp"
+#include "storage/base_dictionary_column.hpp"
 #include "storage/dictionary_compression.hpp"
+#include "storage/frame_of_reference_column.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/run_length_encoding.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 
@@ -218,6 +224,8 @@ TEST_F(OperatorsExportBinaryTest, AllTypesReferenceColumn) {
   auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
   table_wrapper->execute();
 
+  // Morsels of the input's chunk size, so that the scan result has the same chunks as the input
+  MorselDispatcher::set_default_morsel_size(2u);
   auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpNotEquals, 5);
   scan->execute();
 
@@ -318,4 +326,115 @@ TEST_F(OperatorsExportBinaryTest, AllTypesDictionaryNullValues) {
   EXPECT_TRUE(compare_files("src/test/binary/AllTypesDictionaryNullValues.bin", filename));
 }
 
+TEST_F(OperatorsExportBinaryTest, AllTypesRunLengthNullValues) {
+  const auto create_table = []() {
+    auto table = std::make_shared<opossum::Table>(4);
+    table->add_column("a", DataType::Int, true);
+    table->add_column("b", DataType::Float, true);
+    table->add_column("c", DataType::Long, true);
+    table->add_column("d", DataType::String, true);
+    table->add_column("e", DataType::Double, true);
+
+    table->append({opossum::NULL_VALUE, 1.1f, 100, "one", 1.11});
+    table->append({opossum::NULL_VALUE, 1.1f, 100, "one", 2.22});
+    table->append({3, opossum::NULL_VALUE, opossum::NULL_VALUE, "three", 2.22});
+    table->append({3, opossum::NULL_VALUE, 400, opossum::NULL_VALUE, 2.22});
+    table->append({5, 5.5f, 500, "five", opossum::NULL_VALUE});
+    table->append({5, 5.5f, 500, "five", 6.66});
+    return table;
+  };
+
+  auto table = create_table();
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    RunLengthEncoding::encode_chunk(table->column_types(), table->get_chunk(chunk_id),
+                                    {ColumnID{0}, ColumnID{1}, ColumnID{2}, ColumnID{3}, ColumnID{4}});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto ex = std::make_shared<opossum::ExportBinary>(table_wrapper, filename);
+  ex->execute();
+
+  EXPECT_TRUE(file_exists(filename));
+
+  // There is no reference file for run-length encoded columns, so we check that they survive a round trip
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+
+  const auto imported_table = importer->get_output();
+  EXPECT_TABLE_EQ_ORDERED(imported_table, create_table());
+  EXPECT_EQ(imported_table->chunk_count(), 2u);
+
+  const auto column = imported_table->get_chunk(ChunkID{0}).get_column(ColumnID{0});
+  const auto run_length_column = std::dynamic_pointer_cast<const RunLengthColumn<int>>(column);
+  ASSERT_NE(run_length_column, nullptr);
+  EXPECT_EQ(run_length_column->run_count(), 2u);
+}
+
+TEST_F(OperatorsExportBinaryTest, BitPackedDictionaryColumn) {
+  // More than 2^16 distinct values need 17 bits per ValueID, i.e., a bit-packed attribute vector with a width of 3
+  const auto create_table = []() {
+    auto table = std::make_shared<opossum::Table>();
+    table->add_column("a", DataType::Float);
+
+    for (auto i = 0; i < 70'000; ++i) {
+      table->append({static_cast<float>(i) / 2.0f});
+    }
+    return table;
+  };
+
+  auto table = create_table();
+  DictionaryCompression::compress_table(*table);
+
+  const auto dictionary_column =
+      std::dynamic_pointer_cast<const BaseDictionaryColumn>(table->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+  ASSERT_NE(dictionary_column, nullptr);
+  ASSERT_EQ(dictionary_column->attribute_vector()->width(), 3u);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto ex = std::make_shared<opossum::ExportBinary>(table_wrapper, filename);
+  ex->execute();
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(importer->get_output(), create_table());
+}
+
+TEST_F(OperatorsExportBinaryTest, FrameOfReferenceNullValues) {
+  const auto create_table = []() {
+    auto table = std::make_shared<opossum::Table>(3000);
+    table->add_column("a", DataType::Int, true);
+    table->add_column("b", DataType::Long);
+
+    for (auto i = 0; i < 5000; ++i) {
+      const auto a = (i % 7 == 0) ? AllTypeVariant{opossum::NULL_VALUE} : AllTypeVariant{-i * 3};
+      table->append({a, int64_t{10'000'000'000} + i});
+    }
+    return table;
+  };
+
+  auto table = create_table();
+  DictionaryCompression::compress_table(*table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto ex = std::make_shared<opossum::ExportBinary>(table_wrapper, filename);
+  ex->execute();
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+
+  const auto imported_table = importer->get_output();
+  EXPECT_TABLE_EQ_ORDERED(imported_table, create_table());
+
+  const auto& chunk = imported_table->get_chunk(ChunkID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<const FrameOfReferenceColumn<int>>(chunk.get_column(ColumnID{0})), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<const FrameOfReferenceColumn<int64_t>>(chunk.get_column(ColumnID{1})), nullptr);
+}
+
 }  // namespace opossum
@@ -28,7 +28,7 @@ class OperatorsIndexScanTest : public BaseTest {
     table->add_column("a", DataType::Int);
     table->add_column("b", DataType::Int);
     for (int i = 0; i <= 24; i += 2) table->append({i, 100 + i});
-    DictionaryCompression::compress_table(*table);
+    DictionaryCompression::compress_table(*table, EncodingSelection::DictionaryOnly);
 
     _chunk_ids = std::vector<ChunkID>(table->chunk_count());
     std::iota(_chunk_ids.begin(), _chunk_ids.end(), ChunkID{0u});
@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "constant_mappings.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/dictionary_compression.hpp"
+#include "storage/run_length_encoding.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/*
+Tests JoinHash with different numbers of radix bits. The general join behaviour is covered by the typed join tests,
+whose small inputs are not partitioned at all.
+*/
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table_left = std::make_shared<Table>(300);
+    table_left->add_column("a", DataType::Int);
+    for (auto i = 0; i < 2000; ++i) {
+      table_left->append({i % 700});
+      ++_left_value_counts[i % 700];
+    }
+    DictionaryCompression::compress_chunks(*table_left, {ChunkID{1}, ChunkID{3}});
+
+    auto table_right = std::make_shared<Table>(400);
+    table_right->add_column("b", DataType::Int);
+    for (auto i = 0; i < 1500; ++i) {
+      table_right->append({(i * 7) % 1000});
+      ++_right_value_counts[(i * 7) % 1000];
+    }
+
+    _table_wrapper_left = std::make_shared<TableWrapper>(table_left);
+    _table_wrapper_left->execute();
+    _table_wrapper_right = std::make_shared<TableWrapper>(table_right);
+    _table_wrapper_right->execute();
+  }
+
+  std::shared_ptr<const Table> join(const JoinMode mode, const std::optional<size_t>& radix_bits) {
+    auto join = std::make_shared<JoinHash>(_table_wrapper_left, _table_wrapper_right, mode,
+                                           std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals, radix_bits);
+    join->execute();
+    return join->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left, _table_wrapper_right;
+  std::map<int, size_t> _left_value_counts, _right_value_counts;
+};
+
+TEST_F(OperatorsJoinHashTest, RadixBitsDoNotChangeResult) {
+  auto inner_row_count = size_t{0};
+  auto left_row_count = size_t{0};
+  auto semi_row_count = size_t{0};
+  for (const auto& [value, count] : _left_value_counts) {
+    const auto match_count = _right_value_counts.count(value) ? _right_value_counts[value] : size_t{0};
+    inner_row_count += count * match_count;
+    left_row_count += count * std::max(match_count, size_t{1});
+    if (match_count > 0) semi_row_count += count;
+  }
+
+  // Without partitioning, with one pass, and with two passes
+  for (const auto radix_bits : {size_t{0}, size_t{3}, size_t{12}}) {
+    SCOPED_TRACE(radix_bits);
+
+    const auto inner = join(JoinMode::Inner, radix_bits);
+    EXPECT_EQ(inner->row_count(), inner_row_count);
+    EXPECT_TABLE_EQ_UNORDERED(inner, join(JoinMode::Inner, std::nullopt));
+
+    EXPECT_EQ(join(JoinMode::Left, radix_bits)->row_count(), left_row_count);
+    EXPECT_EQ(join(JoinMode::Semi, radix_bits)->row_count(), semi_row_count);
+    EXPECT_EQ(join(JoinMode::Anti, radix_bits)->row_count(), 2000u - semi_row_count);
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, SmallMorselsDoNotChangeResult) {
+  // The morsels split the chunks of the right input and the single output chunk of the scan on the left input
+  auto scan_left = std::make_shared<TableScan>(_table_wrapper_left, ColumnID{0}, ScanType::OpLessThan, 500);
+  scan_left->execute();
+
+  const auto join_scan = [&](const JoinMode mode, const size_t radix_bits) {
+    auto join = std::make_shared<JoinHash>(scan_left, _table_wrapper_right, mode,
+                                           std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals, radix_bits);
+    join->execute();
+    return join->get_output();
+  };
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi}) {
+    for (const auto radix_bits : {size_t{0}, size_t{3}}) {
+      SCOPED_TRACE(radix_bits);
+
+      const auto expected_result = join_scan(mode, radix_bits);
+
+      MorselDispatcher::set_default_morsel_size(128u);
+      EXPECT_TABLE_EQ_UNORDERED(join_scan(mode, radix_bits), expected_result);
+      MorselDispatcher::reset_default_morsel_size();
+    }
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, JoinOnValueIDs) {
+  // Both join columns are dictionary-encoded, so that the join is performed on ValueIDs. The chunks have different
+  // dictionaries, which need to be mapped onto each other.
+  const auto make_table = [](const size_t row_count, const int step, const bool compress) {
+    auto table = std::make_shared<Table>(7);
+    table->add_column("s", DataType::String, true);
+    for (auto i = size_t{0}; i < row_count; ++i) {
+      if (i % 11 == 0) {
+        table->append({NULL_VALUE});
+      } else {
+        table->append({"v" + std::to_string((i * step) % 23)});
+      }
+    }
+    if (compress) DictionaryCompression::compress_table(*table);
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto join_strings = [&](const bool compress, const JoinMode mode) {
+    auto join = std::make_shared<JoinHash>(make_table(40, 3, compress), make_table(60, 5, compress), mode,
+                                           std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals);
+    join->execute();
+    return join->get_output();
+  };
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi, JoinMode::Anti}) {
+    SCOPED_TRACE(join_mode_to_string.at(mode));
+    EXPECT_TABLE_EQ_UNORDERED(join_strings(true, mode), join_strings(false, mode));
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, JoinScanOutputsOnValueIDs) {
+  // The scans output ReferenceColumns that only reference DictionaryColumns, so the join is still performed on ValueIDs
+  const auto make_table = [](const size_t row_count, const int step, const bool compress) {
+    auto table = std::make_shared<Table>(9);
+    table->add_column("s", DataType::String, true);
+    for (auto i = size_t{0}; i < row_count; ++i) {
+      if (i % 13 == 0) {
+        table->append({NULL_VALUE});
+      } else {
+        table->append({"v" + std::to_string((i * step) % 17)});
+      }
+    }
+    if (compress) DictionaryCompression::compress_table(*table);
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto join_scans = [&](const bool compress, const JoinMode mode) {
+    auto scan_left = std::make_shared<TableScan>(make_table(50, 3, compress), ColumnID{0}, ScanType::OpLessThan, "v5");
+    scan_left->execute();
+    auto scan_right =
+        std::make_shared<TableScan>(make_table(70, 4, compress), ColumnID{0}, ScanType::OpNotEquals, "v1");
+    scan_right->execute();
+
+    auto join = std::make_shared<JoinHash>(scan_left, scan_right, mode, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                           ScanType::OpEquals);
+    join->execute();
+    return join->get_output();
+  };
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi, JoinMode::Anti}) {
+    SCOPED_TRACE(join_mode_to_string.at(mode));
+    EXPECT_TABLE_EQ_UNORDERED(join_scans(true, mode), join_scans(false, mode));
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, JoinStringsOfAllEncodings) {
+  // Strings are joined as views into value columns and dictionaries, and as copies for other encodings
+  const auto make_table = [](const int step, const bool encode) {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("s", DataType::String, true);
+    for (auto i = 0; i < 30; ++i) {
+      table->append({i % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{"v" + std::to_string((i * step) % 13)}});
+    }
+    if (encode) {
+      DictionaryCompression::compress_chunks(*table, {ChunkID{1}});
+      RunLengthEncoding::encode_chunk(table->column_types(), table->get_chunk(ChunkID{2}), {ColumnID{0}});
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto join_strings = [&](const bool encode, const JoinMode mode) {
+    // The right input consists of ReferenceColumns
+    auto table_scan = std::make_shared<TableScan>(make_table(5, encode), ColumnID{0}, ScanType::OpNotEquals, "v1");
+    table_scan->execute();
+
+    auto join = std::make_shared<JoinHash>(make_table(3, encode), table_scan, mode,
+                                           std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals);
+    join->execute();
+    return join->get_output();
+  };
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi}) {
+    SCOPED_TRACE(join_mode_to_string.at(mode));
+    EXPECT_TABLE_EQ_UNORDERED(join_strings(true, mode), join_strings(false, mode));
+  }
+}
+
+}  // namespace opossum
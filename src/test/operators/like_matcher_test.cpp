@@ -0,0 +1,88 @@
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan/like_matcher.hpp"
+
+namespace opossum {
+
+class LikeMatcherTest : public BaseTest {};
+
+TEST_F(LikeMatcherTest, PatternTypes) {
+  EXPECT_EQ(LikeMatcher{"Dampf"}.pattern_type(), LikeMatcher::PatternType::Exact);
+  EXPECT_EQ(LikeMatcher{""}.pattern_type(), LikeMatcher::PatternType::Exact);
+  EXPECT_EQ(LikeMatcher{"Dampf%"}.pattern_type(), LikeMatcher::PatternType::Prefix);
+  EXPECT_EQ(LikeMatcher{"%%"}.pattern_type(), LikeMatcher::PatternType::Prefix);
+  EXPECT_EQ(LikeMatcher{"%schaft"}.pattern_type(), LikeMatcher::PatternType::Suffix);
+  EXPECT_EQ(LikeMatcher{"%schiff%"}.pattern_type(), LikeMatcher::PatternType::Contains);
+  EXPECT_EQ(LikeMatcher{"Schiff%schaft"}.pattern_type(), LikeMatcher::PatternType::MultiSegment);
+  EXPECT_EQ(LikeMatcher{"%a%%b%"}.pattern_type(), LikeMatcher::PatternType::MultiSegment);
+  EXPECT_EQ(LikeMatcher{"D_mpf%"}.pattern_type(), LikeMatcher::PatternType::General);
+}
+
+TEST_F(LikeMatcherTest, Matches) {
+  // pattern, value, expected result
+  const auto tests = std::vector<std::tuple<std::string, std::string, bool>>{
+      {"Dampf", "Dampf", true},
+      {"Dampf", "dampf", false},
+      {"Dampf", "Dampfer", false},
+      {"", "", true},
+      {"", "a", false},
+      {"%", "", true},
+      {"%", "Reeperbahn", true},
+      {"Dampf%", "Dampfschiff", true},
+      {"Dampf%", "dAmpFschiff", false},
+      {"Dampf%", "Damp", false},
+      {"%schaft", "Gesellschaft", true},
+      {"%schaft", "Schaftgesell", false},
+      {"%schiff%", "Dampfschifffahrt", true},
+      {"%schiff%", "Dampfschif", false},
+      {"%schiff%", "Schifffahrt", false},
+      {"Schiff%schaft", "Schifffahrtsgesellschaft", true},
+      {"Schiff%schaft", "Schiffschaft", true},
+      {"Schiff%schaft", "Schiffschaf", false},
+      {"ab%ba", "aba", false},
+      {"ab%ba", "abba", true},
+      {"%a%b%c%", "xxaxxbxxcxx", true},
+      {"%a%b%c%", "xxcxxbxxaxx", false},
+      {"a%b%c", "abcbc", true},
+      {"a%b%c", "acb", false},
+      {"D_mpf%", "Dampfschiff", true},
+      {"D_mpf%", "Dmpfschiff", false},
+      {"___", "abc", true},
+      {"___", "abcd", false},
+      {"%_%s_", "xxsy", true},
+      {"%_%s_", "sy", false},
+      {"a%_b", "axxb", true},
+      {"a%_b", "ab", false},
+      {"100%", "100% Schiff", true},
+      {"%.*%", "a.*b", true},
+      {"%.*%", "ab", false}};
+
+  for (const auto& test : tests) {
+    EXPECT_EQ(LikeMatcher{std::get<0>(test)}.matches(std::get<1>(test)), std::get<2>(test))
+        << std::get<1>(test) << " LIKE " << std::get<0>(test);
+  }
+}
+
+TEST_F(LikeMatcherTest, FindSubstring) {
+  // Long enough for several blocks, with candidates whose first and last characters match, but not the others
+  auto haystack = std::string{};
+  for (auto index = 0; index < 200; ++index) haystack += static_cast<char>('a' + (index * 7) % 5);
+  haystack += "abxxba";
+
+  for (const auto& needle : {"a", "ab", "abxxba", "acb", "xx", "zz", "eccb"}) {
+    for (const auto begin : {size_t{0u}, size_t{3u}, size_t{100u}}) {
+      for (const auto end : {haystack.size(), haystack.size() - 3u, size_t{150u}}) {
+        const auto expected_position = haystack.substr(0u, end).find(needle, begin);
+        EXPECT_EQ(LikeMatcher::find_substring(haystack, needle, begin, end), expected_position)
+            << needle << " in [" << begin << ", " << end << ")";
+      }
+    }
+  }
+}
+
+}  // namespace opossum
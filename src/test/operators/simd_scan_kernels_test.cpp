@@ -0,0 +1,79 @@
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan/simd_scan_kernels.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+template <typename T>
+class SimdScanKernelsTest : public BaseTest {};
+
+using SimdScanKernelsTestTypes = ::testing::Types<int32_t, int64_t, float, double, uint8_t, uint16_t, uint32_t>;
+TYPED_TEST_CASE(SimdScanKernelsTest, SimdScanKernelsTestTypes);
+
+TYPED_TEST(SimdScanKernelsTest, AllInstructionSetsFindMatches) {
+  using T = TypeParam;
+
+  // 203 values, so that the last vector is only partially filled for every vector width
+  auto values = std::vector<T>(203);
+  for (auto index = size_t{0u}; index < values.size(); ++index) {
+    values[index] = static_cast<T>((index * 37u) % 23u);
+  }
+  values[5] = std::numeric_limits<T>::max();
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  const auto isas = {ScanKernelIsa::Scalar, ScanKernelIsa::Avx2, ScanKernelIsa::Avx512};
+
+  for (const auto scan_type : scan_types) {
+    for (const auto excluded_value : {std::optional<T>{}, std::optional<T>{std::numeric_limits<T>::max()}}) {
+      auto expected_matches = std::vector<RowID>{};
+      for (auto index = size_t{0u}; index < values.size(); ++index) {
+        const auto value = values[index];
+        if (excluded_value && value == *excluded_value) continue;
+
+        auto matches = false;
+        switch (scan_type) {
+          case ScanType::OpEquals:
+            matches = value == T{11};
+            break;
+          case ScanType::OpNotEquals:
+            matches = value != T{11};
+            break;
+          case ScanType::OpLessThan:
+            matches = value < T{11};
+            break;
+          case ScanType::OpLessThanEquals:
+            matches = value <= T{11};
+            break;
+          case ScanType::OpGreaterThan:
+            matches = value > T{11};
+            break;
+          default:
+            matches = value >= T{11};
+        }
+
+        if (matches) expected_matches.emplace_back(RowID{ChunkID{3}, static_cast<ChunkOffset>(100u + index)});
+      }
+
+      for (const auto isa : isas) {
+        if (isa > best_scan_kernel_isa()) continue;
+
+        auto matches = std::vector<RowID>(values.size());
+        const auto match_count = scan_values(values.data(), values.size(), scan_type, T{11}, ChunkID{3},
+                                             ChunkOffset{100}, matches.data(), excluded_value, isa);
+        matches.resize(match_count);
+
+        EXPECT_EQ(matches, expected_matches);
+      }
+    }
+  }
+}
+
+}  // namespace opossum
@@ -1,6 +1,10 @@
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -10,6 +14,9 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/dictionary_compression.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -130,6 +137,112 @@ TEST_F(OperatorsSortTest, MultipleColumnSortIsStableMixedOrder) {
   EXPECT_TABLE_EQ_ORDERED(sort_after_a->get_output(), expected_result);
 }
 
+TEST_F(OperatorsSortTest, MultipleColumnSort) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Ascending}, {ColumnID{1}}}, 2u);
+  sort->execute();
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), load_table("src/test/tables/int_float2_sorted.tbl", 2));
+
+  auto sort_mixed = std::make_shared<Sort>(
+      table_wrapper,
+      std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Ascending}, {ColumnID{1}, OrderByMode::Descending}},
+      2u);
+  sort_mixed->execute();
+  EXPECT_TABLE_EQ_ORDERED(sort_mixed->get_output(), load_table("src/test/tables/int_float2_sorted_mixed.tbl", 2));
+}
+
+TEST_F(OperatorsSortTest, MultipleColumnSortWithStringsAndNullsInParallel) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("s", DataType::String, true);
+  table->add_column("d", DataType::Double);
+  table->add_column("i", DataType::Int);
+
+  // Rows are sorted by s (descending, NULLs last), then d (ascending), and keep their order otherwise
+  auto rows = std::vector<std::tuple<std::optional<std::string>, double, int32_t>>{};
+  for (auto i = 0; i < 40; ++i) {
+    const auto s = i % 7 == 0 ? std::nullopt : std::optional<std::string>{"s" + std::to_string(i % 3)};
+    rows.emplace_back(s, i % 4 - 1.5, i);
+    table->append({s ? AllTypeVariant{*s} : NULL_VALUE, i % 4 - 1.5, i});
+  }
+  DictionaryCompression::compress_chunks(*table, {ChunkID{0}, ChunkID{2}, ChunkID{5}});
+
+  std::stable_sort(rows.begin(), rows.end(), [](const auto& left, const auto& right) {
+    const auto& [left_s, left_d, left_i] = left;
+    const auto& [right_s, right_d, right_i] = right;
+    if (left_s != right_s) return !right_s || (left_s && *left_s > *right_s);
+    return left_d < right_d;
+  });
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("s", DataType::String, true);
+  expected_result->add_column("d", DataType::Double);
+  expected_result->add_column("i", DataType::Int);
+  for (const auto& [s, d, i] : rows) {
+    expected_result->append({s ? AllTypeVariant{*s} : NULL_VALUE, d, i});
+  }
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto sort = std::make_shared<Sort>(table_wrapper,
+                                     std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::DescendingNullsLast},
+                                                                       {ColumnID{1}, OrderByMode::Ascending}},
+                                     7u);
+  sort->execute();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_EQ(sort->get_output()->chunk_count(), 6u);
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
+TEST_F(OperatorsSortTest, LargeRunsOfReferencedStringsInParallel) {
+  auto table = std::make_shared<Table>(10'000);
+  table->add_column("s", DataType::String, true);
+  table->add_column("i", DataType::Int);
+
+  // The runs are large enough to be merged in several pieces. Rows are sorted by s and keep their order otherwise.
+  auto rows = std::vector<std::pair<std::optional<std::string>, int32_t>>{};
+  for (auto i = 0; i < 40'000; ++i) {
+    const auto s = i % 11 == 0 ? std::nullopt : std::optional<std::string>{"s" + std::to_string(i * 7 % 1'000)};
+    table->append({s ? AllTypeVariant{*s} : NULL_VALUE, i});
+    if (i >= 5'000) rows.emplace_back(s, i);
+  }
+  DictionaryCompression::compress_chunks(*table, {ChunkID{1}, ChunkID{2}});
+
+  std::stable_sort(rows.begin(), rows.end(),
+                   [](const auto& left, const auto& right) { return left.first < right.first; });
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("s", DataType::String, true);
+  expected_result->add_column("i", DataType::Int);
+  for (const auto& [s, i] : rows) {
+    expected_result->append({s ? AllTypeVariant{*s} : NULL_VALUE, i});
+  }
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // The scan makes the sort columns ReferenceColumns
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpGreaterThanEquals, 5'000);
+  table_scan->execute();
+
+  auto sort = std::make_shared<Sort>(table_scan, ColumnID{0}, OrderByMode::Ascending, 7'000u);
+  sort->execute();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
 TEST_F(OperatorsSortTest, AscendingSortOfOneColumnWithNull) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_null_sorted_asc.tbl", 2);
 
@@ -12,6 +12,7 @@
 #include "operators/get_table.hpp"
 #include "operators/table_scan.hpp"
 #include "storage/dictionary_compression.hpp"
+#include "storage/run_length_encoding.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -40,9 +41,19 @@ class OperatorsTableScanLikeTest : public BaseTest {
 
     _gt_string_dict = std::make_shared<GetTable>("table_string_dict");
     _gt_string_dict->execute();
+
+    // load and run-length encode string table
+    auto test_table_string_rle = load_table("src/test/tables/int_string_like.tbl", 5);
+    RunLengthEncoding::encode_chunk(test_table_string_rle->column_types(), test_table_string_rle->get_chunk(ChunkID{0}),
+                                    {ColumnID{0}, ColumnID{1}});
+
+    StorageManager::get().add_table("table_string_rle", test_table_string_rle);
+
+    _gt_string_rle = std::make_shared<GetTable>("table_string_rle");
+    _gt_string_rle->execute();
   }
 
-  std::shared_ptr<GetTable> _gt, _gt_string, _gt_string_dict;
+  std::shared_ptr<GetTable> _gt, _gt_string, _gt_string_dict, _gt_string_rle;
 };
 
 /*
@@ -73,18 +84,17 @@ TEST_F(OperatorsTableScanLikeTest, ScanLikeEmptyStringOnDict) {
   scan->execute();
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
-TEST_F(OperatorsTableScanLikeTest, ScanLikeCaseInsensitivity) {
-  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_starting.tbl", 1);
-  // wildcard has to be placed at front and/or back of search string
+TEST_F(OperatorsTableScanLikeTest, ScanLikeCaseSensitivity) {
+  // As in the SQL standard, LIKE compares case sensitively
   auto scan = std::make_shared<TableScan>(_gt_string, ColumnID{1}, ScanType::OpLike, "dAmpF%");
   scan->execute();
-  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+  EXPECT_EQ(scan->get_output()->row_count(), 0u);
 }
 
 TEST_F(OperatorsTableScanLikeTest, ScanLikeUnderscoreWildcard) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_starting.tbl", 1);
   // wildcard has to be placed at front and/or back of search string
-  auto scan = std::make_shared<TableScan>(_gt_string, ColumnID{1}, ScanType::OpLike, "d_m_f%");
+  auto scan = std::make_shared<TableScan>(_gt_string, ColumnID{1}, ScanType::OpLike, "D_m_f%");
   scan->execute();
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
@@ -117,6 +127,20 @@ TEST_F(OperatorsTableScanLikeTest, ScanLikeStartingOnReferencedDictColumn) {
   scan2->execute();
   EXPECT_TABLE_EQ_UNORDERED(scan2->get_output(), expected_result);
 }
+TEST_F(OperatorsTableScanLikeTest, ScanLikeStartingOnRunLengthColumn) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_starting.tbl", 1);
+  auto scan = std::make_shared<TableScan>(_gt_string_rle, ColumnID{1}, ScanType::OpLike, "Dampf%");
+  scan->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+}
+TEST_F(OperatorsTableScanLikeTest, ScanLikeStartingOnReferencedRunLengthColumn) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_starting.tbl", 1);
+  auto scan1 = std::make_shared<TableScan>(_gt_string_rle, ColumnID{0}, ScanType::OpGreaterThan, 0);
+  scan1->execute();
+  auto scan2 = std::make_shared<TableScan>(scan1, ColumnID{1}, ScanType::OpLike, "Dampf%");
+  scan2->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan2->get_output(), expected_result);
+}
 // ScanType::OpLike - Ending
 TEST_F(OperatorsTableScanLikeTest, ScanLikeEnding) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_ending.tbl", 1);
@@ -147,7 +171,7 @@ TEST_F(OperatorsTableScanLikeTest, ScanLikeContainingWildcard) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
-// ScanType::OpLike - Containing
+// ScanType::OpLike - Containing, which does not match "Schifffahrtsgesellschaft" because LIKE is case sensitive
 TEST_F(OperatorsTableScanLikeTest, ScanLikeContaining) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_containing.tbl", 1);
   auto scan = std::make_shared<TableScan>(_gt_string, ColumnID{1}, ScanType::OpLike, "%schifffahrtsgesellschaft%");
@@ -217,14 +241,14 @@ TEST_F(OperatorsTableScanLikeTest, ScanNotLikeAllRowsOnDict) {
 TEST_F(OperatorsTableScanLikeTest, ScanNotLikeUnderscoreWildcard) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_not_starting.tbl", 1);
   // wildcard has to be placed at front and/or back of search string
-  auto scan = std::make_shared<TableScan>(_gt_string, ColumnID{1}, ScanType::OpNotLike, "d_m_f%");
+  auto scan = std::make_shared<TableScan>(_gt_string, ColumnID{1}, ScanType::OpNotLike, "D_m_f%");
   scan->execute();
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 TEST_F(OperatorsTableScanLikeTest, ScanNotLikeUnderscoreWildcardOnDict) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_not_starting.tbl", 1);
   // wildcard has to be placed at front and/or back of search string
-  auto scan = std::make_shared<TableScan>(_gt_string_dict, ColumnID{1}, ScanType::OpNotLike, "d_m_f%");
+  auto scan = std::make_shared<TableScan>(_gt_string_dict, ColumnID{1}, ScanType::OpNotLike, "D_m_f%");
   scan->execute();
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
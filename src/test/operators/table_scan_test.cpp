@@ -14,8 +14,12 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/dictionary_column.hpp"
 #include "storage/dictionary_compression.hpp"
+#include "storage/frame_of_reference_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/run_length_encoding.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -103,6 +107,42 @@ class OperatorsTableScanTest : public BaseTest {
     return table_wrapper;
   }
 
+  std::shared_ptr<Table> get_table_run_length_encoded() {
+    // a: 1, 1, 1, 2, 2, 3, 3, 3, 3, 4 | 4, 4, 5, 5, 5
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", DataType::Int);
+    table->add_column("b", DataType::Int);
+
+    const auto values = std::vector<int>{1, 1, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 5};
+    for (auto i = 0u; i < values.size(); ++i) {
+      table->append({values[i], static_cast<int>(100 + i)});
+    }
+
+    run_length_encode_table(*table);
+    return table;
+  }
+
+  std::shared_ptr<Table> get_table_frame_of_reference_encodable() {
+    // a: three frames of distinct values with gaps between them, every 1000th value is null
+    auto table = std::make_shared<Table>(6000);
+    table->add_column("a", DataType::Int, true);
+    table->add_column("b", DataType::Int);
+
+    for (auto i = 0; i < 6000; ++i) {
+      const auto frame_id = i / 2048;
+      const auto a = (i % 1000 == 0) ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{frame_id * 10000 + (i % 2048) * 2};
+      table->append({a, i});
+    }
+
+    return table;
+  }
+
+  void run_length_encode_table(Table& table) {
+    for (auto chunk_id = ChunkID{0u}; chunk_id < table.chunk_count(); ++chunk_id) {
+      RunLengthEncoding::encode_chunk(table.column_types(), table.get_chunk(chunk_id), {ColumnID{0}, ColumnID{1}});
+    }
+  }
+
   std::shared_ptr<const Table> to_referencing_table(const std::shared_ptr<const Table>& table) {
     auto table_out = std::make_shared<Table>();
 
@@ -212,6 +252,55 @@ TEST_F(OperatorsTableScanTest, DoubleScan) {
   EXPECT_TABLE_EQ_UNORDERED(scan_2->get_output(), expected_result);
 }
 
+TEST_F(OperatorsTableScanTest, ConjunctiveScan) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
+
+  auto scan = std::make_shared<TableScan>(
+      _table_wrapper, std::vector<TableScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThanEquals, 1234},
+                                                      {ColumnID{1}, ScanType::OpLessThan, 457.9}});
+  scan->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+  EXPECT_EQ(scan->scan_type(), ScanType::OpGreaterThanEquals);
+}
+
+TEST_F(OperatorsTableScanTest, ConjunctiveScanMatchesStackedScans) {
+  const auto tests = std::vector<std::pair<std::shared_ptr<TableWrapper>, std::vector<TableScanPredicate>>>{
+      {get_table_op_part_dict(),
+       {{ColumnID{0}, ScanType::OpGreaterThanEquals, 3},
+        {ColumnID{1}, ScanType::OpLessThan, 116.0f},
+        {ColumnID{0}, ScanType::OpNotEquals, NULL_VALUE},
+        {ColumnID{0}, ScanType::OpNotEquals, 10}}},
+      {get_table_op_filtered(),
+       {{ColumnID{1}, ScanType::OpGreaterThan, 102.0f},
+        {ColumnID{0}, ScanType::OpLessThanEquals, 12},
+        {ColumnID{0}, ScanType::OpNotEquals, 4}}},
+      // The column comparisons only compare the selected rows, also for reference columns
+      {get_table_op_filtered(),
+       {{ColumnID{1}, ScanType::OpGreaterThan, 102.0f},
+        {ColumnID{0}, ScanType::OpLessThan, ColumnID{1}},
+        {ColumnID{0}, ScanType::OpNotEquals, 4}}},
+      {_table_wrapper_even_dict,
+       {{ColumnID{0}, ScanType::OpGreaterThan, 4},
+        {ColumnID{0}, ScanType::OpLessThan, ColumnID{1}},
+        {ColumnID{1}, ScanType::OpLessThanEquals, 120}}}};
+
+  for (const auto& test : tests) {
+    auto stacked_scan = std::shared_ptr<AbstractOperator>{test.first};
+    for (const auto& predicate : test.second) {
+      stacked_scan = std::make_shared<TableScan>(stacked_scan, predicate.left_column_id, predicate.scan_type,
+                                                 predicate.right_parameter);
+      stacked_scan->execute();
+    }
+
+    auto scan = std::make_shared<TableScan>(test.first, test.second);
+    scan->execute();
+
+    EXPECT_GT(stacked_scan->get_output()->row_count(), 0u);
+    EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), stacked_scan->get_output());
+  }
+}
+
 TEST_F(OperatorsTableScanTest, EmptyResultScan) {
   auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 90000);
   scan_1->execute();
@@ -284,6 +373,194 @@ TEST_F(OperatorsTableScanTest, ScanOnReferencedDictColumn) {
   }
 }
 
+TEST_F(OperatorsTableScanTest, ScanOnRunLengthColumn) {
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {105, 106, 107, 108};
+  tests[ScanType::OpNotEquals] = {100, 101, 102, 103, 104, 109, 110, 111, 112, 113, 114};
+  tests[ScanType::OpLessThan] = {100, 101, 102, 103, 104};
+  tests[ScanType::OpLessThanEquals] = {100, 101, 102, 103, 104, 105, 106, 107, 108};
+  tests[ScanType::OpGreaterThan] = {109, 110, 111, 112, 113, 114};
+  tests[ScanType::OpGreaterThanEquals] = {105, 106, 107, 108, 109, 110, 111, 112, 113, 114};
+
+  auto table_wrapper = std::make_shared<TableWrapper>(get_table_run_length_encoded());
+  table_wrapper->execute();
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 3);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnReferencedRunLengthColumn) {
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {105, 106, 107, 108};
+  tests[ScanType::OpNotEquals] = {100, 101, 102, 103, 104, 109, 110, 111, 112, 113, 114};
+  tests[ScanType::OpLessThan] = {100, 101, 102, 103, 104};
+  tests[ScanType::OpLessThanEquals] = {100, 101, 102, 103, 104, 105, 106, 107, 108};
+  tests[ScanType::OpGreaterThan] = {109, 110, 111, 112, 113, 114};
+  tests[ScanType::OpGreaterThanEquals] = {105, 106, 107, 108, 109, 110, 111, 112, 113, 114};
+
+  auto table_wrapper = std::make_shared<TableWrapper>(to_referencing_table(get_table_run_length_encoded()));
+  table_wrapper->execute();
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 3);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnFrameOfReferenceColumn) {
+  const auto reference_table = get_table_frame_of_reference_encodable();
+  auto reference_table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  reference_table_wrapper->execute();
+
+  auto table = get_table_frame_of_reference_encodable();
+  DictionaryCompression::compress_table(*table);
+  const auto column = table->get_chunk(ChunkID{0}).get_column(ColumnID{0});
+  ASSERT_NE(std::dynamic_pointer_cast<const FrameOfReferenceColumn<int>>(column), nullptr);
+
+  for (const auto& input : {std::shared_ptr<const Table>{table}, to_referencing_table(table)}) {
+    auto table_wrapper = std::make_shared<TableWrapper>(input);
+    table_wrapper->execute();
+
+    // below all frames, inside, between, and at the bounds of frames, and above all frames
+    for (const auto value : {-1, 0, 1, 2000, 4094, 4095, 9999, 10000, 20002, 24094, 30000}) {
+      for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                   ScanType::OpLessThanEquals, ScanType::OpGreaterThan,
+                                   ScanType::OpGreaterThanEquals}) {
+        auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, value);
+        scan->execute();
+
+        auto expected_scan = std::make_shared<TableScan>(reference_table_wrapper, ColumnID{0}, scan_type, value);
+        expected_scan->execute();
+
+        EXPECT_TABLE_EQ_ORDERED(scan->get_output(), expected_scan->get_output());
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanForNullValuesOnFrameOfReferenceColumn) {
+  auto table = get_table_frame_of_reference_encodable();
+  DictionaryCompression::compress_table(*table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, NULL_VALUE);
+  scan->execute();
+
+  const auto expected = std::vector<AllTypeVariant>{0, 1000, 2000, 3000, 4000, 5000};
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, expected);
+}
+
+TEST_F(OperatorsTableScanTest, SkipChunksPrunedByZoneMaps) {
+  // Chunk 0 (0-8) cannot contain matches, chunk 1 (10-18) and the uncompressed chunk 2 (20-24) have to be scanned
+  auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpGreaterThan, 12);
+  scan->execute();
+
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, {14, 16, 18, 20, 22, 24});
+
+  // The rows of chunks 1 and 2 fit into one morsel and thus into one output chunk
+  const auto& chunk_out = scan->get_output()->get_chunk(ChunkID{0});
+  const auto column_out = std::dynamic_pointer_cast<const ReferenceColumn>(chunk_out.get_column(ColumnID{0}));
+  ASSERT_NE(column_out, nullptr);
+  for (const auto& row_id : *column_out->pos_list()) {
+    EXPECT_NE(row_id.chunk_id, ChunkID{0});
+  }
+}
+
+TEST_F(OperatorsTableScanTest, SkipReferencingChunksPrunedByZoneMaps) {
+  // Exposes the pruning decision, which does not change the result of the scan
+  class PruningTableScan : public TableScan {
+   public:
+    using TableScan::TableScan;
+    using TableScan::_can_prune;
+  };
+
+  const auto data_table = _table_wrapper_even_dict->get_output();
+
+  auto table = std::make_shared<Table>();
+  table->add_column_definition("a", DataType::Int, true);
+  table->add_column_definition("b", DataType::Int, true);
+
+  // The chunks reference chunk 0 (0-8), chunks 0 and 1 (10-18), the uncompressed chunk 2 (20-24), and chunk 0 and NULL
+  const auto pos_lists = std::vector<PosList>{{RowID{ChunkID{0}, 1u}, RowID{ChunkID{0}, 3u}},
+                                              {RowID{ChunkID{0}, 2u}, RowID{ChunkID{1}, 4u}},
+                                              {RowID{ChunkID{2}, 0u}, RowID{ChunkID{2}, 2u}},
+                                              {RowID{ChunkID{0}, 0u}, NULL_ROW_ID}};
+  for (const auto& pos_list : pos_lists) {
+    const auto shared_pos_list = std::make_shared<PosList>(pos_list);
+    auto chunk = Chunk{};
+    chunk.add_column(std::make_shared<ReferenceColumn>(data_table, ColumnID{0}, shared_pos_list));
+    chunk.add_column(std::make_shared<ReferenceColumn>(data_table, ColumnID{1}, shared_pos_list));
+    table->emplace_chunk(std::move(chunk));
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan = std::make_shared<PruningTableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12);
+  EXPECT_TRUE(scan->_can_prune(*table, ChunkID{0}));
+  EXPECT_FALSE(scan->_can_prune(*table, ChunkID{1}));
+  EXPECT_FALSE(scan->_can_prune(*table, ChunkID{2}));
+  EXPECT_FALSE(scan->_can_prune(*table, ChunkID{3}));
+
+  scan->execute();
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, {18, 20, 24});
+}
+
+TEST_F(OperatorsTableScanTest, ScanSplitsChunksIntoMorsels) {
+  for (const auto& table_wrapper : {get_table_op_part_dict(), get_table_op_filtered()}) {
+    const auto predicates = std::vector<TableScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThanEquals, 3},
+                                                            {ColumnID{1}, ScanType::OpLessThan, 115.0f}};
+
+    auto expected_scan = std::make_shared<TableScan>(table_wrapper, predicates);
+    expected_scan->execute();
+
+    // Morsels of three rows split the chunks of five rows
+    MorselDispatcher::set_default_morsel_size(3u);
+    auto scan = std::make_shared<TableScan>(table_wrapper, predicates);
+    scan->execute();
+    MorselDispatcher::reset_default_morsel_size();
+
+    EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_scan->get_output());
+    for (ChunkID chunk_id{0}; chunk_id < scan->get_output()->chunk_count(); ++chunk_id) {
+      EXPECT_LE(scan->get_output()->get_chunk(chunk_id).size(), 3u);
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithAllChunksPrunedByZoneMaps) {
+  auto table = std::make_shared<Table>(5);
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::String);
+  for (auto i = 0; i < 10; ++i) table->append({i, std::to_string(i)});
+  DictionaryCompression::compress_table(*table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpGreaterThanEquals}) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, 10);
+    scan->execute();
+
+    const auto output = scan->get_output();
+    EXPECT_EQ(output->row_count(), 0u);
+    EXPECT_EQ(output->get_type(), TableType::References);
+    ASSERT_EQ(output->get_chunk(ChunkID{0}).column_count(), 2u);
+  }
+
+  auto null_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpEquals, NULL_VALUE);
+  null_scan->execute();
+  EXPECT_EQ(null_scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(null_scan->get_output()->column_type(ColumnID{1}), DataType::String);
+}
+
 TEST_F(OperatorsTableScanTest, ScanPartiallyCompressed) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_seq_filtered.tbl", 2);
 
@@ -450,6 +727,115 @@ TEST_F(OperatorsTableScanTest, ScanOnWideDictionaryColumn) {
   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
 }
 
+TEST_F(OperatorsTableScanTest, VectorizedScanOnValueAndDictColumnsWithNullValues) {
+  // Enough rows to fill several vectors and to end with a partial vector. The first chunk is larger than the blocks in
+  // which the values are copied for the kernels. Every 7th value of column a is NULL.
+  const auto create_table = [] {
+    auto table = std::make_shared<Table>(1100);
+    table->add_column("a", DataType::Int, true);
+    table->add_column("b", DataType::Double);
+    for (auto i = 0; i < 1234; ++i) {
+      table->append({i % 7 == 0 ? NULL_VALUE : AllTypeVariant{i % 50}, static_cast<double>(i % 50)});
+    }
+    return table;
+  };
+
+  const auto table = create_table();
+  const auto dict_table = create_table();
+  DictionaryCompression::compress_table(*dict_table);
+
+  const auto expected_row_count = [](const ScanType scan_type, const int value, const bool skip_nulls) {
+    auto row_count = size_t{0u};
+    for (auto i = 0; i < 1234; ++i) {
+      if (skip_nulls && i % 7 == 0) continue;
+      const auto left = i % 50;
+      switch (scan_type) {
+        case ScanType::OpEquals:
+          row_count += left == value;
+          break;
+        case ScanType::OpNotEquals:
+          row_count += left != value;
+          break;
+        case ScanType::OpLessThan:
+          row_count += left < value;
+          break;
+        case ScanType::OpLessThanEquals:
+          row_count += left <= value;
+          break;
+        case ScanType::OpGreaterThan:
+          row_count += left > value;
+          break;
+        default:
+          row_count += left >= value;
+      }
+    }
+    return row_count;
+  };
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+
+  for (const auto& input_table : {table, dict_table}) {
+    auto table_wrapper = std::make_shared<TableWrapper>(input_table);
+    table_wrapper->execute();
+
+    for (const auto scan_type : scan_types) {
+      for (const auto value : {-1, 0, 17, 49, 50}) {
+        for (const auto column_id : {ColumnID{0}, ColumnID{1}}) {
+          auto scan = std::make_shared<TableScan>(table_wrapper, column_id, scan_type, value);
+          scan->execute();
+
+          EXPECT_EQ(scan->get_output()->row_count(), expected_row_count(scan_type, value, column_id == ColumnID{0}));
+        }
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, VectorizedScanOnBitPackedDictColumn) {
+  // 400 distinct values and NULL need 9 bits, so the ValueIDs are bit-packed and scanned block by block. The chunks
+  // end with partial blocks.
+  const auto create_table = [] {
+    auto table = std::make_shared<Table>(1000);
+    table->add_column("a", DataType::Int, true);
+    for (auto i = 0; i < 1300; ++i) {
+      table->append({i % 11 == 0 ? NULL_VALUE : AllTypeVariant{(i * 7) % 400}});
+    }
+    return table;
+  };
+
+  const auto table = create_table();
+  const auto dict_table = create_table();
+  DictionaryCompression::compress_table(*dict_table, EncodingSelection::DictionaryOnly);
+
+  const auto dict_column =
+      std::dynamic_pointer_cast<const DictionaryColumn<int>>(dict_table->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+  ASSERT_NE(dict_column, nullptr);
+  const auto bit_packed_attribute_vector =
+      std::dynamic_pointer_cast<const BitPackedAttributeVector>(dict_column->attribute_vector());
+  ASSERT_NE(bit_packed_attribute_vector, nullptr);
+  EXPECT_EQ(bit_packed_attribute_vector->bit_width(), 9u);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto dict_table_wrapper = std::make_shared<TableWrapper>(dict_table);
+  dict_table_wrapper->execute();
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+
+  for (const auto scan_type : scan_types) {
+    for (const auto value : {-1, 0, 123, 256, 399, 400}) {
+      auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, value);
+      scan->execute();
+      auto dict_scan = std::make_shared<TableScan>(dict_table_wrapper, ColumnID{0}, scan_type, value);
+      dict_scan->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(dict_scan->get_output(), scan->get_output());
+    }
+  }
+}
+
 TEST_F(OperatorsTableScanTest, OperatorName) {
   auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
 
@@ -479,6 +865,19 @@ TEST_F(OperatorsTableScanTest, ScanForNullValuesOnDictColumn) {
   scan_for_null_values(table_wrapper, tests);
 }
 
+TEST_F(OperatorsTableScanTest, ScanForNullValuesOnRunLengthColumn) {
+  auto table = load_table("src/test/tables/int_float_w_null_8_rows.tbl", 4);
+  run_length_encode_table(*table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{
+      {ScanType::OpEquals, {12, 123}}, {ScanType::OpNotEquals, {12345, NULL_VALUE, 1234, 12345, 12, 1234}}};
+
+  scan_for_null_values(table_wrapper, tests);
+}
+
 TEST_F(OperatorsTableScanTest, ScanForNullValuesOnValueColumnWithoutNulls) {
   auto table = load_table("src/test/tables/int_float.tbl", 4);
 
@@ -528,6 +927,19 @@ TEST_F(OperatorsTableScanTest, ScanForNullValuesOnReferencedDictColumn) {
   scan_for_null_values(table_wrapper, tests);
 }
 
+TEST_F(OperatorsTableScanTest, ScanForNullValuesOnReferencedRunLengthColumn) {
+  auto table = load_table("src/test/tables/int_float_w_null_8_rows.tbl", 4);
+  run_length_encode_table(*table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(to_referencing_table(table));
+  table_wrapper->execute();
+
+  const auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{
+      {ScanType::OpEquals, {12, 123}}, {ScanType::OpNotEquals, {12345, NULL_VALUE, 1234, 12345, 12, 1234}}};
+
+  scan_for_null_values(table_wrapper, tests);
+}
+
 TEST_F(OperatorsTableScanTest, ScanForNullValuesWithNullRowIDOnReferencedValueColumn) {
   auto table = create_referencing_table_w_null_row_id(false);
 
@@ -0,0 +1,84 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "storage/dictionary_compression.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(7);
+    table->add_column("a", DataType::Int, true);
+    table->add_column("b", DataType::String);
+    table->add_column("c", DataType::Float);
+
+    for (auto i = 0; i < 50; ++i) {
+      table->append({i % 9 == 0 ? NULL_VALUE : AllTypeVariant{i % 5}, "s" + std::to_string(i * 7 % 11),
+                     static_cast<float>(i % 4) - 1.5f});
+    }
+    DictionaryCompression::compress_chunks(*table, {ChunkID{1}, ChunkID{4}});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  // TopK has to return the same rows as a Sort followed by a Limit
+  void test_top_k(const std::shared_ptr<const AbstractOperator>& input,
+                  const std::vector<SortColumnDefinition>& sort_definitions, const size_t num_rows) {
+    auto top_k = std::make_shared<TopK>(input, sort_definitions, num_rows, 4u);
+    top_k->execute();
+
+    auto sort = std::make_shared<Sort>(input, sort_definitions);
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, num_rows);
+    limit->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopKTest, SingleColumn) {
+  for (const auto num_rows : {0u, 1u, 3u, 10u, 60u}) {
+    test_top_k(_table_wrapper, {{ColumnID{0}, OrderByMode::Ascending}}, num_rows);
+    test_top_k(_table_wrapper, {{ColumnID{0}, OrderByMode::DescendingNullsLast}}, num_rows);
+    test_top_k(_table_wrapper, {{ColumnID{1}, OrderByMode::Descending}}, num_rows);
+    test_top_k(_table_wrapper, {{ColumnID{2}, OrderByMode::Ascending}}, num_rows);
+  }
+}
+
+TEST_F(OperatorsTopKTest, MultipleColumns) {
+  test_top_k(_table_wrapper, {{ColumnID{0}, OrderByMode::AscendingNullsLast}, {ColumnID{1}, OrderByMode::Descending}},
+             12u);
+  test_top_k(_table_wrapper, {{ColumnID{2}, OrderByMode::Descending}, {ColumnID{0}, OrderByMode::Ascending}}, 20u);
+}
+
+TEST_F(OperatorsTopKTest, ReferenceColumns) {
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{2}, ScanType::OpGreaterThan, -1.0f);
+  table_scan->execute();
+
+  test_top_k(table_scan, {{ColumnID{1}, OrderByMode::Ascending}, {ColumnID{0}, OrderByMode::Descending}}, 5u);
+}
+
+TEST_F(OperatorsTopKTest, Recreation) {
+  auto top_k = std::make_shared<TopK>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{1}}}, 3u);
+  const auto recreated_top_k = std::dynamic_pointer_cast<TopK>(top_k->recreate());
+  ASSERT_TRUE(recreated_top_k);
+  EXPECT_EQ(recreated_top_k->num_rows(), 3u);
+  EXPECT_EQ(recreated_top_k->column_id(), ColumnID{1});
+}
+
+}  // namespace opossum
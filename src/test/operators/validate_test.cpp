@@ -7,11 +7,17 @@
 #include "gtest/gtest.h"
 
 #include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "operators/abstract_read_only_operator.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/dictionary_compression.hpp"
+#include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -80,4 +86,131 @@ TEST_F(OperatorsValidateTest, ScanValidate) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, ScanValidatePipeline) {
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  auto validate = std::make_shared<Validate>(table_scan);
+  validate->set_transaction_context_recursively(context);
+
+  for (auto& task : OperatorTask::make_tasks_from_operator(validate)) task->schedule();
+
+  EXPECT_TRUE(validate->input_is_fused());
+  EXPECT_TABLE_EQ_UNORDERED(validate->get_output(),
+                            load_table("src/test/tables/validate_output_validated_scanned.tbl", 2u));
+}
+
+TEST_F(OperatorsValidateTest, ValidateInMorsels) {
+  // Morsels of three rows combine and split the chunks of two rows
+  MorselDispatcher::set_default_morsel_size(3u);
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), load_table("src/test/tables/validate_output_validated.tbl", 2u));
+
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  table_scan->execute();
+
+  auto scan_validate = std::make_shared<Validate>(table_scan);
+  scan_validate->set_transaction_context(context);
+  scan_validate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(scan_validate->get_output(),
+                            load_table("src/test/tables/validate_output_validated_scanned.tbl", 2u));
+}
+
+TEST_F(OperatorsValidateTest, SkipChunksCommittedAfterSnapshot) {
+  auto table = load_table("src/test/tables/validate_input.tbl", 2u);
+  set_all_records_visible(*table);
+  {
+    auto mvcc_columns = table->get_chunk(ChunkID{1}).mvcc_columns();
+    mvcc_columns->begin_cids[0] = 4u;
+    mvcc_columns->begin_cids[1] = 5u;
+  }
+  DictionaryCompression::compress_table(*table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  for (const auto snapshot_commit_id : {3u, 4u, 5u}) {
+    auto context = std::make_shared<TransactionContext>(1u, snapshot_commit_id);
+
+    auto validate = std::make_shared<Validate>(table_wrapper);
+    validate->set_transaction_context(context);
+    validate->execute();
+
+    EXPECT_EQ(validate->get_output()->row_count(), snapshot_commit_id - 1u);
+  }
+}
+
+TEST_F(OperatorsValidateTest, ForwardsPosListsOfVisibleChunks) {
+  auto table = load_table("src/test/tables/validate_input.tbl", 2u);
+  set_all_records_visible(*table);
+  DictionaryCompression::compress_table(*table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 4);
+  table_scan->execute();
+
+  auto validate = std::make_shared<Validate>(table_scan);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  const auto scan_output = table_scan->get_output();
+  const auto validate_output = validate->get_output();
+  ASSERT_EQ(validate_output->chunk_count(), scan_output->chunk_count());
+  EXPECT_EQ(validate_output->row_count(), 3u);
+
+  for (ChunkID chunk_id{0}; chunk_id < scan_output->chunk_count(); ++chunk_id) {
+    const auto scan_column = std::dynamic_pointer_cast<const ReferenceColumn>(
+        scan_output->get_chunk(chunk_id).get_column(ColumnID{0}));
+    const auto validate_column = std::dynamic_pointer_cast<const ReferenceColumn>(
+        validate_output->get_chunk(chunk_id).get_column(ColumnID{0}));
+    ASSERT_NE(validate_column, nullptr);
+    EXPECT_EQ(validate_column->pos_list(), scan_column->pos_list());
+  }
+}
+
+TEST_F(OperatorsValidateTest, DeletionsInVisibleChunks) {
+  auto table = load_table("src/test/tables/validate_input.tbl", 2u);
+  set_all_records_visible(*table);
+  DictionaryCompression::compress_table(*table);
+  StorageManager::get().add_table("validate_input", table);
+
+  auto get_table = std::make_shared<GetTable>("validate_input");
+  get_table->execute();
+
+  const auto validated_row_count = [&](const std::shared_ptr<TransactionContext>& context) {
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output()->row_count();
+  };
+
+  auto deleting_context = TransactionManager::get().new_transaction_context();
+  auto other_context = TransactionManager::get().new_transaction_context();
+  EXPECT_EQ(validated_row_count(deleting_context), 4u);
+
+  auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpEquals, 4);
+  table_scan->execute();
+  auto delete_op = std::make_shared<Delete>("validate_input", table_scan);
+  delete_op->set_transaction_context(deleting_context);
+  delete_op->execute();
+
+  // The deleting transaction does not see the row anymore, the other one does until the deletion is committed
+  EXPECT_EQ(validated_row_count(deleting_context), 3u);
+  EXPECT_EQ(validated_row_count(other_context), 4u);
+
+  deleting_context->commit();
+  EXPECT_EQ(validated_row_count(other_context), 4u);
+  EXPECT_EQ(validated_row_count(TransactionManager::get().new_transaction_context()), 3u);
+}
+
 }  // namespace opossum
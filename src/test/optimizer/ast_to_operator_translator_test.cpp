@@ -27,6 +27,7 @@
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/top_k.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace opossum {
@@ -70,17 +71,36 @@ TEST_F(LQPTranslatorTest, PredicateNodeBinaryScan) {
   predicate_node->set_left_child(stored_table_node);
   const auto op = LQPTranslator{}.translate_node(predicate_node);
 
-  const auto table_scan_op2 = std::dynamic_pointer_cast<TableScan>(op);
-  ASSERT_TRUE(table_scan_op2);
-  EXPECT_EQ(table_scan_op2->left_column_id(), ColumnID{0} /* "a" */);
-  EXPECT_EQ(table_scan_op2->scan_type(), ScanType::OpLessThanEquals);
-  EXPECT_EQ(table_scan_op2->right_parameter(), AllParameterVariant(1337));
+  // BETWEEN is evaluated as the conjunction of two predicates by a single TableScan
+  const auto table_scan_op = std::dynamic_pointer_cast<TableScan>(op);
+  ASSERT_TRUE(table_scan_op);
+  ASSERT_EQ(table_scan_op->predicates().size(), 2u);
+  EXPECT_EQ(table_scan_op->predicates()[0].left_column_id, ColumnID{0} /* "a" */);
+  EXPECT_EQ(table_scan_op->predicates()[0].scan_type, ScanType::OpGreaterThanEquals);
+  EXPECT_EQ(table_scan_op->predicates()[0].right_parameter, AllParameterVariant(42));
+  EXPECT_EQ(table_scan_op->predicates()[1].left_column_id, ColumnID{0} /* "a" */);
+  EXPECT_EQ(table_scan_op->predicates()[1].scan_type, ScanType::OpLessThanEquals);
+  EXPECT_EQ(table_scan_op->predicates()[1].right_parameter, AllParameterVariant(1337));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(table_scan_op->input_left()));
+}
 
-  const auto table_scan_op = std::dynamic_pointer_cast<const TableScan>(table_scan_op2->input_left());
+TEST_F(LQPTranslatorTest, PredicateNodeChainIsFused) {
+  const auto stored_table_node = std::make_shared<StoredTableNode>("table_int_float");
+  auto predicate_node_a = std::make_shared<PredicateNode>(ColumnID{0}, ScanType::OpGreaterThan, 42);
+  predicate_node_a->set_left_child(stored_table_node);
+  auto predicate_node_b = std::make_shared<PredicateNode>(ColumnID{1}, ScanType::OpLessThan, 100.0f);
+  predicate_node_b->set_left_child(predicate_node_a);
+  const auto op = LQPTranslator{}.translate_node(predicate_node_b);
+
+  // The lowest PredicateNode is evaluated first
+  const auto table_scan_op = std::dynamic_pointer_cast<TableScan>(op);
   ASSERT_TRUE(table_scan_op);
-  EXPECT_EQ(table_scan_op->left_column_id(), ColumnID{0} /* "a" */);
-  EXPECT_EQ(table_scan_op->scan_type(), ScanType::OpGreaterThanEquals);
-  EXPECT_EQ(table_scan_op->right_parameter(), AllParameterVariant(42));
+  ASSERT_EQ(table_scan_op->predicates().size(), 2u);
+  EXPECT_EQ(table_scan_op->predicates()[0].left_column_id, ColumnID{0});
+  EXPECT_EQ(table_scan_op->predicates()[0].scan_type, ScanType::OpGreaterThan);
+  EXPECT_EQ(table_scan_op->predicates()[1].left_column_id, ColumnID{1});
+  EXPECT_EQ(table_scan_op->predicates()[1].scan_type, ScanType::OpLessThan);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(table_scan_op->input_left()));
 }
 
 TEST_F(LQPTranslatorTest, ProjectionNode) {
@@ -270,4 +290,45 @@ TEST_F(LQPTranslatorTest, LimitNode) {
   EXPECT_EQ(limit_op->num_rows(), num_rows);
 }
 
+TEST_F(LQPTranslatorTest, LimitNodeAboveSortNode) {
+  const auto stored_table_node = std::make_shared<StoredTableNode>("table_int_float");
+
+  auto sort_node = std::make_shared<SortNode>(
+      std::vector<OrderByDefinition>{{ColumnID{1}, OrderByMode::Descending}, {ColumnID{0}, OrderByMode::Ascending}});
+  sort_node->set_left_child(stored_table_node);
+
+  auto limit_node = std::make_shared<LimitNode>(2u);
+  limit_node->set_left_child(sort_node);
+
+  const auto op = LQPTranslator{}.translate_node(limit_node);
+  const auto top_k_op = std::dynamic_pointer_cast<TopK>(op);
+  ASSERT_TRUE(top_k_op);
+  EXPECT_EQ(top_k_op->num_rows(), 2u);
+  ASSERT_EQ(top_k_op->sort_definitions().size(), 2u);
+  EXPECT_EQ(top_k_op->sort_definitions()[0].column_id, ColumnID{1});
+  EXPECT_EQ(top_k_op->sort_definitions()[0].order_by_mode, OrderByMode::Descending);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(top_k_op->input_left()));
+}
+
+TEST_F(LQPTranslatorTest, LimitNodeAboveSharedSortNode) {
+  const auto stored_table_node = std::make_shared<StoredTableNode>("table_int_float");
+
+  auto sort_node = std::make_shared<SortNode>(std::vector<OrderByDefinition>{{ColumnID{1}, OrderByMode::Descending}});
+  sort_node->set_left_child(stored_table_node);
+
+  auto limit_node = std::make_shared<LimitNode>(2u);
+  limit_node->set_left_child(sort_node);
+
+  // The other parent of the SortNode needs all sorted rows
+  auto other_limit_node = std::make_shared<LimitNode>(100u);
+  other_limit_node->set_left_child(sort_node);
+
+  const auto op = LQPTranslator{}.translate_node(limit_node);
+  const auto limit_op = std::dynamic_pointer_cast<Limit>(op);
+  ASSERT_TRUE(limit_op);
+  EXPECT_EQ(limit_op->num_rows(), 2u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const Sort>(limit_op->input_left()));
+  EXPECT_FALSE(std::dynamic_pointer_cast<const TopK>(limit_op->input_left()));
+}
+
 }  // namespace opossum
@@ -0,0 +1,275 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/logical_plan_root_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "optimizer/column_statistics.hpp"
+#include "optimizer/expression.hpp"
+#include "optimizer/strategy/join_ordering_rule.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "optimizer/table_statistics.hpp"
+
+namespace opossum {
+
+class JoinOrderingRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    _rule = std::make_shared<JoinOrderingRule>();
+
+    // a and b have 1000 rows each with unique values in their first column, c has only 10 rows
+    _table_node_a = _create_mock_node(1000, {1000, 100});
+    _table_node_b = _create_mock_node(1000, {1000, 1000});
+    _table_node_c = _create_mock_node(10, {10});
+  }
+
+  // Creates a MockNode with int columns whose values range from 0 to distinct count - 1
+  std::shared_ptr<MockNode> _create_mock_node(const float row_count, const std::vector<float>& distinct_counts) {
+    auto column_statistics = std::vector<std::shared_ptr<BaseColumnStatistics>>{};
+    for (auto column_id = ColumnID{0}; column_id < distinct_counts.size(); ++column_id) {
+      const auto distinct_count = distinct_counts[column_id];
+      column_statistics.emplace_back(
+          std::make_shared<ColumnStatistics<int32_t>>(column_id, distinct_count, 0, distinct_count - 1));
+    }
+
+    return std::make_shared<MockNode>(std::make_shared<TableStatistics>(row_count, column_statistics));
+  }
+
+  uint32_t _count_joins(const std::shared_ptr<AbstractLQPNode>& node, const JoinMode join_mode) {
+    auto count = uint32_t{0};
+    if (node->type() == LQPNodeType::Join && std::dynamic_pointer_cast<JoinNode>(node)->join_mode() == join_mode) {
+      ++count;
+    }
+
+    if (node->left_child()) count += _count_joins(node->left_child(), join_mode);
+    if (node->right_child()) count += _count_joins(node->right_child(), join_mode);
+
+    return count;
+  }
+
+  std::shared_ptr<JoinOrderingRule> _rule;
+  std::shared_ptr<MockNode> _table_node_a, _table_node_b, _table_node_c;
+};
+
+TEST_F(JoinOrderingRuleTest, JoinSmallestIntermediateResultFirst) {
+  /**
+   * Test that
+   *
+   *     Predicate
+   *   (a.x == b.x)
+   *         |
+   *     Predicate
+   *   (b.y == c.x)
+   *         |
+   *       Cross
+   *      /     \
+   *   Cross     c
+   *   /   \
+   *  a     b
+   *
+   * gets converted to
+   *
+   *       Join
+   *   (a.x == b.x)
+   *     /     \
+   *    a      Join
+   *       (b.y == c.x)
+   *         /     \
+   *        b       c
+   *
+   * because joining b and c first only yields 10 rows, while joining a and b first yields 1000 rows. The columns remain
+   * in their order, so no Projection is needed.
+   */
+  const auto cross_join_node_0 = std::make_shared<JoinNode>(JoinMode::Cross);
+  cross_join_node_0->set_left_child(_table_node_a);
+  cross_join_node_0->set_right_child(_table_node_b);
+
+  const auto cross_join_node_1 = std::make_shared<JoinNode>(JoinMode::Cross);
+  cross_join_node_1->set_left_child(cross_join_node_0);
+  cross_join_node_1->set_right_child(_table_node_c);
+
+  const auto predicate_node_0 = std::make_shared<PredicateNode>(ColumnID{3}, ScanType::OpEquals, ColumnID{4});
+  predicate_node_0->set_left_child(cross_join_node_1);
+
+  const auto predicate_node_1 = std::make_shared<PredicateNode>(ColumnID{0}, ScanType::OpEquals, ColumnID{2});
+  predicate_node_1->set_left_child(predicate_node_0);
+
+  const auto output = StrategyBaseTest::apply_rule(_rule, predicate_node_1);
+
+  ASSERT_INNER_JOIN_NODE(output, ScanType::OpEquals, ColumnID{0}, ColumnID{0});
+  EXPECT_EQ(output->left_child(), _table_node_a);
+  ASSERT_INNER_JOIN_NODE(output->right_child(), ScanType::OpEquals, ColumnID{1}, ColumnID{0});
+  EXPECT_EQ(output->right_child()->left_child(), _table_node_b);
+  EXPECT_EQ(output->right_child()->right_child(), _table_node_c);
+
+  EXPECT_TRUE(_table_node_a->parents().size() == 1u && _table_node_a->parents()[0] == output);
+}
+
+TEST_F(JoinOrderingRuleTest, PushDownPredicatesAndRestoreColumnOrder) {
+  /**
+   * Test that
+   *
+   *     Predicate
+   *    (c.x > 5)
+   *         |
+   *       Join
+   *   (c.x == a.x)
+   *     /     \
+   *    c       a
+   *
+   * gets converted to
+   *
+   *      Projection
+   *   (c.x, a.x, a.y)
+   *         |
+   *       Join
+   *   (a.x == c.x)
+   *     /     \
+   *    a    Predicate
+   *         (c.x > 5)
+   *            |
+   *            c
+   *
+   * where the larger input is the left one, just as in all joins created by the rule.
+   */
+  const auto join_node = std::make_shared<JoinNode>(JoinMode::Inner, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                                    ScanType::OpEquals);
+  join_node->set_left_child(_table_node_c);
+  join_node->set_right_child(_table_node_a);
+
+  const auto predicate_node = std::make_shared<PredicateNode>(ColumnID{0}, ScanType::OpGreaterThan, 5);
+  predicate_node->set_left_child(join_node);
+
+  const auto output = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  ASSERT_EQ(output->type(), LQPNodeType::Projection);
+  const auto& column_expressions = std::dynamic_pointer_cast<ProjectionNode>(output)->column_expressions();
+  ASSERT_EQ(column_expressions.size(), 3u);
+  EXPECT_EQ(column_expressions[0]->column_id(), ColumnID{2});
+  EXPECT_EQ(column_expressions[1]->column_id(), ColumnID{0});
+  EXPECT_EQ(column_expressions[2]->column_id(), ColumnID{1});
+
+  const auto new_join_node = output->left_child();
+  ASSERT_INNER_JOIN_NODE(new_join_node, ScanType::OpEquals, ColumnID{0}, ColumnID{0});
+  EXPECT_EQ(new_join_node->left_child(), _table_node_a);
+
+  const auto new_predicate_node = std::dynamic_pointer_cast<PredicateNode>(new_join_node->right_child());
+  ASSERT_NE(new_predicate_node, nullptr);
+  EXPECT_EQ(new_predicate_node->column_id(), ColumnID{0});
+  EXPECT_EQ(new_predicate_node->scan_type(), ScanType::OpGreaterThan);
+  EXPECT_EQ(new_predicate_node->left_child(), _table_node_c);
+}
+
+TEST_F(JoinOrderingRuleTest, OrderedJoinsAreNotChanged) {
+  const auto join_node_0 = std::make_shared<JoinNode>(JoinMode::Inner, std::make_pair(ColumnID{1}, ColumnID{0}),
+                                                      ScanType::OpEquals);
+  join_node_0->set_left_child(_table_node_b);
+  join_node_0->set_right_child(_table_node_c);
+
+  const auto join_node_1 = std::make_shared<JoinNode>(JoinMode::Inner, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                                      ScanType::OpEquals);
+  join_node_1->set_left_child(_table_node_a);
+  join_node_1->set_right_child(join_node_0);
+
+  const auto root_node = std::make_shared<LogicalPlanRootNode>();
+  root_node->set_left_child(join_node_1);
+
+  EXPECT_FALSE(_rule->apply_to(root_node));
+  EXPECT_EQ(root_node->left_child(), join_node_1);
+  EXPECT_EQ(join_node_1->right_child(), join_node_0);
+}
+
+TEST_F(JoinOrderingRuleTest, RelationsWithRemappedColumnsAreNotOrdered) {
+  /**
+   * The AggregateNode passes on the statistics of b, although its first column is b.y and its second one is SUM(b.x).
+   * Since the ColumnIDs of these statistics do not match the output of the AggregateNode, the join graph is left as is.
+   *
+   *     Predicate
+   *   (a.x == b.y)
+   *         |
+   *     Predicate
+   *   (SUM(b.x) == c.x)
+   *         |
+   *       Cross
+   *      /     \
+   *   Cross     c
+   *   /   \
+   *  a   Aggregate
+   *   (b.y, SUM(b.x))
+   *        |
+   *        b
+   */
+  const auto sum_expression =
+      Expression::create_aggregate_function(AggregateFunction::Sum, {Expression::create_column(ColumnID{0})});
+  const auto aggregate_node = std::make_shared<AggregateNode>(std::vector<std::shared_ptr<Expression>>{sum_expression},
+                                                              std::vector<ColumnID>{ColumnID{1}});
+  aggregate_node->set_left_child(_table_node_b);
+
+  const auto cross_join_node_0 = std::make_shared<JoinNode>(JoinMode::Cross);
+  cross_join_node_0->set_left_child(_table_node_a);
+  cross_join_node_0->set_right_child(aggregate_node);
+
+  const auto cross_join_node_1 = std::make_shared<JoinNode>(JoinMode::Cross);
+  cross_join_node_1->set_left_child(cross_join_node_0);
+  cross_join_node_1->set_right_child(_table_node_c);
+
+  const auto predicate_node_0 = std::make_shared<PredicateNode>(ColumnID{3}, ScanType::OpEquals, ColumnID{4});
+  predicate_node_0->set_left_child(cross_join_node_1);
+
+  const auto predicate_node_1 = std::make_shared<PredicateNode>(ColumnID{0}, ScanType::OpEquals, ColumnID{2});
+  predicate_node_1->set_left_child(predicate_node_0);
+
+  const auto root_node = std::make_shared<LogicalPlanRootNode>();
+  root_node->set_left_child(predicate_node_1);
+
+  EXPECT_FALSE(_rule->apply_to(root_node));
+  EXPECT_EQ(root_node->left_child(), predicate_node_1);
+  EXPECT_EQ(predicate_node_0->left_child(), cross_join_node_1);
+  EXPECT_EQ(cross_join_node_0->right_child(), aggregate_node);
+}
+
+TEST_F(JoinOrderingRuleTest, LargeJoinGraphsAreOrderedGreedily) {
+  /**
+   * A chain of cross joins over more relations than JoinOrderingRule::MAX_RELATION_COUNT_FOR_DP, with predicates
+   * between neighboring relations, gets converted to inner joins only. Applying the rule once more does not change
+   * the LQP anymore.
+   */
+  const auto relation_count = JoinOrderingRule::MAX_RELATION_COUNT_FOR_DP + 2;
+
+  auto node = std::shared_ptr<AbstractLQPNode>{_create_mock_node(100, {100})};
+  for (auto relation = size_t{1}; relation < relation_count; ++relation) {
+    const auto cross_join_node = std::make_shared<JoinNode>(JoinMode::Cross);
+    cross_join_node->set_left_child(node);
+    cross_join_node->set_right_child(_create_mock_node(100.0f * (relation % 3 + 1), {100.0f * (relation % 3 + 1)}));
+    node = cross_join_node;
+  }
+
+  for (auto relation = size_t{1}; relation < relation_count; ++relation) {
+    const auto predicate_node = std::make_shared<PredicateNode>(
+        ColumnID{static_cast<ColumnID::base_type>(relation - 1)}, ScanType::OpEquals,
+        ColumnID{static_cast<ColumnID::base_type>(relation)});
+    predicate_node->set_left_child(node);
+    node = predicate_node;
+  }
+
+  const auto root_node = std::make_shared<LogicalPlanRootNode>();
+  root_node->set_left_child(node);
+
+  EXPECT_TRUE(_rule->apply_to(root_node));
+  EXPECT_FALSE(_rule->apply_to(root_node));
+
+  EXPECT_EQ(_count_joins(root_node, JoinMode::Cross), 0u);
+  EXPECT_EQ(_count_joins(root_node, JoinMode::Inner), relation_count - 1);
+  EXPECT_EQ(root_node->left_child()->output_column_count(), relation_count);
+}
+
+}  // namespace opossum
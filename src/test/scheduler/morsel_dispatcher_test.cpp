@@ -0,0 +1,114 @@
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class MorselDispatcherTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunks of 5, 5, and 2 rows
+    _table = std::make_shared<Table>(5);
+    _table->add_column("a", DataType::Int);
+    for (auto i = 0; i < 12; ++i) _table->append({i});
+  }
+
+  static void expect_ranges(const Morsel& morsel, const std::vector<ChunkRange>& ranges) {
+    ASSERT_EQ(morsel.ranges.size(), ranges.size());
+    for (auto index = size_t{0}; index < ranges.size(); ++index) {
+      EXPECT_EQ(morsel.ranges[index].chunk_id, ranges[index].chunk_id);
+      EXPECT_EQ(morsel.ranges[index].begin, ranges[index].begin);
+      EXPECT_EQ(morsel.ranges[index].end, ranges[index].end);
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(MorselDispatcherTest, SplitsAndCombinesChunks) {
+  const auto dispatcher = MorselDispatcher{*_table, 4u};
+  const auto& morsels = dispatcher.morsels();
+
+  ASSERT_EQ(morsels.size(), 3u);
+  expect_ranges(morsels[0], {{ChunkID{0}, 0, 4}});
+  expect_ranges(morsels[1], {{ChunkID{0}, 4, 5}, {ChunkID{1}, 0, 3}});
+  expect_ranges(morsels[2], {{ChunkID{1}, 3, 5}, {ChunkID{2}, 0, 2}});
+  EXPECT_EQ(morsels[2].row_count(), 4u);
+}
+
+TEST_F(MorselDispatcherTest, SkipsEmptyAndExcludedChunks) {
+  _table->create_new_chunk();
+
+  const auto dispatcher = MorselDispatcher{*_table, {ChunkID{0}, ChunkID{2}, ChunkID{3}}, 10u};
+  const auto& morsels = dispatcher.morsels();
+
+  ASSERT_EQ(morsels.size(), 1u);
+  expect_ranges(morsels[0], {{ChunkID{0}, 0, 5}, {ChunkID{2}, 0, 2}});
+}
+
+TEST_F(MorselDispatcherTest, RangeColumns) {
+  const auto full_range = ChunkRange{ChunkID{1}, 0, 5};
+  EXPECT_TRUE(full_range.covers_chunk(*_table));
+  EXPECT_EQ(full_range.column(_table, ColumnID{0}), _table->get_chunk(ChunkID{1}).get_column(ColumnID{0}));
+
+  // The i-th value of a partial range's column is the value at begin + i
+  const auto partial_range = ChunkRange{ChunkID{1}, 2, 4};
+  EXPECT_FALSE(partial_range.covers_chunk(*_table));
+  const auto column = partial_range.column(_table, ColumnID{0});
+  ASSERT_NE(std::dynamic_pointer_cast<const ReferenceColumn>(column), nullptr);
+  ASSERT_EQ(column->size(), 2u);
+  EXPECT_EQ((*column)[0], AllTypeVariant{7});
+  EXPECT_EQ((*column)[1], AllTypeVariant{8});
+
+  // Ranges of ReferenceColumns slice their PosList
+  const auto pos_list =
+      std::make_shared<PosList>(PosList{RowID{ChunkID{2}, 1}, RowID{ChunkID{0}, 3}, RowID{ChunkID{1}, 0}});
+  const auto reference_column = std::make_shared<ReferenceColumn>(_table, ColumnID{0}, pos_list);
+  auto reference_table = std::make_shared<Table>();
+  reference_table->add_column_definition("a", DataType::Int);
+  auto chunk = Chunk{};
+  chunk.add_column(reference_column);
+  reference_table->emplace_chunk(std::move(chunk));
+
+  const auto sliced_column = ChunkRange{ChunkID{0}, 1, 3}.column(reference_table, ColumnID{0});
+  ASSERT_EQ(sliced_column->size(), 2u);
+  EXPECT_EQ((*sliced_column)[0], AllTypeVariant{3});
+  EXPECT_EQ((*sliced_column)[1], AllTypeVariant{5});
+}
+
+TEST_F(MorselDispatcherTest, ProcessesEachMorselOnce) {
+  auto dispatcher = MorselDispatcher{*_table, 1u};
+  ASSERT_EQ(dispatcher.morsels().size(), 12u);
+
+  // Without a scheduler, the morsels are processed in order
+  auto morsel_ids = std::vector<size_t>{};
+  dispatcher.process([&](const size_t morsel_id, const Morsel&) { morsel_ids.emplace_back(morsel_id); });
+  ASSERT_EQ(morsel_ids.size(), 12u);
+  for (auto index = size_t{0}; index < morsel_ids.size(); ++index) EXPECT_EQ(morsel_ids[index], index);
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  auto scheduled_dispatcher = MorselDispatcher{*_table, 1u};
+  auto process_counts = std::vector<std::atomic_uint>(scheduled_dispatcher.morsels().size());
+  scheduled_dispatcher.process([&](const size_t morsel_id, const Morsel& morsel) {
+    EXPECT_EQ(morsel.row_count(), 1u);
+    ++process_counts[morsel_id];
+  });
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  for (const auto& process_count : process_counts) EXPECT_EQ(process_count, 1u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/query_group.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class QueryGroupTest : public BaseTest {
+ protected:
+  void TearDown() override {
+    QueryGroup::set_current(nullptr);
+    BaseTest::TearDown();
+  }
+};
+
+TEST_F(QueryGroupTest, TasksInheritCurrentGroup) {
+  EXPECT_EQ(QueryGroup::current(), nullptr);
+  EXPECT_EQ(std::make_shared<JobTask>([]() {})->query_group(), nullptr);
+
+  const auto query_group = std::make_shared<QueryGroup>(SchedulePriority::Low);
+  EXPECT_EQ(QueryGroup::set_current(query_group), nullptr);
+
+  auto task = std::make_shared<JobTask>([]() {});
+  EXPECT_EQ(task->query_group(), query_group);
+  QueryGroup::set_current(nullptr);
+
+  // Tasks created by a task belong to its group
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+
+  auto nested_query_group = std::shared_ptr<QueryGroup>{};
+  auto outer_task = std::make_shared<JobTask>([&]() {
+    auto nested_task = std::make_shared<JobTask>([]() {});
+    nested_query_group = nested_task->query_group();
+    nested_task->schedule();
+    nested_task->join();
+  });
+  outer_task->set_query_group(query_group);
+  outer_task->schedule();
+  outer_task->join();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_EQ(nested_query_group, query_group);
+  EXPECT_EQ(QueryGroup::current(), nullptr);
+  EXPECT_EQ(query_group->active_worker_count(), 0u);
+}
+
+TEST_F(QueryGroupTest, TasksKeepTheirScheduledPriority) {
+  // Workers defer tasks with the priority they were scheduled with, so it must not be replaced by that of the group
+  const auto query_group = std::make_shared<QueryGroup>(SchedulePriority::Low);
+
+  auto normal_task = std::make_shared<JobTask>([]() {});
+  normal_task->set_query_group(query_group);
+  normal_task->schedule();
+  EXPECT_EQ(normal_task->priority(), SchedulePriority::Low);
+
+  auto unstealable_task = std::make_shared<JobTask>([]() {});
+  unstealable_task->set_query_group(query_group);
+  unstealable_task->schedule(CURRENT_NODE_ID, SchedulePriority::Unstealable);
+  EXPECT_EQ(unstealable_task->priority(), SchedulePriority::Unstealable);
+}
+
+TEST_F(QueryGroupTest, FairShareAndMaxWorkerCount) {
+  auto small_group = QueryGroup{SchedulePriority::High, 1u};
+  auto large_group = QueryGroup{SchedulePriority::Low, 3u};
+  auto limited_group = QueryGroup{SchedulePriority::Normal, 1u, 2u};
+
+  // Alone, a group may use all Workers
+  EXPECT_TRUE(small_group.try_acquire_worker(8u, true));
+
+  // Competing with small_group, large_group gets 3/4 of the Workers
+  for (auto worker_count = 0u; worker_count < 6u; ++worker_count) {
+    EXPECT_TRUE(large_group.try_acquire_worker(8u, true));
+  }
+  EXPECT_FALSE(large_group.try_acquire_worker(8u, true));
+  EXPECT_TRUE(large_group.try_acquire_worker(8u, false));
+
+  // ... and small_group 1/4
+  EXPECT_TRUE(small_group.try_acquire_worker(8u, true));
+  EXPECT_FALSE(small_group.try_acquire_worker(8u, true));
+
+  // The maximum number of Workers holds regardless of the fair share
+  large_group.release_worker();
+  EXPECT_TRUE(limited_group.try_acquire_worker(8u, false));
+  EXPECT_TRUE(limited_group.try_acquire_worker(8u, false));
+  EXPECT_FALSE(limited_group.try_acquire_worker(8u, false));
+  EXPECT_EQ(limited_group.active_worker_count(), 2u);
+
+  for (auto worker_count = 0u; worker_count < 2u; ++worker_count) small_group.release_worker();
+  for (auto worker_count = 0u; worker_count < 6u; ++worker_count) large_group.release_worker();
+  for (auto worker_count = 0u; worker_count < 2u; ++worker_count) limited_group.release_worker();
+
+  // Once the other groups are idle, a group may use all Workers again
+  for (auto worker_count = 0u; worker_count < 8u; ++worker_count) {
+    EXPECT_TRUE(small_group.try_acquire_worker(8u, true));
+  }
+  EXPECT_FALSE(small_group.try_acquire_worker(8u, true));
+  for (auto worker_count = 0u; worker_count < 8u; ++worker_count) small_group.release_worker();
+}
+
+TEST_F(QueryGroupTest, MaxWorkerCountLimitsConcurrency) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  const auto query_group = std::make_shared<QueryGroup>(SchedulePriority::Normal, 1u, 1u);
+  auto running_task_count = std::atomic_uint{0};
+  auto max_running_task_count = std::atomic_uint{0};
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_index = 0u; task_index < 16u; ++task_index) {
+    tasks.emplace_back(std::make_shared<JobTask>([&]() {
+      const auto count = ++running_task_count;
+      auto max_count = max_running_task_count.load();
+      while (count > max_count && !max_running_task_count.compare_exchange_weak(max_count, count)) {
+      }
+
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+      --running_task_count;
+    }));
+    tasks.back()->set_query_group(query_group);
+    tasks.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(tasks);
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_EQ(max_running_task_count, 1u);
+  EXPECT_EQ(query_group->active_worker_count(), 0u);
+}
+
+TEST_F(QueryGroupTest, UrgentTasksPreemptMorsels) {
+  // With a single Worker, an urgent task can only run between two morsels
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(1, 1)));
+
+  auto table = std::make_shared<Table>();
+  table->add_column("a", DataType::Int);
+  for (auto i = 0; i < 4; ++i) table->append({i});
+
+  const auto urgent_group = std::make_shared<QueryGroup>(SchedulePriority::High);
+  auto first_morsel_started = std::atomic_bool{false};
+  auto urgent_task_scheduled = std::atomic_bool{false};
+  auto processed_morsel_count = std::atomic_uint{0};
+  auto processed_morsel_count_before_urgent_task = std::atomic_uint{0};
+  auto urgent_task = std::make_shared<JobTask>(
+      [&]() { processed_morsel_count_before_urgent_task = processed_morsel_count.load(); });
+  urgent_task->set_query_group(urgent_group);
+
+  auto client = std::thread{[&]() {
+    while (!first_morsel_started) std::this_thread::yield();
+    urgent_task->schedule();
+    urgent_task_scheduled = true;
+  }};
+
+  QueryGroup::set_current(std::make_shared<QueryGroup>(SchedulePriority::Low));
+  auto dispatcher = MorselDispatcher{*table, 1u};
+  dispatcher.process([&](const size_t morsel_id, const Morsel&) {
+    if (morsel_id == 0u) {
+      first_morsel_started = true;
+      while (!urgent_task_scheduled) std::this_thread::yield();
+    }
+    ++processed_morsel_count;
+  });
+
+  client.join();
+  urgent_task->join();
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_EQ(processed_morsel_count, 4u);
+  EXPECT_EQ(processed_morsel_count_before_urgent_task, 1u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,130 @@
+#include <atomic>
+#include <memory>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  static std::vector<std::shared_ptr<AbstractTask>> create_tasks(size_t count) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto i = size_t{0}; i < count; ++i) {
+      tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    return tasks;
+  }
+};
+
+TEST_F(WorkStealingDequeTest, OwnerPopsLifoAndThievesStealFifo) {
+  auto deque = WorkStealingDeque{};
+  const auto tasks = create_tasks(3u);
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+
+  for (const auto& task : tasks) deque.push(task);
+  EXPECT_FALSE(deque.empty());
+
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.pop(), tasks[1]);
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(WorkStealingDequeTest, GrowsWhenFull) {
+  auto deque = WorkStealingDeque{2u};
+  const auto tasks = create_tasks(100u);
+
+  // Interleave stealing, so that the tasks wrap around the end of the buffer before it grows
+  deque.push(tasks[0]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+
+  for (auto index = size_t{1}; index < tasks.size(); ++index) deque.push(tasks[index]);
+  for (auto index = tasks.size() - 1u; index > 0u; --index) EXPECT_EQ(deque.pop(), tasks[index]);
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, ReleasesRemainingTasks) {
+  auto task = std::shared_ptr<AbstractTask>{std::make_shared<JobTask>([]() {})};
+  {
+    auto deque = WorkStealingDeque{};
+    deque.push(task);
+    EXPECT_EQ(task.use_count(), 2);
+  }
+  EXPECT_EQ(task.use_count(), 1);
+}
+
+TEST_F(WorkStealingDequeTest, EachTaskIsTakenExactlyOnce) {
+  constexpr auto task_count = size_t{20'000};
+  constexpr auto thief_count = 3u;
+
+  auto deque = WorkStealingDeque{4u};
+  const auto tasks = create_tasks(task_count);
+
+  // Counts how often each task was taken, identified by its position in tasks
+  auto positions = std::unordered_map<std::shared_ptr<AbstractTask>, size_t>{};
+  for (auto index = size_t{0}; index < task_count; ++index) positions[tasks[index]] = index;
+
+  auto taken = std::vector<std::atomic_uint>(task_count);
+  const auto take = [&](const std::shared_ptr<AbstractTask>& task) { ++taken[positions.at(task)]; };
+
+  auto owner_done = std::atomic_bool{false};
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief = 0u; thief < thief_count; ++thief) {
+    thieves.emplace_back([&]() {
+      while (!owner_done || !deque.empty()) {
+        const auto task = deque.steal();
+        if (task) take(task);
+      }
+    });
+  }
+
+  for (auto index = size_t{0}; index < task_count; ++index) {
+    deque.push(tasks[index]);
+    if (index % 3u == 0u) {
+      const auto task = deque.pop();
+      if (task) take(task);
+    }
+  }
+  owner_done = true;
+
+  for (auto& thief : thieves) thief.join();
+
+  for (auto index = size_t{0}; index < task_count; ++index) {
+    EXPECT_EQ(taken[index], 1u);
+  }
+}
+
+TEST_F(WorkStealingDequeTest, UnregisteredDequesAreNotStolenFrom) {
+  auto queue = TaskQueue{NodeID{0}};
+  auto random_engine = std::minstd_rand{};
+  auto deque = std::make_shared<WorkStealingDeque>();
+  const auto tasks = create_tasks(2u);
+
+  queue.register_worker_deque(deque);
+  for (const auto& task : tasks) deque->push(task);
+  EXPECT_EQ(queue.steal_from_workers(random_engine), tasks[0]);
+
+  // The remaining task is moved to the queue instead of being lost with the deque
+  queue.unregister_worker_deque(deque);
+  EXPECT_TRUE(deque->empty());
+  EXPECT_EQ(queue.steal_from_workers(random_engine), nullptr);
+  EXPECT_EQ(queue.pull(), tasks[1]);
+  EXPECT_TRUE(queue.empty());
+}
+
+}  // namespace opossum
@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 
 #include "../lib/storage/base_column.hpp"
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
 #include "../lib/storage/dictionary_column.hpp"
 #include "../lib/storage/dictionary_compression.hpp"
 #include "../lib/storage/fitted_attribute_vector.hpp"
@@ -148,10 +149,55 @@ TEST_F(StorageDictionaryColumnTest, LowerUpperBound) {
   EXPECT_EQ(dict_col->upper_bound(AllTypeVariant(15)), INVALID_VALUE_ID);
 }
 
+TEST_F(StorageDictionaryColumnTest, LowerUpperBoundString) {
+  for (const auto& value : {"Bill", "Steve", "", "Alexander", "Hasso", "Bill"}) vc_str->append(value);
+
+  auto col = DictionaryCompression::compress_column(DataType::String, vc_str);
+  auto dict_col = std::dynamic_pointer_cast<DictionaryColumn<std::string>>(col);
+
+  EXPECT_EQ(dict_col->lower_bound(std::string{}), (ValueID)0);
+  EXPECT_EQ(dict_col->upper_bound(std::string{}), (ValueID)1);
+
+  EXPECT_EQ(dict_col->lower_bound(std::string{"Bill"}), (ValueID)2);
+  EXPECT_EQ(dict_col->upper_bound(std::string{"Bill"}), (ValueID)3);
+
+  EXPECT_EQ(dict_col->lower_bound(std::string{"Bob"}), (ValueID)3);
+  EXPECT_EQ(dict_col->upper_bound(std::string{"Bob"}), (ValueID)3);
+
+  EXPECT_EQ(dict_col->lower_bound(AllTypeVariant{std::string{"Steve"}}), (ValueID)4);
+  EXPECT_EQ(dict_col->upper_bound(AllTypeVariant{std::string{"Steve"}}), INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col->lower_bound(std::string{"Zed"}), INVALID_VALUE_ID);
+
+  EXPECT_EQ(dict_col->value_by_value_id(ValueID{3}), "Hasso");
+}
+
+TEST_F(StorageDictionaryColumnTest, StringDictionaryIsContiguous) {
+  for (const auto& value : {"ccc", "a", "", "bb", "a"}) vc_str->append(value);
+
+  auto col = DictionaryCompression::compress_column(DataType::String, vc_str);
+  auto dict_col = std::dynamic_pointer_cast<DictionaryColumn<std::string>>(col);
+  const auto& dictionary = *dict_col->dictionary();
+
+  EXPECT_EQ(dictionary.size(), 4u);
+  EXPECT_EQ(std::string(dictionary.characters().cbegin(), dictionary.characters().cend()), "abbccc");
+  EXPECT_EQ(dictionary.offsets(), (pmr_vector<uint32_t>{0u, 0u, 1u, 3u, 6u}));
+  EXPECT_EQ(dictionary.view(2u), "bb");
+  EXPECT_EQ(dictionary[0u], "");
+
+  EXPECT_EQ(dict_col->get(0u), "ccc");
+  EXPECT_EQ(dict_col->get(2u), "");
+  EXPECT_EQ(dict_col->get(4u), "a");
+
+  const auto copied_col = std::dynamic_pointer_cast<DictionaryColumn<std::string>>(dict_col->copy_using_allocator({}));
+  EXPECT_EQ(copied_col->dictionary()->characters(), dictionary.characters());
+  EXPECT_EQ(copied_col->get(3u), "bb");
+}
+
 TEST_F(StorageDictionaryColumnTest, FittedAttributeVectorSize) {
-  vc_int->append(0);
-  vc_int->append(1);
-  vc_int->append(2);
+  // 255 values plus NULL need exactly 8 bits
+  for (int i = 0; i < 255; ++i) {
+    vc_int->append(i);
+  }
 
   auto col = DictionaryCompression::compress_column(DataType::Int, vc_int);
   auto dict_col = std::dynamic_pointer_cast<DictionaryColumn<int>>(col);
@@ -163,7 +209,8 @@ TEST_F(StorageDictionaryColumnTest, FittedAttributeVectorSize) {
   EXPECT_NE(attribute_vector_uint8_t, nullptr);
   EXPECT_EQ(attribute_vector_uint16_t, nullptr);
 
-  for (int i = 3; i < 257; ++i) {
+  // 65535 values plus NULL need exactly 16 bits
+  for (int i = 255; i < 65535; ++i) {
     vc_int->append(i);
   }
 
@@ -178,4 +225,60 @@ TEST_F(StorageDictionaryColumnTest, FittedAttributeVectorSize) {
   EXPECT_NE(attribute_vector_uint16_t, nullptr);
 }
 
+TEST_F(StorageDictionaryColumnTest, BitPackedAttributeVectorSize) {
+  vc_int->append(0);
+  vc_int->append(1);
+  vc_int->append(2);
+
+  auto col = DictionaryCompression::compress_column(DataType::Int, vc_int);
+  auto dict_col = std::dynamic_pointer_cast<DictionaryColumn<int>>(col);
+  auto attribute_vector = std::dynamic_pointer_cast<const BitPackedAttributeVector>(dict_col->attribute_vector());
+
+  ASSERT_NE(attribute_vector, nullptr);
+  EXPECT_EQ(attribute_vector->bit_width(), 2u);
+  EXPECT_EQ(attribute_vector->width(), 1u);
+
+  for (int i = 3; i < 300; ++i) {
+    vc_int->append(i);
+  }
+
+  col = DictionaryCompression::compress_column(DataType::Int, vc_int);
+  dict_col = std::dynamic_pointer_cast<DictionaryColumn<int>>(col);
+  attribute_vector = std::dynamic_pointer_cast<const BitPackedAttributeVector>(dict_col->attribute_vector());
+
+  ASSERT_NE(attribute_vector, nullptr);
+  EXPECT_EQ(attribute_vector->bit_width(), 9u);
+  EXPECT_EQ(attribute_vector->width(), 2u);
+
+  for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < 300u; ++chunk_offset) {
+    EXPECT_EQ(dict_col->get(chunk_offset), static_cast<int>(chunk_offset));
+  }
+}
+
+TEST_F(StorageDictionaryColumnTest, BitPackedAttributeVectorSetAndDecode) {
+  // Use a width that makes values span two words and a size that ends in a partial block
+  auto attribute_vector = BitPackedAttributeVector{300u, 7u};
+
+  for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < 300u; ++chunk_offset) {
+    attribute_vector.set(chunk_offset, chunk_offset % 5u == 0u ? NULL_VALUE_ID : ValueID{chunk_offset % 127u});
+  }
+
+  // Overwriting must not affect neighbouring values
+  attribute_vector.set(ChunkOffset{42u}, ValueID{126u});
+  attribute_vector.set(ChunkOffset{42u}, ValueID{3u});
+
+  auto block = BitPackedAttributeVector::Block{};
+  for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < 300u; ++chunk_offset) {
+    const auto expected_value_id =
+        chunk_offset == 42u ? ValueID{3u} : chunk_offset % 5u == 0u ? NULL_VALUE_ID : ValueID{chunk_offset % 127u};
+
+    if (chunk_offset % BitPackedAttributeVector::block_size == 0u) {
+      attribute_vector.decode_block(chunk_offset / BitPackedAttributeVector::block_size, block);
+    }
+
+    EXPECT_EQ(attribute_vector.get(chunk_offset), expected_value_id);
+    EXPECT_EQ(ValueID{block[chunk_offset % BitPackedAttributeVector::block_size]}, expected_value_id);
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,256 @@
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/base_column.hpp"
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/dictionary_compression.hpp"
+#include "../lib/storage/frame_of_reference_column.hpp"
+#include "../lib/storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "../lib/storage/index/group_key/composite_group_key_index.hpp"
+#include "../lib/storage/index/group_key/group_key_index.hpp"
+#include "../lib/storage/iterables/create_iterable_from_column.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceColumnTest : public BaseTest {
+ protected:
+  static constexpr auto frame_size = BaseFrameOfReferenceColumn::frame_size;
+
+  std::shared_ptr<ValueColumn<int>> vc_int = std::make_shared<ValueColumn<int>>(true);
+  std::shared_ptr<ValueColumn<int64_t>> vc_long = std::make_shared<ValueColumn<int64_t>>();
+};
+
+TEST_F(StorageFrameOfReferenceColumnTest, CompressUniqueColumn) {
+  // Two and a half frames of distinct values, the second frame is shifted far away from the first
+  for (auto index = 0; index < static_cast<int>(frame_size * 5 / 2); ++index) {
+    vc_int->append(index < static_cast<int>(frame_size) ? index : 1'000'000 + index);
+  }
+
+  auto col = DictionaryCompression::compress_column_adaptively(DataType::Int, vc_int);
+  auto for_col = std::dynamic_pointer_cast<FrameOfReferenceColumn<int>>(col);
+  ASSERT_NE(for_col, nullptr);
+
+  EXPECT_EQ(for_col->size(), frame_size * 5 / 2);
+  EXPECT_EQ(for_col->frame_count(), 3u);
+  EXPECT_EQ(*for_col->minima(), (pmr_vector<int>{0, 1'000'000 + 2048, 1'000'000 + 4096}));
+  EXPECT_EQ(*for_col->maxima(), (pmr_vector<int>{2047, 1'000'000 + 4095, 1'000'000 + 5119}));
+
+  // 2047 is the largest offset, 2048 is reserved for null
+  EXPECT_EQ(for_col->offsets()->bit_width(), 12u);
+
+  EXPECT_EQ(for_col->get(0u), 0);
+  EXPECT_EQ(for_col->get(2047u), 2047);
+  EXPECT_EQ(for_col->get(2048u), 1'002'048);
+  EXPECT_EQ((*for_col)[5119u], AllTypeVariant{1'005'119});
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, CompressColumnStillCreatesDictionary) {
+  for (auto index = 0; index < static_cast<int>(frame_size); ++index) vc_int->append(index);
+
+  auto col = DictionaryCompression::compress_column(DataType::Int, vc_int);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<int>>(col), nullptr);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, DoNotCompressShortOrRepetitiveColumns) {
+  for (auto index = 0; index < 100; ++index) vc_int->append(index);
+
+  auto short_col = DictionaryCompression::compress_column_adaptively(DataType::Int, vc_int);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<int>>(short_col), nullptr);
+
+  auto vc_repetitive = std::make_shared<ValueColumn<int>>();
+  for (auto index = 0; index < static_cast<int>(frame_size * 2); ++index) vc_repetitive->append(index % 1000);
+
+  auto repetitive_col = DictionaryCompression::compress_column_adaptively(DataType::Int, vc_repetitive);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<int>>(repetitive_col), nullptr);
+
+  auto vc_float = std::make_shared<ValueColumn<float>>();
+  for (auto index = 0; index < static_cast<int>(frame_size); ++index) vc_float->append(static_cast<float>(index));
+
+  auto float_col = DictionaryCompression::compress_column_adaptively(DataType::Float, vc_float);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<float>>(float_col), nullptr);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, DoNotCompressWideFrames) {
+  // The range of the frame does not fit into 32 bit offsets
+  vc_long->append(std::numeric_limits<int64_t>::min());
+  for (auto index = int64_t{1}; index < static_cast<int64_t>(frame_size); ++index) vc_long->append(index);
+
+  auto col = DictionaryCompression::compress_column_adaptively(DataType::Long, vc_long);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<int64_t>>(col), nullptr);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, CompressNegativeLongs) {
+  const auto base = int64_t{-5'000'000'000};
+  for (auto index = int64_t{0}; index < static_cast<int64_t>(frame_size); ++index) vc_long->append(base - index * 3);
+
+  auto col = DictionaryCompression::compress_column_adaptively(DataType::Long, vc_long);
+  auto for_col = std::dynamic_pointer_cast<FrameOfReferenceColumn<int64_t>>(col);
+  ASSERT_NE(for_col, nullptr);
+
+  EXPECT_EQ(for_col->minima()->front(), base - 2047 * 3);
+  EXPECT_EQ(for_col->maxima()->front(), base);
+  EXPECT_EQ(for_col->get(0u), base);
+  EXPECT_EQ(for_col->get(2047u), base - 2047 * 3);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, NullValues) {
+  for (auto index = 0; index < static_cast<int>(frame_size); ++index) {
+    if (index % 100 == 0) {
+      vc_int->append(NULL_VALUE);
+    } else {
+      vc_int->append(-index);
+    }
+  }
+
+  // The second frame only contains nulls
+  for (auto index = 0; index < 10; ++index) vc_int->append(NULL_VALUE);
+
+  auto col = DictionaryCompression::compress_column_adaptively(DataType::Int, vc_int);
+  auto for_col = std::dynamic_pointer_cast<FrameOfReferenceColumn<int>>(col);
+  ASSERT_NE(for_col, nullptr);
+
+  EXPECT_TRUE(for_col->is_null(0u));
+  EXPECT_TRUE(variant_is_null((*for_col)[100u]));
+  EXPECT_FALSE(for_col->is_null(1u));
+  EXPECT_EQ(for_col->get(1u), -1);
+  EXPECT_TRUE(for_col->is_null(frame_size + 9u));
+
+  const auto values = for_col->materialize_values();
+  ASSERT_EQ(values.size(), frame_size + 10u);
+  EXPECT_FALSE(values[200]);
+  EXPECT_EQ(values[2047], -2047);
+  EXPECT_FALSE(values[frame_size]);
+
+  EXPECT_THROW(for_col->append(3), std::logic_error);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, CompressChunk) {
+  auto vc_str = std::make_shared<ValueColumn<std::string>>();
+  for (auto index = 0; index < static_cast<int>(frame_size); ++index) {
+    vc_int->append(index * 7);
+    vc_str->append(std::to_string(index));
+  }
+
+  auto chunk = Chunk{};
+  chunk.add_column(vc_int);
+  chunk.add_column(vc_str);
+
+  DictionaryCompression::compress_chunk({DataType::Int, DataType::String}, chunk);
+
+  EXPECT_NE(std::dynamic_pointer_cast<const FrameOfReferenceColumn<int>>(chunk.get_column(ColumnID{0})), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<const DictionaryColumn<std::string>>(chunk.get_column(ColumnID{1})), nullptr);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, CompressChunkForIndexes) {
+  // A unique key column would be stored as FrameOfReferenceColumn unless dictionary encoding is requested
+  for (auto index = 0; index < static_cast<int>(frame_size); ++index) vc_int->append(index * 7);
+
+  auto chunk = Chunk{};
+  chunk.add_column(vc_int);
+
+  DictionaryCompression::compress_chunk({DataType::Int}, chunk, EncodingSelection::DictionaryOnly);
+  ASSERT_NE(std::dynamic_pointer_cast<const DictionaryColumn<int>>(chunk.get_column(ColumnID{0})), nullptr);
+
+  const auto indexes = std::vector<std::shared_ptr<BaseIndex>>{
+      chunk.create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}}),
+      chunk.create_index<CompositeGroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}}),
+      chunk.create_index<AdaptiveRadixTreeIndex>(std::vector<ColumnID>{ColumnID{0}})};
+
+  for (const auto& index : indexes) {
+    EXPECT_EQ(std::distance(index->cbegin(), index->cend()), static_cast<std::ptrdiff_t>(frame_size));
+
+    const auto lower = index->lower_bound({700});
+    ASSERT_NE(lower, index->cend());
+    EXPECT_EQ(*lower, ChunkOffset{100});
+    EXPECT_EQ(std::distance(lower, index->upper_bound({700})), 1);
+  }
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, IndexesRejectFrameOfReferenceColumns) {
+  for (auto index = 0; index < static_cast<int>(frame_size); ++index) vc_int->append(index * 7);
+
+  auto chunk = Chunk{};
+  chunk.add_column(vc_int);
+
+  DictionaryCompression::compress_chunk({DataType::Int}, chunk);
+  ASSERT_NE(std::dynamic_pointer_cast<const FrameOfReferenceColumn<int>>(chunk.get_column(ColumnID{0})), nullptr);
+
+  EXPECT_THROW(chunk.create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}}), std::logic_error);
+  EXPECT_THROW(chunk.create_index<CompositeGroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}}), std::logic_error);
+  EXPECT_THROW(chunk.create_index<AdaptiveRadixTreeIndex>(std::vector<ColumnID>{ColumnID{0}}), std::logic_error);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, Iterate) {
+  for (auto index = 0; index < static_cast<int>(frame_size + 5); ++index) {
+    if (index == 1000) {
+      vc_int->append(NULL_VALUE);
+    } else {
+      vc_int->append(index * 2);
+    }
+  }
+
+  auto col = DictionaryCompression::compress_column_adaptively(DataType::Int, vc_int);
+  auto for_col = std::dynamic_pointer_cast<FrameOfReferenceColumn<int>>(col);
+  ASSERT_NE(for_col, nullptr);
+
+  auto iterable = create_iterable_from_column(*for_col);
+
+  auto nulls = 0u;
+  auto chunk_offset = ChunkOffset{0u};
+  iterable.for_each([&](const auto& value) {
+    EXPECT_EQ(value.chunk_offset(), chunk_offset);
+    if (value.is_null()) {
+      ++nulls;
+    } else {
+      EXPECT_EQ(value.value(), static_cast<int>(chunk_offset * 2));
+    }
+    ++chunk_offset;
+  });
+
+  EXPECT_EQ(chunk_offset, frame_size + 5u);
+  EXPECT_EQ(nulls, 1u);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, IterateWithChunkOffsetsList) {
+  for (auto index = 0; index < static_cast<int>(frame_size + 5); ++index) {
+    if (index == 1000) {
+      vc_int->append(NULL_VALUE);
+    } else {
+      vc_int->append(index * 2);
+    }
+  }
+
+  auto col = DictionaryCompression::compress_column_adaptively(DataType::Int, vc_int);
+  auto for_col = std::dynamic_pointer_cast<FrameOfReferenceColumn<int>>(col);
+  ASSERT_NE(for_col, nullptr);
+
+  auto chunk_offsets =
+      ChunkOffsetsList{{0u, 2050u}, {1u, 1u}, {2u, 1000u}, {3u, INVALID_CHUNK_OFFSET}, {4u, 2047u}};
+
+  auto iterable = create_iterable_from_column(*for_col);
+
+  auto values = std::vector<int>{};
+  auto nulls = 0u;
+  iterable.for_each(&chunk_offsets, [&](const auto& value) {
+    if (value.is_null()) {
+      ++nulls;
+      return;
+    }
+    values.push_back(value.value());
+  });
+
+  EXPECT_EQ(values, (std::vector<int>{4100, 2, 4094}));
+  EXPECT_EQ(nulls, 2u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,165 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/base_column.hpp"
+#include "../lib/storage/iterables/create_iterable_from_column.hpp"
+#include "../lib/storage/run_length_column.hpp"
+#include "../lib/storage/run_length_encoding.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageRunLengthColumnTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueColumn<int>> vc_int = std::make_shared<ValueColumn<int>>(true);
+  std::shared_ptr<ValueColumn<std::string>> vc_str = std::make_shared<ValueColumn<std::string>>();
+};
+
+TEST_F(StorageRunLengthColumnTest, EncodeColumnInt) {
+  vc_int->append(4);
+  vc_int->append(4);
+  vc_int->append(NULL_VALUE);
+  vc_int->append(NULL_VALUE);
+  vc_int->append(4);
+  vc_int->append(3);
+
+  auto col = RunLengthEncoding::encode_column(DataType::Int, vc_int);
+  auto rle_col = std::dynamic_pointer_cast<RunLengthColumn<int>>(col);
+  ASSERT_NE(rle_col, nullptr);
+
+  EXPECT_EQ(rle_col->size(), 6u);
+  EXPECT_EQ(rle_col->run_count(), 4u);
+
+  EXPECT_EQ(*rle_col->end_positions(), (pmr_vector<ChunkOffset>{1u, 3u, 4u, 5u}));
+  EXPECT_EQ(*rle_col->null_values(), (pmr_vector<bool>{false, true, false, false}));
+  EXPECT_EQ((*rle_col->values())[0], 4);
+  EXPECT_EQ((*rle_col->values())[2], 4);
+  EXPECT_EQ((*rle_col->values())[3], 3);
+}
+
+TEST_F(StorageRunLengthColumnTest, EncodeColumnString) {
+  vc_str->append("Bill");
+  vc_str->append("Bill");
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+  vc_str->append("Alexander");
+
+  auto col = RunLengthEncoding::encode_column(DataType::String, vc_str);
+  auto rle_col = std::dynamic_pointer_cast<RunLengthColumn<std::string>>(col);
+  ASSERT_NE(rle_col, nullptr);
+
+  EXPECT_EQ(rle_col->size(), 6u);
+  EXPECT_EQ(*rle_col->values(), (pmr_vector<std::string>{"Bill", "Steve", "Alexander"}));
+  EXPECT_EQ(*rle_col->end_positions(), (pmr_vector<ChunkOffset>{2u, 3u, 5u}));
+}
+
+TEST_F(StorageRunLengthColumnTest, EncodeEmptyColumn) {
+  auto col = RunLengthEncoding::encode_column(DataType::Int, vc_int);
+  auto rle_col = std::dynamic_pointer_cast<RunLengthColumn<int>>(col);
+
+  EXPECT_EQ(rle_col->size(), 0u);
+  EXPECT_EQ(rle_col->run_count(), 0u);
+}
+
+TEST_F(StorageRunLengthColumnTest, EncodeEncodedColumn) {
+  vc_int->append(1);
+  auto col = RunLengthEncoding::encode_column(DataType::Int, vc_int);
+
+  EXPECT_THROW(RunLengthEncoding::encode_column(DataType::Int, col), std::logic_error);
+}
+
+TEST_F(StorageRunLengthColumnTest, AccessValues) {
+  for (auto value : {7, 7, 7, 2, 9, 9}) vc_int->append(value);
+  vc_int->append(NULL_VALUE);
+
+  auto col = RunLengthEncoding::encode_column(DataType::Int, vc_int);
+  auto rle_col = std::dynamic_pointer_cast<RunLengthColumn<int>>(col);
+
+  EXPECT_EQ(rle_col->get(0u), 7);
+  EXPECT_EQ(rle_col->get(2u), 7);
+  EXPECT_EQ(rle_col->get(3u), 2);
+  EXPECT_EQ(rle_col->get(5u), 9);
+  EXPECT_EQ((*rle_col)[4u], AllTypeVariant{9});
+  EXPECT_TRUE(variant_is_null((*rle_col)[6u]));
+  EXPECT_FALSE(rle_col->is_null(5u));
+  EXPECT_TRUE(rle_col->is_null(6u));
+
+  EXPECT_THROW(rle_col->append(3), std::logic_error);
+}
+
+TEST_F(StorageRunLengthColumnTest, MaterializeValues) {
+  vc_int->append(1);
+  vc_int->append(NULL_VALUE);
+  vc_int->append(NULL_VALUE);
+  vc_int->append(2);
+  vc_int->append(2);
+
+  auto col = RunLengthEncoding::encode_column(DataType::Int, vc_int);
+  auto rle_col = std::dynamic_pointer_cast<RunLengthColumn<int>>(col);
+
+  const auto values = rle_col->materialize_values();
+  ASSERT_EQ(values.size(), 5u);
+  EXPECT_EQ(values[0], 1);
+  EXPECT_FALSE(values[1]);
+  EXPECT_FALSE(values[2]);
+  EXPECT_EQ(values[3], 2);
+  EXPECT_EQ(values[4], 2);
+}
+
+TEST_F(StorageRunLengthColumnTest, Iterate) {
+  for (auto value : {3, 3, 5, 5, 5, 8}) vc_int->append(value);
+  vc_int->append(NULL_VALUE);
+
+  auto col = RunLengthEncoding::encode_column(DataType::Int, vc_int);
+  auto rle_col = std::dynamic_pointer_cast<RunLengthColumn<int>>(col);
+
+  auto iterable = create_iterable_from_column(*rle_col);
+
+  auto values = std::vector<int>{};
+  auto nulls = 0u;
+  auto chunk_offset = ChunkOffset{0u};
+  iterable.for_each([&](const auto& value) {
+    EXPECT_EQ(value.chunk_offset(), chunk_offset++);
+    if (value.is_null()) {
+      ++nulls;
+      return;
+    }
+    values.push_back(value.value());
+  });
+
+  EXPECT_EQ(values, (std::vector<int>{3, 3, 5, 5, 5, 8}));
+  EXPECT_EQ(nulls, 1u);
+}
+
+TEST_F(StorageRunLengthColumnTest, IterateWithChunkOffsetsList) {
+  for (auto value : {3, 3, 5, 5, 5, 8}) vc_int->append(value);
+  vc_int->append(NULL_VALUE);
+
+  auto col = RunLengthEncoding::encode_column(DataType::Int, vc_int);
+  auto rle_col = std::dynamic_pointer_cast<RunLengthColumn<int>>(col);
+
+  auto chunk_offsets = ChunkOffsetsList{{0u, 5u}, {1u, 1u}, {2u, 6u}, {3u, INVALID_CHUNK_OFFSET}, {4u, 2u}};
+
+  auto iterable = create_iterable_from_column(*rle_col);
+
+  auto values = std::vector<int>{};
+  auto nulls = 0u;
+  iterable.for_each(&chunk_offsets, [&](const auto& value) {
+    if (value.is_null()) {
+      ++nulls;
+      return;
+    }
+    values.push_back(value.value());
+  });
+
+  EXPECT_EQ(values, (std::vector<int>{8, 3, 5}));
+  EXPECT_EQ(nulls, 2u);
+}
+
+}  // namespace opossum
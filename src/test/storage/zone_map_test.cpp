@@ -0,0 +1,184 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_compression.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/storage/zone_map.hpp"
+#include "../lib/utils/bloom_filter.hpp"
+
+namespace opossum {
+
+class StorageZoneMapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto value : {4, 2, 8, 6}) vc_int->append(value);
+    vc_int->append(NULL_VALUE);
+
+    for (auto value : {"Hotel", "Delta", "Foxtrot"}) vc_str->append(value);
+  }
+
+  std::shared_ptr<ValueColumn<int>> vc_int = std::make_shared<ValueColumn<int>>(true);
+  std::shared_ptr<ValueColumn<std::string>> vc_str = std::make_shared<ValueColumn<std::string>>();
+};
+
+TEST_F(StorageZoneMapTest, MinMaxOfValueColumn) {
+  const auto zone_map = std::dynamic_pointer_cast<ZoneMap<int>>(create_zone_map(DataType::Int, *vc_int));
+  ASSERT_NE(zone_map, nullptr);
+
+  EXPECT_EQ(zone_map->minimum(), 2);
+  EXPECT_EQ(zone_map->maximum(), 8);
+  EXPECT_TRUE(zone_map->has_nulls());
+  EXPECT_EQ(zone_map->bloom_filter(), nullptr);
+}
+
+TEST_F(StorageZoneMapTest, MinMaxOfDictionaryColumn) {
+  const auto dict_col = DictionaryCompression::compress_column(DataType::String, vc_str);
+  const auto zone_map = std::dynamic_pointer_cast<ZoneMap<std::string>>(create_zone_map(DataType::String, *dict_col));
+  ASSERT_NE(zone_map, nullptr);
+
+  EXPECT_EQ(zone_map->minimum(), "Delta");
+  EXPECT_EQ(zone_map->maximum(), "Hotel");
+  EXPECT_FALSE(zone_map->has_nulls());
+  ASSERT_NE(zone_map->bloom_filter(), nullptr);
+  EXPECT_TRUE(zone_map->bloom_filter()->contains("Foxtrot"));
+}
+
+TEST_F(StorageZoneMapTest, PruneComparisons) {
+  const auto zone_map = create_zone_map(DataType::Int, *vc_int);
+
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpEquals, 1));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpEquals, 2));
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpEquals, 9));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpNotEquals, 2));
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpLessThan, 2));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpLessThan, 3));
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpLessThanEquals, 1));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpLessThanEquals, 2));
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpGreaterThan, 8));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpGreaterThan, 7));
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpGreaterThanEquals, 9));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpGreaterThanEquals, 8));
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpBetween, 9, AllTypeVariant{12}));
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpBetween, -3, AllTypeVariant{1}));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpBetween, 0, AllTypeVariant{2}));
+
+  // Values of other types are converted to the column type
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpGreaterThan, 8.5f));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpEquals, int64_t{4}));
+}
+
+TEST_F(StorageZoneMapTest, PruneNullPredicates) {
+  const auto int_zone_map = create_zone_map(DataType::Int, *vc_int);
+  EXPECT_FALSE(int_zone_map->can_prune(ScanType::OpEquals, NULL_VALUE));
+  EXPECT_FALSE(int_zone_map->can_prune(ScanType::OpNotEquals, NULL_VALUE));
+
+  const auto str_zone_map = create_zone_map(DataType::String, *vc_str);
+  EXPECT_TRUE(str_zone_map->can_prune(ScanType::OpEquals, NULL_VALUE));
+  EXPECT_FALSE(str_zone_map->can_prune(ScanType::OpNotEquals, NULL_VALUE));
+
+  auto vc_null = std::make_shared<ValueColumn<float>>(true);
+  vc_null->append(NULL_VALUE);
+  const auto null_zone_map = create_zone_map(DataType::Float, *vc_null);
+  EXPECT_FALSE(null_zone_map->can_prune(ScanType::OpEquals, NULL_VALUE));
+  EXPECT_TRUE(null_zone_map->can_prune(ScanType::OpNotEquals, NULL_VALUE));
+  EXPECT_TRUE(null_zone_map->can_prune(ScanType::OpNotEquals, 1.0f));
+}
+
+TEST_F(StorageZoneMapTest, BloomFilterPrunesValuesWithinRange) {
+  const auto dict_col = DictionaryCompression::compress_column(DataType::String, vc_str);
+  const auto zone_map = create_zone_map(DataType::String, *dict_col);
+
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpEquals, "Delta"));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpEquals, "Foxtrot"));
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpEquals, "Alpha"));
+
+  // Values between the minimum and the maximum can only be pruned by the bloom filter, which has false positives
+  auto pruned_count = 0;
+  for (const auto value : {"Echo", "Eagle", "Edge", "Ember", "Epsilon", "Frank", "Gamma", "Golf", "Grape", "Hello"}) {
+    if (zone_map->can_prune(ScanType::OpEquals, value)) ++pruned_count;
+  }
+  EXPECT_GE(pruned_count, 5);
+}
+
+TEST_F(StorageZoneMapTest, BloomFilterTreatsSignedZerosAsEqual) {
+  for (const auto zero : {0.0, -0.0}) {
+    auto vc_double = std::make_shared<ValueColumn<double>>();
+    for (const auto value : {-2.0, zero, 3.0}) vc_double->append(value);
+
+    const auto dict_col = DictionaryCompression::compress_column(DataType::Double, vc_double);
+    const auto zone_map = create_zone_map(DataType::Double, *dict_col);
+
+    EXPECT_FALSE(zone_map->can_prune(ScanType::OpEquals, 0.0));
+    EXPECT_FALSE(zone_map->can_prune(ScanType::OpEquals, -0.0));
+  }
+}
+
+TEST_F(StorageZoneMapTest, CompressChunkCreatesZoneMaps) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::String);
+  table->append({1, "Bravo"});
+  table->append({5, "Alpha"});
+
+  auto& chunk = table->get_chunk(ChunkID{0});
+  EXPECT_EQ(chunk.zone_maps(), nullptr);
+
+  DictionaryCompression::compress_chunks(*table, {ChunkID{0}});
+
+  const auto zone_maps = chunk.zone_maps();
+  ASSERT_NE(zone_maps, nullptr);
+  ASSERT_EQ(zone_maps->columns.size(), 2u);
+  EXPECT_TRUE(zone_maps->columns[0]->can_prune(ScanType::OpGreaterThan, 5));
+  EXPECT_TRUE(zone_maps->columns[1]->can_prune(ScanType::OpLessThan, "Alpha"));
+  EXPECT_EQ(zone_maps->min_begin_cid, 0u);
+}
+
+TEST_F(StorageZoneMapTest, CompressChunkStoresMinBeginCid) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", DataType::Int);
+  table->append({1});
+  table->append({2});
+
+  auto& chunk = table->get_chunk(ChunkID{0});
+  {
+    auto mvcc_columns = chunk.mvcc_columns();
+    mvcc_columns->begin_cids[0] = 7u;
+    mvcc_columns->begin_cids[1] = 4u;
+  }
+
+  DictionaryCompression::compress_chunks(*table, {ChunkID{0}});
+  EXPECT_EQ(chunk.zone_maps()->min_begin_cid, 4u);
+}
+
+TEST_F(StorageZoneMapTest, CompressChunkStoresVisibleFromCid) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", DataType::Int);
+  table->append({1});
+  table->append({2});
+  table->append({3});
+  table->append({4});
+
+  {
+    auto mvcc_columns = table->get_chunk(ChunkID{0}).mvcc_columns();
+    mvcc_columns->begin_cids[0] = 7u;
+    mvcc_columns->begin_cids[1] = 4u;
+  }
+  {
+    // A deleted row
+    auto mvcc_columns = table->get_chunk(ChunkID{1}).mvcc_columns();
+    mvcc_columns->end_cids[1] = 5u;
+  }
+
+  DictionaryCompression::compress_table(*table);
+  EXPECT_EQ(table->get_chunk(ChunkID{0}).zone_maps()->visible_from_cid, 7u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1}).zone_maps()->visible_from_cid, Chunk::MAX_COMMIT_ID);
+}
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include <memory>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -8,7 +9,9 @@
 #include "operators/abstract_join_operator.hpp"
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "scheduler/operator_task.hpp"
 #include "storage/storage_manager.hpp"
 
@@ -64,4 +67,57 @@ TEST_F(OperatorTaskTest, DoubleDependencyTasksFromOperatorTest) {
   auto expected_result = load_table("src/test/tables/joinoperators/int_inner_join.tbl", 2);
   EXPECT_TABLE_EQ_UNORDERED(expected_result, tasks.back()->get_operator()->get_output());
 }
+
+TEST_F(OperatorTaskTest, FusePipelines) {
+  // Pipelines process one row after the other
+  MorselDispatcher::set_default_morsel_size(1u);
+
+  const auto make_operators = [](const float max_b) {
+    auto gt = std::make_shared<GetTable>("table_a");
+    auto ts_a = std::make_shared<TableScan>(gt, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+    auto ts_b = std::make_shared<TableScan>(ts_a, ColumnID{1}, ScanType::OpLessThan, max_b);
+    auto projection = std::make_shared<Projection>(
+        ts_b, Projection::ColumnExpressions{Expression::create_column(ColumnID{0}),
+                                            Expression::create_binary_operator(ExpressionType::Addition,
+                                                                               Expression::create_column(ColumnID{1}),
+                                                                               Expression::create_literal(1.0f))});
+    return std::make_tuple(gt, ts_a, projection);
+  };
+
+  // Also if no row qualifies
+  for (const auto max_b : {458.0f, 0.0f}) {
+    const auto [fused_gt, fused_ts_a, fused_projection] = make_operators(max_b);
+    const auto fused_tasks = OperatorTask::make_tasks_from_operator(fused_projection);
+    for (auto& task : fused_tasks) task->schedule();
+
+    const auto [gt, ts_a, projection] = make_operators(max_b);
+    const auto tasks = OperatorTask::make_tasks_from_operator(projection, false);
+    for (auto& task : tasks) task->schedule();
+
+    // Both scans and the projection are executed by one task, without materializing the output of the scans
+    ASSERT_EQ(fused_tasks.size(), 2u);
+    EXPECT_EQ(fused_tasks.back()->get_operator(), fused_projection);
+    EXPECT_EQ(fused_ts_a->get_output(), nullptr);
+    EXPECT_EQ(tasks.size(), 4u);
+    EXPECT_NE(ts_a->get_output(), nullptr);
+
+    EXPECT_TABLE_EQ_ORDERED(fused_projection->get_output(), projection->get_output());
+  }
+}
+
+TEST_F(OperatorTaskTest, SharedOperatorsAreNotFused) {
+  auto gt = std::make_shared<GetTable>("table_a");
+  auto ts_shared = std::make_shared<TableScan>(gt, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  auto ts = std::make_shared<TableScan>(ts_shared, ColumnID{1}, ScanType::OpLessThan, 458.0f);
+  auto join = std::make_shared<JoinHash>(ts_shared, ts, JoinMode::Inner,
+                                         std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}), ScanType::OpEquals);
+
+  auto tasks = OperatorTask::make_tasks_from_operator(join);
+  for (auto& task : tasks) task->schedule();
+
+  EXPECT_EQ(tasks.size(), 4u);
+  EXPECT_FALSE(ts->input_is_fused());
+  EXPECT_EQ(join->get_output()->row_count(), 1u);
+}
+
 }  // namespace opossum
@@ -0,0 +1,39 @@
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/bloom_filter.hpp"
+#include "utils/murmur_hash.hpp"
+
+namespace opossum {
+
+class BloomFilterTest : public BaseTest {};
+
+TEST_F(BloomFilterTest, NoFalseNegatives) {
+  auto bloom_filter = BloomFilter<int32_t>{1000};
+  for (auto value = 0; value < 1000; ++value) bloom_filter.insert(value * 3);
+
+  for (auto value = 0; value < 1000; ++value) {
+    EXPECT_TRUE(bloom_filter.contains(value * 3));
+  }
+
+  // About 3% false positives are expected
+  auto false_positive_count = 0;
+  for (auto value = 0; value < 1000; ++value) {
+    if (bloom_filter.contains(value * 3 + 1)) ++false_positive_count;
+  }
+  EXPECT_LT(false_positive_count, 100);
+}
+
+TEST_F(BloomFilterTest, InsertHashes) {
+  auto bloom_filter = BloomFilter<std::string>{2};
+  bloom_filter.insert_hash(murmur2<std::string>("Alpha", 13u));
+  bloom_filter.insert("Bravo");
+
+  EXPECT_TRUE(bloom_filter.contains_hash(murmur2<std::string>("Alpha", 13u)));
+  EXPECT_TRUE(bloom_filter.contains("Bravo"));
+  EXPECT_FALSE(bloom_filter.contains("Charlie"));
+}
+
+}  // namespace opossum
@@ -0,0 +1,100 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/flat_hash_table.hpp"
+#include "utils/murmur_hash.hpp"
+
+namespace opossum {
+
+// Counts how often keys are compared
+struct CountingKey {
+  bool operator==(const CountingKey& other) const {
+    ++comparison_count;
+    return value == other.value;
+  }
+
+  int32_t value;
+  static inline size_t comparison_count = 0u;
+};
+
+class FlatHashTableTest : public BaseTest {
+ protected:
+  template <typename T>
+  static std::vector<RowID> get_row_ids(const FlatHashTable<T>& hashtable, const T& value) {
+    auto row_ids = std::vector<RowID>{};
+    const auto count =
+        hashtable.for_each_row_id(value, murmur2<T>(value, 0u), [&](const RowID row_id) { row_ids.push_back(row_id); });
+    EXPECT_EQ(count, row_ids.size());
+    return row_ids;
+  }
+};
+
+TEST_F(FlatHashTableTest, BasicPutAndGet) {
+  auto hashtable = FlatHashTable<int32_t>{2};
+  hashtable.put(5, murmur2<int32_t>(5, 0u), RowID{ChunkID{0}, 0});
+  hashtable.put(6, murmur2<int32_t>(6, 0u), RowID{ChunkID{0}, 1});
+  hashtable.finalize();
+
+  EXPECT_TRUE(hashtable.contains(5, murmur2<int32_t>(5, 0u)));
+  EXPECT_TRUE(hashtable.contains(6, murmur2<int32_t>(6, 0u)));
+  EXPECT_FALSE(hashtable.contains(7, murmur2<int32_t>(7, 0u)));
+
+  EXPECT_EQ(get_row_ids(hashtable, 6), (std::vector<RowID>{RowID{ChunkID{0}, 1}}));
+  EXPECT_TRUE(get_row_ids(hashtable, 7).empty());
+}
+
+TEST_F(FlatHashTableTest, StackRowIDs) {
+  auto hashtable = FlatHashTable<std::string>{6};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 6; ++chunk_offset) {
+    const auto value = std::string{chunk_offset % 2 ? "odd" : "even"};
+    hashtable.put(value, murmur2<std::string>(value, 0u), RowID{ChunkID{1}, chunk_offset});
+  }
+  hashtable.finalize();
+
+  EXPECT_EQ(get_row_ids(hashtable, std::string{"even"}),
+            (std::vector<RowID>{RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 2}, RowID{ChunkID{1}, 4}}));
+  EXPECT_EQ(get_row_ids(hashtable, std::string{"odd"}),
+            (std::vector<RowID>{RowID{ChunkID{1}, 1}, RowID{ChunkID{1}, 3}, RowID{ChunkID{1}, 5}}));
+}
+
+TEST_F(FlatHashTableTest, HandleCollision) {
+  // All values have the same hash, so they have to be placed in consecutive slots
+  auto hashtable = FlatHashTable<int32_t>{4};
+  hashtable.put(4, 42u, RowID{ChunkID{0}, 0});
+  hashtable.put(3617331, 42u, RowID{ChunkID{0}, 1});
+  hashtable.put(4, 42u, RowID{ChunkID{0}, 2});
+  hashtable.put(6165505, 42u, RowID{ChunkID{0}, 3});
+  hashtable.finalize();
+
+  EXPECT_EQ(hashtable.for_each_row_id(4, 42u, [](RowID) {}), 2u);
+  EXPECT_EQ(hashtable.for_each_row_id(3617331, 42u, [](RowID) {}), 1u);
+  EXPECT_EQ(hashtable.for_each_row_id(6165505, 42u, [](RowID) {}), 1u);
+  EXPECT_FALSE(hashtable.contains(5346671, 42u));
+}
+
+TEST_F(FlatHashTableTest, CompareValuesOnlyIfHashesMatch) {
+  // The table has eight slots, so all hashes start probing at the same slot. Only the second insert of 3 compares keys.
+  CountingKey::comparison_count = 0u;
+  auto hashtable = FlatHashTable<CountingKey>{4};
+  hashtable.put(CountingKey{1}, 1u, RowID{ChunkID{0}, 0});
+  hashtable.put(CountingKey{2}, 9u, RowID{ChunkID{0}, 1});
+  hashtable.put(CountingKey{3}, 17u, RowID{ChunkID{0}, 2});
+  hashtable.put(CountingKey{3}, 17u, RowID{ChunkID{0}, 3});
+  hashtable.finalize();
+  EXPECT_EQ(CountingKey::comparison_count, 1u);
+
+  CountingKey::comparison_count = 0u;
+  EXPECT_EQ(hashtable.for_each_row_id(CountingKey{3}, 17u, [](RowID) {}), 2u);
+  EXPECT_EQ(CountingKey::comparison_count, 1u);
+
+  CountingKey::comparison_count = 0u;
+  EXPECT_FALSE(hashtable.contains(CountingKey{4}, 25u));
+  EXPECT_FALSE(hashtable.contains(CountingKey{1}, 9u));
+  EXPECT_EQ(CountingKey::comparison_count, 1u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#include <cstdint>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/group_key_table.hpp"
+
+namespace opossum {
+
+class GroupKeyTableTest : public BaseTest {};
+
+TEST_F(GroupKeyTableTest, AssignDenseIds) {
+  auto table = GroupKeyTable{2};
+
+  const auto key_a = std::vector<uint64_t>{1, 2};
+  const auto key_b = std::vector<uint64_t>{2, 1};
+
+  EXPECT_EQ(table.get_or_insert(key_a.data()), 0u);
+  EXPECT_EQ(table.get_or_insert(key_b.data()), 1u);
+  EXPECT_EQ(table.get_or_insert(key_a.data()), 0u);
+  EXPECT_EQ(table.group_count(), 2u);
+
+  EXPECT_EQ(std::vector<uint64_t>(table.key(1), table.key(1) + 2), key_b);
+}
+
+TEST_F(GroupKeyTableTest, Grow) {
+  // Starts with 8 slots, so that it has to grow several times
+  auto table = GroupKeyTable{1};
+  for (auto word = uint64_t{0}; word < 1000; ++word) {
+    EXPECT_EQ(table.get_or_insert(&word), word);
+  }
+
+  for (auto word = uint64_t{0}; word < 1000; ++word) {
+    EXPECT_EQ(table.get_or_insert(&word), word);
+    EXPECT_EQ(*table.key(static_cast<uint32_t>(word)), word);
+  }
+  EXPECT_EQ(table.group_count(), 1000u);
+}
+
+TEST_F(GroupKeyTableTest, EmptyKeys) {
+  // Without group-by columns, all rows belong to the same group
+  auto table = GroupKeyTable{0};
+  EXPECT_EQ(table.get_or_insert(nullptr), 0u);
+  EXPECT_EQ(table.get_or_insert(nullptr), 0u);
+  EXPECT_EQ(table.group_count(), 1u);
+}
+
+}  // namespace opossum
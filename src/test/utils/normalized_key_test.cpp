@@ -0,0 +1,49 @@
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/normalized_key.hpp"
+
+namespace opossum {
+
+class NormalizedKeyTest : public BaseTest {
+ protected:
+  // Checks that the keys of the values (given in ascending order) are ascending, or descending if inverted
+  template <typename T>
+  void test_order(const std::vector<T>& values) {
+    for (const auto invert : {false, true}) {
+      for (auto index = size_t{1}; index < values.size(); ++index) {
+        auto previous_key = std::string{};
+        auto key = std::string{};
+        append_normalized_value(previous_key, values[index - 1], invert);
+        append_normalized_value(key, values[index], invert);
+
+        EXPECT_EQ(previous_key < key, !invert) << index;
+      }
+    }
+  }
+};
+
+TEST_F(NormalizedKeyTest, Numbers) {
+  test_order<int32_t>({std::numeric_limits<int32_t>::min(), -300, -1, 0, 1, 256, std::numeric_limits<int32_t>::max()});
+  test_order<int64_t>({std::numeric_limits<int64_t>::min(), -1, 0, int64_t{1} << 40});
+  test_order<float>({-std::numeric_limits<float>::infinity(), -2.5f, -0.5f, 0.0f, 0.25f, 3.0f});
+  test_order<double>({-1e300, -2.0, -0.0000001, 0.0, 1e-300, 7.5, 1e300});
+}
+
+TEST_F(NormalizedKeyTest, NegativeZero) {
+  auto key = std::string{};
+  auto negative_zero_key = std::string{};
+  append_normalized_value(key, 0.0, false);
+  append_normalized_value(negative_zero_key, -0.0, false);
+  EXPECT_EQ(key, negative_zero_key);
+}
+
+TEST_F(NormalizedKeyTest, Strings) {
+  test_order<std::string>({"", std::string{"\0", 1}, std::string{"\0\0", 2}, "\x01", "a", "ab", "b", "\xFF"});
+}
+
+}  // namespace opossum